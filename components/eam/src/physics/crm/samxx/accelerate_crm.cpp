@@ -22,16 +22,17 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   real tmin = 50.0;  // should never get below 50K in crm, following UP-CAM implementation
   int idx_qt = index_water_vapor;
 
-  real2d ubaccel("ubaccel", nzm, ncrms);
-  real2d vbaccel("vbaccel", nzm, ncrms);
-  real2d tbaccel("tbaccel", nzm, ncrms);
-  real2d qtbaccel("qtbaccel", nzm, ncrms);
-  real2d ttend_acc("ttend_acc", nzm, ncrms);
-  real2d qtend_acc("qtend_acc", nzm, ncrms);
-  real2d utend_acc("utend_acc", nzm, ncrms);
-  real2d vtend_acc("vtend_acc", nzm, ncrms);
-  real2d qpoz("qpoz", nzm, ncrms);
-  real2d qneg("qneg", nzm, ncrms);
+  WorkspaceScope ws;
+  real2d ubaccel = ws.get("ubaccel", nzm, ncrms);
+  real2d vbaccel = ws.get("vbaccel", nzm, ncrms);
+  real2d tbaccel = ws.get("tbaccel", nzm, ncrms);
+  real2d qtbaccel = ws.get("qtbaccel", nzm, ncrms);
+  real2d ttend_acc = ws.get("ttend_acc", nzm, ncrms);
+  real2d qtend_acc = ws.get("qtend_acc", nzm, ncrms);
+  real2d utend_acc = ws.get("utend_acc", nzm, ncrms);
+  real2d vtend_acc = ws.get("vtend_acc", nzm, ncrms);
+  real2d qpoz = ws.get("qpoz", nzm, ncrms);
+  real2d qneg = ws.get("qneg", nzm, ncrms);
 
   // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   // Compute the average among horizontal columns for each variable
@@ -2,12 +2,13 @@
 
 void advect_all_scalars() {
 
-  real2d dummy("dummy",nz,ncrms);
-  real1d esmt_offset("esmt_offset", ncrms);
+  WorkspaceScope ws;
+  real2d dummy = ws.get("dummy", nz,ncrms);
+  real1d esmt_offset = ws.get("esmt_offset", ncrms);
   YAKL_SCOPE( u_esmt  , :: u_esmt);
   YAKL_SCOPE( v_esmt  , :: v_esmt);
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real1d esmt_min("esmt_min",ncrms);
+  real1d esmt_min = ws.get("esmt_min", ncrms);
   yakl::memset(esmt_min,1.0e20);
 
   // advection of scalars :
@@ -3,7 +3,8 @@
 void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
   YAKL_SCOPE( ncrms  , ::ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
+  WorkspaceScope ws;
+  real4d f0 = ws.get("f0", nzm, dimy_s, dimx_s, ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -51,7 +52,8 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
 void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
+  WorkspaceScope ws;
+  real4d f0 = ws.get("f0", nzm, dimy_s, dimx_s, ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -99,7 +101,8 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
 void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux) {
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
+  WorkspaceScope ws;
+  real4d f0 = ws.get("f0", nzm, dimy_s, dimx_s, ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -101,6 +101,10 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
 
   allocate();
 
+  // Scratch arena for the temporaries of the time loop routines. It is sized for
+  // the scalar advection temporaries and grows during the first step if needed.
+  workspace_init( 8 * nz * dimy_s * dimx_s * ncrms );
+
   init_values();
 
   pre_timeloop();
@@ -137,6 +141,8 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
                            crm_output_prec_crm_p, 
 	                   crm_clear_rh_p);
 
+  workspace_finalize();
+
   finalize();
   
   yakl::fence();
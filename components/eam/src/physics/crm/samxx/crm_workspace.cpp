@@ -0,0 +1,78 @@
+
+#include "crm_workspace.h"
+
+// Check-outs are padded to a multiple of this many reals (128 bytes)
+int constexpr workspace_align = 16;
+
+static std::vector<real1d> chunks;
+static WorkspaceMark       top = {0, 0};
+static int                 num_allocs = 0;
+
+
+static void add_chunk(int ichunk, size_t n) {
+  // Chunks past the top of the stack are unused, so a chunk that is too small can be replaced
+  real1d chunk("workspace_chunk", n);
+  num_allocs++;
+  if (ichunk < static_cast<int>(chunks.size())) {
+    chunks[ichunk] = chunk;
+  } else {
+    chunks.push_back(chunk);
+  }
+}
+
+
+void workspace_init(size_t initial_size) {
+  chunks.clear();
+  top = {0, 0};
+  num_allocs = 0;
+  add_chunk(0, initial_size);
+}
+
+
+void workspace_finalize() {
+  chunks.clear();
+  top = {0, 0};
+}
+
+
+int workspace_num_allocs() {
+  return num_allocs;
+}
+
+
+size_t workspace_capacity() {
+  size_t total = 0;
+  for (auto const &chunk : chunks) { total += chunk.get_totElems(); }
+  return total;
+}
+
+
+real *workspace_checkout(size_t n) {
+  n = ((n + workspace_align - 1) / workspace_align) * workspace_align;
+  if (chunks.empty()) {
+    std::cout << "ERROR: workspace_checkout called outside of workspace_init/workspace_finalize\n";
+    exit(-1);
+  }
+  if (top.offset + n > chunks[top.chunk].get_totElems()) {
+    // Move on to the next chunk, growing it if needed
+    int next = top.chunk + 1;
+    if (next >= static_cast<int>(chunks.size()) || n > chunks[next].get_totElems()) {
+      add_chunk(next, std::max(n, static_cast<size_t>(chunks[top.chunk].get_totElems())));
+    }
+    top = {next, 0};
+  }
+  real *ptr = chunks[top.chunk].data() + top.offset;
+  top.offset += n;
+  return ptr;
+}
+
+
+WorkspaceMark workspace_mark() {
+  return top;
+}
+
+
+void workspace_release(WorkspaceMark const &mark) {
+  top = mark;
+}
+
@@ -0,0 +1,72 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+// Scratch arena for the temporary arrays of the CRM routines.
+//
+// The arena is created by workspace_init() at the start of each crm() call and
+// released by workspace_finalize() at the end of it. Routines check out device
+// arrays from a WorkspaceScope, and all the arrays checked out from a scope are
+// returned to the arena when the scope is destroyed. Since scopes live on the
+// call stack, so does the arena: it is a stack allocator over a few chunks of
+// device memory.
+//
+// New chunks are only allocated when a check-out does not fit in the chunks
+// the arena already owns. The first time step may need a few of them, but
+// every later step checks out the same arrays, so steady-state stepping does
+// no allocations. workspace_num_allocs() counts the chunk allocations, and
+// timeloop() checks that it stops growing after the first step in YAKL_DEBUG
+// builds.
+//////////////////////////////////////////////////////////////////////////////////
+
+void workspace_init(size_t initial_size);
+
+void workspace_finalize();
+
+// Number of device allocations made by the arena since the last workspace_init()
+int workspace_num_allocs();
+
+// Total size (in number of reals) of the chunks owned by the arena
+size_t workspace_capacity();
+
+// Returns a pointer to n reals of scratch memory, and advances the arena
+real *workspace_checkout(size_t n);
+
+struct WorkspaceMark {
+  int    chunk;
+  size_t offset;
+};
+
+WorkspaceMark workspace_mark();
+
+void workspace_release(WorkspaceMark const &mark);
+
+
+class WorkspaceScope {
+public:
+  WorkspaceScope() : mark(workspace_mark()) {}
+  ~WorkspaceScope() { workspace_release(mark); }
+
+  WorkspaceScope(WorkspaceScope const &) = delete;
+  WorkspaceScope &operator=(WorkspaceScope const &) = delete;
+
+  // Check out an (uninitialized) device array, e.g.:
+  //   real4d f = ws.get("f", nzm, ny, nx, ncrms);
+  //   int1d kmin = ws.get<int>("kmin", ncrms);
+  template <class T=real, class... Dims>
+  yakl::Array<T,sizeof...(Dims),yakl::memDevice,yakl::styleC> get(char const *label, Dims... dims) {
+    static_assert(sizeof(T) <= sizeof(real), "WorkspaceScope: element type too large");
+    size_t n = 1;
+    for (size_t d : {static_cast<size_t>(dims)...}) { n *= d; }
+    size_t nreals = (n*sizeof(T) + sizeof(real) - 1) / sizeof(real);
+    T *data = reinterpret_cast<T *>(workspace_checkout(nreals));
+    return yakl::Array<T,sizeof...(Dims),yakl::memDevice,yakl::styleC>(label, data, dims...);
+  }
+
+private:
+  WorkspaceMark mark;
+};
+
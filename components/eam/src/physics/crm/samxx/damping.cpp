@@ -21,12 +21,13 @@ void damping() {
   real constexpr tau_max    = 450.0;
   real constexpr fractional_damp_depth = 0.4;
 
-  int1d  n_damp    ("n_damp",ncrms);
-  int2d  do_damping("n_damp",nzm,ncrms);
-  real2d t0loc     ("t0loc" ,nzm,ncrms);
-  real2d u0loc     ("u0loc" ,nzm,ncrms);
-  real2d v0loc     ("v0loc" ,nzm,ncrms);
-  real2d tau       ("tau"   ,nzm,ncrms);
+  WorkspaceScope ws;
+  int1d  n_damp = ws.get<int>("n_damp", ncrms);
+  int2d  do_damping = ws.get<int>("n_damp", nzm,ncrms);
+  real2d t0loc = ws.get("t0loc", nzm,ncrms);
+  real2d u0loc = ws.get("u0loc", nzm,ncrms);
+  real2d v0loc = ws.get("v0loc", nzm,ncrms);
+  real2d tau = ws.get("tau", nzm,ncrms);
 
   if (tau_min < 2.0*dt) { 
     std::cout << "Error: in damping() tau_min is too small!";
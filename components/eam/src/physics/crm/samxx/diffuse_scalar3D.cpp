@@ -16,10 +16,11 @@ void diffuse_scalar3D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
   YAKL_SCOPE( ncrms  , ::ncrms );
 
   if (dosgs) {
-    real4d flx_x("flx_x", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_y("flx_y", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_z("flx_z", nzm+1, ny+1, nx+1, ncrms);
-    real4d dfdt("dfdt", nz, ny, nx, ncrms);
+    WorkspaceScope ws;
+    real4d flx_x = ws.get("flx_x", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_y = ws.get("flx_y", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_z = ws.get("flx_z", nzm+1, ny+1, nx+1, ncrms);
+    real4d dfdt = ws.get("dfdt", nz, ny, nx, ncrms);
 
     int constexpr offx_flx = 1;
     int constexpr offy_flx = 1;
@@ -133,10 +134,11 @@ void diffuse_scalar3D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
   YAKL_SCOPE( ncrms  , ::ncrms );
   
   if (dosgs) {
-    real4d flx_x("flx_x", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_y("flx_y", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_z("flx_z", nzm+1, ny+1, nx+1, ncrms);
-    real4d dfdt("dfdt", nz, ny, nx, ncrms);
+    WorkspaceScope ws;
+    real4d flx_x = ws.get("flx_x", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_y = ws.get("flx_y", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_z = ws.get("flx_z", nzm+1, ny+1, nx+1, ncrms);
+    real4d dfdt = ws.get("dfdt", nz, ny, nx, ncrms);
     int constexpr offx_flx = 1;
     int constexpr offy_flx = 1;
     int constexpr offz_flx = 1;
@@ -250,10 +252,11 @@ void diffuse_scalar3D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb
   YAKL_SCOPE( ncrms  , ::ncrms );
   
   if (dosgs) {
-    real4d flx_x("flx_x", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_y("flx_y", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_z("flx_z", nzm+1, ny+1, nx+1, ncrms);
-    real4d dfdt("dfdt", nz, ny, nx, ncrms);
+    WorkspaceScope ws;
+    real4d flx_x = ws.get("flx_x", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_y = ws.get("flx_y", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_z = ws.get("flx_z", nzm+1, ny+1, nx+1, ncrms);
+    real4d dfdt = ws.get("dfdt", nz, ny, nx, ncrms);
 
     int constexpr offx_flx = 1;
     int constexpr offy_flx = 1;
@@ -14,9 +14,10 @@ void forcing() {
   YAKL_SCOPE( utend         , ::utend );
   YAKL_SCOPE( vtend         , ::vtend );
 
-  real2d qneg("qneg",nzm,ncrms);
-  real2d qpoz("poz" ,nzm,ncrms);
-  int2d  nneg("nneg",nzm,ncrms);
+  WorkspaceScope ws;
+  real2d qneg = ws.get("qneg", nzm,ncrms);
+  real2d qpoz = ws.get("poz", nzm,ncrms);
+  int2d  nneg = ws.get<int>("nneg", nzm,ncrms);
 
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -17,9 +17,10 @@ void ice_fall() {
   YAKL_SCOPE( precsfc       , :: precsfc );
   YAKL_SCOPE( precssfc      , :: precssfc );
 
-  int1d  kmax("kmax",ncrms);
-  int1d  kmin("kmin",ncrms);
-  real4d fz  ("fz"  ,nz,ny,nx,ncrms);
+  WorkspaceScope ws;
+  int1d  kmax = ws.get<int>("kmax", ncrms);
+  int1d  kmin = ws.get<int>("kmin", ncrms);
+  real4d fz = ws.get("fz", nz,ny,nx,ncrms);
 
   // for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
@@ -16,9 +16,10 @@ void kurant () {
   int constexpr max_ncycle = 4;
   real cfl;
 
-  real2d wm    ("wm"   ,nz ,ncrms);
-  real2d uhm   ("uhm"  ,nz ,ncrms);
-  real2d tmpMax("uhMax",nzm,ncrms);
+  WorkspaceScope ws;
+  real2d wm = ws.get("wm", nz ,ncrms);
+  real2d uhm = ws.get("uhm", nz ,ncrms);
+  real2d tmpMax = ws.get("uhMax", nzm,ncrms);
 
   ncycle = 1;
   parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
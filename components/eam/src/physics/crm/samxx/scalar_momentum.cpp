@@ -31,18 +31,19 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
 
    real constexpr pi = 3.14159;
    
-   real1d k_arr("k_arr",nx);
-   real2d dz_loc("dz_loc",nzm+1,ncrms);
-   real3d scalar_wind_avg("scalar_wind_avg",nzm,ny,ncrms);
-   real3d shear("shear",nzm,ny,ncrms);
-   real4d a("a",nzm,ny,nx,ncrms);
-   real4d b("b",nzm,ny,nx,ncrms);
-   real4d c("c",nzm,ny,nx,ncrms);
-   real4d w_i("w_i",nzm,ny,nx,ncrms);
-   real4d pgf("pgf",nzm,ny,nx,ncrms);
+   WorkspaceScope ws;
+   real1d k_arr = ws.get("k_arr", nx);
+   real2d dz_loc = ws.get("dz_loc", nzm+1,ncrms);
+   real3d scalar_wind_avg = ws.get("scalar_wind_avg", nzm,ny,ncrms);
+   real3d shear = ws.get("shear", nzm,ny,ncrms);
+   real4d a = ws.get("a", nzm,ny,nx,ncrms);
+   real4d b = ws.get("b", nzm,ny,nx,ncrms);
+   real4d c = ws.get("c", nzm,ny,nx,ncrms);
+   real4d w_i = ws.get("w_i", nzm,ny,nx,ncrms);
+   real4d pgf = ws.get("pgf", nzm,ny,nx,ncrms);
    int nx2 = nx+2;
-   real4d w_hat("w_hat",nzm,ny,nx2,ncrms);
-   real4d pgf_hat("pgf_hat",nzm,ny,nx2,ncrms);
+   real4d w_hat = ws.get("w_hat", nzm,ny,nx2,ncrms);
+   real4d pgf_hat = ws.get("pgf_hat", nzm,ny,nx2,ncrms);
 
    // The loop over "y" points is mostly unessary, since ESMT
    // is for 2D CRMs, but it is useful for directly comparing
@@ -252,8 +253,9 @@ void scalar_momentum_tend() {
    YAKL_SCOPE( u_esmt    , :: u_esmt );
    YAKL_SCOPE( v_esmt    , :: v_esmt );
    
-   real4d u_esmt_pgf_3D("u_esmt_pgf_3D",nzm,ny,nx,ncrms);
-   real4d v_esmt_pgf_3D("v_esmt_pgf_3d",nzm,ny,nx,ncrms); 
+   WorkspaceScope ws;
+   real4d u_esmt_pgf_3D = ws.get("u_esmt_pgf_3D", nzm,ny,nx,ncrms);
+   real4d v_esmt_pgf_3D = ws.get("v_esmt_pgf_3d", nzm,ny,nx,ncrms);
 
    // Calculate pressure gradient force tendency
    scalar_momentum_pgf(u_esmt,u_esmt_pgf_3D);
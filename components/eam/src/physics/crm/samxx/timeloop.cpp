@@ -14,6 +14,11 @@ void timeloop() {
 
   nstep = 0;
 
+#ifdef YAKL_DEBUG
+  // The scratch arena may only grow during the first step (see crm_workspace.h)
+  int num_allocs_first_step = 0;
+#endif
+
   do {
     nstep = nstep + 1;
 
@@ -190,6 +195,17 @@ void timeloop() {
 
     post_icycle();
 
+#ifdef YAKL_DEBUG
+    if (nstep == 1) {
+      num_allocs_first_step = workspace_num_allocs();
+    } else if (workspace_num_allocs() != num_allocs_first_step) {
+      std::cout << "\ntimeloop() - the workspace arena grew after the first step: "
+                << num_allocs_first_step << " allocations at step 1, "
+                << workspace_num_allocs() << " at step " << nstep << std::endl;
+      exit(-1);
+    }
+#endif
+
   } while (nstep < nstop);
 
 }
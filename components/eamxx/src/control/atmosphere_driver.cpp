@@ -7,6 +7,7 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/grid/remap/horiz_interp_remapper_data.hpp"
 #include "share/util/eamxx_time_stamp.hpp"
 #include "share/util/eamxx_timing.hpp"
 #include "share/util/eamxx_utils.hpp"
@@ -127,6 +128,12 @@ set_params(const ekat::ParameterList& atm_params)
 
   m_atm_params = atm_params;
 
+  // If set, horiz remappers store/load map triplets already partitioned for this decomposition
+  const auto& maps_dir = m_atm_params.sublist("driver_options").get<std::string>("partitioned_remap_maps_dir","none");
+  if (maps_dir!="none") {
+    HorizRemapperData::set_partitioned_maps_dir(maps_dir);
+  }
+
   create_logger ();
 
   m_ad_status |= s_params_set;
@@ -145,10 +152,27 @@ init_scorpio(const int atm_id)
       "       This is an unexpected behavior. Please, contact developers.\n");
   scorpio::init_subsystem(m_atm_comm,atm_id);
 
+  // Optionally, cache non-decomposed data read from file (vertical coords, map weights,
+  // lookup tables,...) at the node level, so that repeated reads are served from memory
+  if ((m_ad_status & s_params_set) and m_atm_params.isSublist("scorpio")) {
+    auto& scorpio_pl = m_atm_params.sublist("scorpio");
+    if (scorpio_pl.get<bool>("read_cache",false)) {
+      scorpio::set_read_cache_enabled(true,scorpio_pl.get<int>("read_cache_max_mb",1024));
+    }
+  }
+
   // In CIME runs, gptl is already inited. In standalone runs, it might
   // not be, depending on what scorpio does.
   init_gptl(m_gptl_externally_handled);
 
+  // Optionally, record the timeline of all timers, to be written in Chrome trace format at finalization
+  if (m_ad_status & s_params_set) {
+    const auto& driver_options_pl = m_atm_params.sublist("driver_options");
+    if (driver_options_pl.get("timers_trace",false)) {
+      enable_timers_trace(m_atm_comm,driver_options_pl.get("timers_trace_max_events",1000000));
+    }
+  }
+
   m_ad_status |= s_scorpio_inited;
 }
 
@@ -557,9 +581,57 @@ void AtmosphereDriver::create_fields()
     m_field_mgr->register_group(greq);
   }
 
+  // If requested, let fields that are computed and consumed within the atm step share memory
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  const bool alias_transient_fields = driver_options_pl.get("alias_transient_fields",false);
+  if (alias_transient_fields) {
+    AtmProcDAG dag;
+    auto lifetimes = dag.compute_field_lifetimes(*m_atm_process_group);
+
+    // Fields read by output streams (directly, or as inputs of output diagnostics) are read
+    // outside of the atm procs, so they must keep their value until the end of the step
+    for (auto& it_grid : lifetimes) {
+      std::set<std::string> output_fields;
+      for (const auto& om : m_output_managers) {
+        const auto names = om.get_model_fields_names(*m_field_mgr,it_grid.first);
+        output_fields.insert(names.begin(),names.end());
+      }
+      auto& grid_lifetimes = it_grid.second;
+      for (auto it=grid_lifetimes.begin(); it!=grid_lifetimes.end(); ) {
+        if (output_fields.count(it->first)==1) {
+          it = grid_lifetimes.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      m_field_mgr->set_field_lifetimes(it_grid.first,grid_lifetimes);
+    }
+  }
+
   // Closes the FM, allocate all fields
   m_field_mgr->registration_ends();
 
+  if (alias_transient_fields) {
+    // Report the memory used by the fields, with and without aliasing of transient fields
+    for (const auto& gname : m_grids_manager->get_grid_names()) {
+      long long fields_mem = 0;
+      for (const auto& it : m_field_mgr->get_repo(gname)) {
+        const auto& fap = it.second->get_header().get_alloc_properties();
+        if (not fap.is_subfield()) {
+          fields_mem += fap.get_alloc_size();
+        }
+      }
+      const auto& plan = m_field_mgr->get_memory_plan(gname);
+      long long mem[2] = {fields_mem, fields_mem - plan.total_size() + plan.arena_size()};
+      long long max_mem[2];
+      m_atm_comm.all_reduce(mem,max_mem,2,MPI_MAX);
+      m_atm_logger->info("[EAMxx] transient fields on grid " + gname + ": " + std::to_string(plan.num_fields()) + " fields share "
+                         + std::to_string(plan.arena_size()/1e6) + "MB (instead of " + std::to_string(plan.total_size()/1e6) + "MB)");
+      m_atm_logger->info("[EAMxx] peak fields memory on grid " + gname + ": " + std::to_string(max_mem[0]/1e6) + "MB without aliasing, "
+                         + std::to_string(max_mem[1]/1e6) + "MB with aliasing");
+    }
+  }
+
   // Set all the fields/groups in the processes. Input fields/groups will be handed
   // to the processes with const scalar type (const Real), to prevent them from
   // overwriting them (though, they can always cast away const...).
@@ -619,7 +691,6 @@ void AtmosphereDriver::create_fields()
     m_field_mgr->add_to_group(fid, "RESTART");
   }
 
-  auto& driver_options_pl = m_atm_params.sublist("driver_options");
   const int verb_lvl = driver_options_pl.get<int>("atmosphere_dag_verbosity_level",-1);
   if (verb_lvl>0) {
     // now that we've got fields, generate a DAG with fields and dependencies
@@ -1727,6 +1798,11 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
   // Destroy all the fields manager
   m_field_mgr->clean_up();
 
+  if (timers_trace_enabled()) {
+    disable_timers_trace();
+    write_timers_trace_to_file (m_atm_comm,"eamxx_timers_trace.json");
+  }
+
   // Write all timers to file, and possibly finalize gptl
   if (not m_gptl_externally_handled) {
     write_timers_to_file (m_atm_comm,"eamxx_timing.txt");
@@ -1779,16 +1855,23 @@ void AtmosphereDriver::report_res_dep_memory_footprint () const {
   // The first report includes memory used by 1) fields (metadata excluded),
   // 2) grids data (dofs, maps, geo views), 3) atm buff manager, and 4) IO.
 
-  // Fields
+  // Fields (transient fields share a single arena, counted separately)
   for (auto gname : m_field_mgr->get_grids_manager()->get_grid_names()) {
+    const auto& plan = m_field_mgr->get_memory_plan(gname);
     for (const auto& it : m_field_mgr->get_repo(gname)) {
       const auto& fap = it.second->get_header().get_alloc_properties();
-      if (fap.is_subfield()) {
+      if (fap.is_subfield() or plan.has_field(it.first.c_str())) {
         continue;
       }
       my_dev_mem_usage += fap.get_alloc_size();
       my_host_mem_usage += fap.get_alloc_size();
     }
+    my_dev_mem_usage += plan.arena_size();
+    if (std::is_same<HostDevice,DefaultDevice>::value) {
+      my_host_mem_usage += plan.arena_size();
+    } else {
+      my_host_mem_usage += plan.total_size();
+    }
   }
   // Grids
   for (const auto& it : m_grids_manager->get_repo()) {
@@ -2,20 +2,22 @@
 
 #include "share/field/field_utils.hpp"
 
-#include <ekat_math_utils.hpp>
+#include <algorithm>
 
 namespace scream {
 
 void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, const Field &weight,
-                                     const Field &lat, const ekat::Comm *comm) {
+                                     const view_1di &bin_offsets, const view_1di &bin_cols,
+                                     const ekat::Comm *comm) {
   auto result_layout       = result.get_header().get_identifier().get_layout();
   const int num_zonal_bins = result_layout.dim(0);
   const int ncols          = field.get_header().get_identifier().get_layout().dim(0);
-  const Real lat_delta     = sp(180.0) / num_zonal_bins;
+  const int bin_ncols_hint = std::max(1, ncols / num_zonal_bins);
 
+  // Each team handles one zonal bin, and only visits the columns in that bin.
+  // For rank>1 fields, threads are spread over the non-column dims, and each
+  // thread accumulates over the bin's columns, so that all levels are done in one pass.
   auto weight_view = weight.get_view<const Real *>();
-  auto lat_view    = lat.get_view<const Real *>();
-  using KT         = ekat::KokkosTypes<DefaultDevice>;
   using TeamPolicy = Kokkos::TeamPolicy<Field::device_t::execution_space>;
   using TeamMember = typename TeamPolicy::member_type;
   using TPF        = ekat::TeamPolicyFactory<typename KT::ExeSpace>;
@@ -23,18 +25,17 @@ void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, co
   case 1: {
     auto field_view        = field.get_view<const Real *>();
     auto result_view       = result.get_view<Real *>();
-    TeamPolicy team_policy = TPF::get_default_team_policy(num_zonal_bins, ncols);
+    TeamPolicy team_policy = TPF::get_default_team_policy(num_zonal_bins, bin_ncols_hint);
     Kokkos::parallel_for(
         "compute_zonal_sum_" + field.name(), team_policy, KOKKOS_LAMBDA(const TeamMember &tm) {
-          const int lat_i      = tm.league_rank();
-          const Real lat_lower = sp(-90.0) + lat_i * lat_delta;
-          const Real lat_upper = lat_lower + lat_delta;
+          const int lat_i = tm.league_rank();
+          const int beg   = bin_offsets(lat_i);
+          const int end   = bin_offsets(lat_i + 1);
           Kokkos::parallel_reduce(
-              Kokkos::TeamVectorRange(tm, ncols),
-              [&](int i, Real &val) {
-                // TODO: check if tenary is ok here (if not, multiply by flag)
-                int flag = (lat_lower <= lat_view(i)) && (lat_view(i) < lat_upper);
-                val += flag ? weight_view(i) * field_view(i) : sp(0.0);
+              Kokkos::TeamVectorRange(tm, beg, end),
+              [&](int k, Real &val) {
+                const int i = bin_cols(k);
+                val += weight_view(i) * field_view(i);
               },
               result_view(lat_i));
         });
@@ -43,22 +44,20 @@ void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, co
     const int d1           = result_layout.dim(1);
     auto field_view        = field.get_view<const Real **>();
     auto result_view       = result.get_view<Real **>();
-    TeamPolicy team_policy = TPF::get_default_team_policy(num_zonal_bins * d1, ncols);
+    TeamPolicy team_policy = TPF::get_default_team_policy(num_zonal_bins, d1);
     Kokkos::parallel_for(
         "compute_zonal_sum_" + field.name(), team_policy, KOKKOS_LAMBDA(const TeamMember &tm) {
-          const int idx        = tm.league_rank();
-          const int d1_i       = idx / num_zonal_bins;
-          const int lat_i      = idx % num_zonal_bins;
-          const Real lat_lower = sp(-90.0) + lat_i * lat_delta;
-          const Real lat_upper = lat_lower + lat_delta;
-          Kokkos::parallel_reduce(
-              Kokkos::TeamVectorRange(tm, ncols),
-              [&](int i, Real &val) {
-                int flag = (lat_lower <= lat_view(i)) && (lat_view(i) < lat_upper);
-                // TODO: check if tenary is ok here (if not, multiply by flag)
-                val += flag ? weight_view(i) * field_view(i, d1_i) : sp(0.0);
-              },
-              result_view(lat_i, d1_i));
+          const int lat_i = tm.league_rank();
+          const int beg   = bin_offsets(lat_i);
+          const int end   = bin_offsets(lat_i + 1);
+          Kokkos::parallel_for(Kokkos::TeamVectorRange(tm, d1), [&](int d1_i) {
+            Real val = 0;
+            for (int k = beg; k < end; ++k) {
+              const int i = bin_cols(k);
+              val += weight_view(i) * field_view(i, d1_i);
+            }
+            result_view(lat_i, d1_i) = val;
+          });
         });
   } break;
   case 3: {
@@ -66,24 +65,22 @@ void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, co
     const int d2           = result_layout.dim(2);
     auto field_view        = field.get_view<const Real ***>();
     auto result_view       = result.get_view<Real ***>();
-    TeamPolicy team_policy = TPF::get_default_team_policy(num_zonal_bins * d1 * d2, ncols);
+    TeamPolicy team_policy = TPF::get_default_team_policy(num_zonal_bins, d1 * d2);
     Kokkos::parallel_for(
         "compute_zonal_sum_" + field.name(), team_policy, KOKKOS_LAMBDA(const TeamMember &tm) {
-          const int idx        = tm.league_rank();
-          const int d1_i       = idx / (num_zonal_bins * d2);
-          const int idx2       = idx % (num_zonal_bins * d2);
-          const int d2_i       = idx2 / num_zonal_bins;
-          const int lat_i      = idx2 % num_zonal_bins;
-          const Real lat_lower = sp(-90.0) + lat_i * lat_delta;
-          const Real lat_upper = lat_lower + lat_delta;
-          Kokkos::parallel_reduce(
-              Kokkos::TeamVectorRange(tm, ncols),
-              [&](int i, Real &val) {
-                int flag = (lat_lower <= lat_view(i)) && (lat_view(i) < lat_upper);
-                // TODO: check if tenary is ok here (if not, multiply by flag)
-                val += flag ? weight_view(i) * field_view(i, d1_i, d2_i) : sp(0.0);
-              },
-              result_view(lat_i, d1_i, d2_i));
+          const int lat_i = tm.league_rank();
+          const int beg   = bin_offsets(lat_i);
+          const int end   = bin_offsets(lat_i + 1);
+          Kokkos::parallel_for(Kokkos::TeamVectorRange(tm, d1 * d2), [&](int idx) {
+            const int d1_i = idx / d2;
+            const int d2_i = idx % d2;
+            Real val = 0;
+            for (int k = beg; k < end; ++k) {
+              const int i = bin_cols(k);
+              val += weight_view(i) * field_view(i, d1_i, d2_i);
+            }
+            result_view(lat_i, d1_i, d2_i) = val;
+          });
         });
   } break;
   default:
@@ -102,6 +99,39 @@ void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, co
   }
 }
 
+void ZonalAvgDiag::compute_bin_map(view_1di &bin_offsets, view_1di &bin_cols,
+                                   const Field &lat, const int num_zonal_bins) {
+  const int ncols      = lat.get_header().get_identifier().get_layout().dim(0);
+  const Real lat_delta = sp(180.0) / num_zonal_bins;
+
+  // Bin of each column. Columns at the north pole go in the last bin
+  auto lat_h = lat.get_view<const Real *, Host>();
+  std::vector<int> col_bin(ncols);
+  for (int i = 0; i < ncols; ++i) {
+    const int lat_i = static_cast<int>((lat_h(i) + sp(90.0)) / lat_delta);
+    col_bin[i]      = std::max(0, std::min(lat_i, num_zonal_bins - 1));
+  }
+
+  // Counting sort of the columns by bin (preserving the column order within each bin)
+  bin_offsets = view_1di("zonal_bin_offsets", num_zonal_bins + 1);
+  bin_cols    = view_1di("zonal_bin_cols", ncols);
+  auto bin_offsets_h = Kokkos::create_mirror_view(bin_offsets);
+  auto bin_cols_h    = Kokkos::create_mirror_view(bin_cols);
+  Kokkos::deep_copy(bin_offsets_h, 0);
+  for (int i = 0; i < ncols; ++i) {
+    ++bin_offsets_h(col_bin[i] + 1);
+  }
+  for (int b = 0; b < num_zonal_bins; ++b) {
+    bin_offsets_h(b + 1) += bin_offsets_h(b);
+  }
+  std::vector<int> pos(bin_offsets_h.data(), bin_offsets_h.data() + num_zonal_bins);
+  for (int i = 0; i < ncols; ++i) {
+    bin_cols_h(pos[col_bin[i]]++) = i;
+  }
+  Kokkos::deep_copy(bin_offsets, bin_offsets_h);
+  Kokkos::deep_copy(bin_cols, bin_cols_h);
+}
+
 ZonalAvgDiag::ZonalAvgDiag(const ekat::Comm &comm, const ekat::ParameterList &params)
     : AtmosphereDiagnostic(comm, params) {
   const auto &field_name     = m_params.get<std::string>("field_name");
@@ -166,27 +196,36 @@ void ZonalAvgDiag::initialize_impl(const RunType /*run_type*/) {
   Field ones(ones_id);
   ones.allocate_view();
   ones.deep_copy(1.0);
-  compute_zonal_sum(zonal_area, m_scaled_area, ones, m_lat, &m_comm);
+
+  // lat does not change, so map each zonal bin to its columns once
+  compute_bin_map(m_bin_offsets, m_bin_cols, m_lat, m_num_zonal_bins);
+  compute_zonal_sum(zonal_area, m_scaled_area, ones, m_bin_offsets, m_bin_cols, &m_comm);
 
   // scale area by 1 / zonal area
-  using RangePolicy     = Kokkos::RangePolicy<Field::device_t::execution_space>;
-  const Real lat_delta  = sp(180.0) / m_num_zonal_bins;
-  const int ncols       = field_layout.dim(0);
-  const int nbins       = m_num_zonal_bins;
-  auto lat_view         = m_lat.get_view<const Real *>();
-  auto zonal_area_view  = zonal_area.get_view<const Real *>();
-  auto scaled_area_view = m_scaled_area.get_view<Real *>();
+  using TeamPolicy       = Kokkos::TeamPolicy<Field::device_t::execution_space>;
+  using TeamMember       = typename TeamPolicy::member_type;
+  using TPF              = ekat::TeamPolicyFactory<typename KT::ExeSpace>;
+  const int ncols        = field_layout.dim(0);
+  const auto bin_offsets = m_bin_offsets;
+  const auto bin_cols    = m_bin_cols;
+  auto zonal_area_view   = zonal_area.get_view<const Real *>();
+  auto scaled_area_view  = m_scaled_area.get_view<Real *>();
+  TeamPolicy team_policy =
+      TPF::get_default_team_policy(m_num_zonal_bins, std::max(1, ncols / m_num_zonal_bins));
   Kokkos::parallel_for(
-      "scale_area_by_zonal_area_" + field.name(), RangePolicy(0, ncols),
-      KOKKOS_LAMBDA(const int &i) {
-        const int lat_i = ekat::impl::min(static_cast<int>((lat_view(i) + sp(90.0)) / lat_delta),nbins-1);
-        scaled_area_view(i) /= zonal_area_view(lat_i);
+      "scale_area_by_zonal_area_" + field.name(), team_policy,
+      KOKKOS_LAMBDA(const TeamMember &tm) {
+        const int lat_i = tm.league_rank();
+        Kokkos::parallel_for(
+            Kokkos::TeamVectorRange(tm, bin_offsets(lat_i), bin_offsets(lat_i + 1)),
+            [&](int k) { scaled_area_view(bin_cols(k)) /= zonal_area_view(lat_i); });
       });
 }
 
 void ZonalAvgDiag::compute_diagnostic_impl() {
   const auto &field = get_fields_in().front();
-  compute_zonal_sum(m_diagnostic_output, field, m_scaled_area, m_lat, &m_comm);
+  compute_zonal_sum(m_diagnostic_output, field, m_scaled_area, m_bin_offsets, m_bin_cols,
+                    &m_comm);
 }
 
 } // namespace scream
@@ -14,6 +14,9 @@ namespace scream {
 class ZonalAvgDiag : public AtmosphereDiagnostic {
 
 public:
+  using KT       = ekat::KokkosTypes<DefaultDevice>;
+  using view_1di = typename KT::template view_1d<int>;
+
   // Constructors
   ZonalAvgDiag(const ekat::Comm &comm, const ekat::ParameterList &params);
 
@@ -35,12 +38,19 @@ public:
   // This is equivalent to f_out = einsum('i,i...k->...k', weight, f_in).
   // The implementation is such that:
   // - all Field objects must be allocated
-  // - the first dimension for field, weight, and lat is for the columns (COL)
+  // - the first dimension for field and weight is for the columns (COL)
   // - the first dimension for result is for the zonal bins (CMP,"bin")
   // - field and result must be the same dimension, up to 3
+  // - bin_offsets/bin_cols store, in CRS format, the columns in each bin (see below)
   // TODO: make it a local function in the cpp file
   static void compute_zonal_sum(const Field &result, const Field &field, const Field &weight,
-                                const Field &lat, const ekat::Comm *comm = nullptr);
+                                const view_1di &bin_offsets, const view_1di &bin_cols,
+                                const ekat::Comm *comm = nullptr);
+
+  // Utility to build the CRS bin->columns map from the latitude of the columns.
+  // The columns in bin b are bin_cols(k) for bin_offsets(b) <= k < bin_offsets(b+1)
+  static void compute_bin_map(view_1di &bin_offsets, view_1di &bin_cols,
+                              const Field &lat, const int num_zonal_bins);
 
 protected:
   std::string m_diag_name;
@@ -48,6 +58,10 @@ protected:
 
   Field m_lat;
   Field m_scaled_area;
+
+  // Computed once at init, since lat does not change
+  view_1di m_bin_offsets;
+  view_1di m_bin_cols;
 };
 
 } // namespace scream
@@ -13,15 +13,33 @@ extern "C" void cosp_c2f_run(const int ncol, const int nsubcol, const int nlay,
 namespace scream {
 
     namespace CospFunc {
-        using lview_host_1d = typename ekat::KokkosTypes<HostDevice>::template lview<Real*  >;
-        using lview_host_2d = typename ekat::KokkosTypes<HostDevice>::template lview<Real** >;
-        using lview_host_3d = typename ekat::KokkosTypes<HostDevice>::template lview<Real***>;
-        template <typename S>
-        using view_1d = typename ekat::KokkosTypes<HostDevice>::template view_1d<S>;
-        template <typename S>
-        using view_2d = typename ekat::KokkosTypes<HostDevice>::template view_2d<S>;
-        template <typename S>
-        using view_3d = typename ekat::KokkosTypes<HostDevice>::template view_3d<S>;
+        /*
+         * Layout of the contiguous buffers used to stage COSP inputs/outputs.
+         *
+         * All arrays are stored back to back in Fortran (column-major) order,
+         * with leading dimension ncol, so that a pointer to the start of each
+         * array can be handed directly to cosp_c2f_run.
+         */
+        struct StagingLayout {
+            // The (ncol,nlay) inputs, in the order they are stored in the buffer
+            enum Input2d { T_mid, p_mid, z_mid, qv, qc, qi, cldfrac, reff_qc, reff_qi, dtau067, dtau105, num_input_2d };
+
+            int ncol, nlay, ntau, nctp, ncth;
+
+            // Inputs: sunlit(ncol), skt(ncol), the Input2d arrays, and p_int(ncol,nlay+1)
+            KOKKOS_INLINE_FUNCTION int sunlit () const { return 0; }
+            KOKKOS_INLINE_FUNCTION int skt    () const { return ncol; }
+            KOKKOS_INLINE_FUNCTION int input_2d (const int k) const { return 2*ncol + k*ncol*nlay; }
+            KOKKOS_INLINE_FUNCTION int p_int  () const { return input_2d(num_input_2d); }
+            KOKKOS_INLINE_FUNCTION int input_size () const { return p_int() + ncol*(nlay+1); }
+
+            // Outputs: isccp_cldtot(ncol), isccp_ctptau(ncol,ntau,nctp), modis_ctptau(ncol,ntau,nctp), misr_cthtau(ncol,ntau,ncth)
+            KOKKOS_INLINE_FUNCTION int isccp_cldtot () const { return 0; }
+            KOKKOS_INLINE_FUNCTION int isccp_ctptau () const { return ncol; }
+            KOKKOS_INLINE_FUNCTION int modis_ctptau () const { return isccp_ctptau() + ncol*ntau*nctp; }
+            KOKKOS_INLINE_FUNCTION int misr_cthtau  () const { return modis_ctptau() + ncol*ntau*nctp; }
+            KOKKOS_INLINE_FUNCTION int output_size  () const { return misr_cthtau() + ncol*ntau*ncth; }
+        };
 
         inline void initialize(int ncol, int nsubcol, int nlay) {
             cosp_c2f_init(ncol, nsubcol, nlay);
@@ -29,72 +47,19 @@ namespace scream {
         inline void finalize() {
             cosp_c2f_final();
         };
-        inline void main(
-                const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
-                const view_1d<const Real>& sunlit , const view_1d<const Real>& skt,
-                const view_2d<const Real>& T_mid  , const view_2d<const Real>& p_mid  ,
-                const view_2d<const Real>& p_int,  const view_2d<const Real>& z_mid,
-                const view_2d<const Real>& qv     , const view_2d<const Real>& qc,
-                const view_2d<const Real>& qi, const view_2d<const Real>& cldfrac,
-                const view_2d<const Real>& reff_qc, const view_2d<const Real>& reff_qi,
-                const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105,
-                const view_1d<Real>& isccp_cldtot , const view_3d<Real>& isccp_ctptau,
-                const view_3d<Real>& modis_ctptau, const view_3d<Real>& misr_cthtau) {
-
-            // Make host copies and permute data as needed
-            lview_host_2d
-                  T_mid_h("T_mid_h", ncol, nlay), p_mid_h("p_mid_h", ncol, nlay), p_int_h("p_int_h", ncol, nlay+1),
-                  z_mid_h("z_mid_h", ncol, nlay), qv_h("qv_h", ncol, nlay), qc_h("qc_h", ncol, nlay), qi_h("qi_h", ncol, nlay),
-                  cldfrac_h("cldfrac_h", ncol, nlay),
-                  reff_qc_h("reff_qc_h", ncol, nlay), reff_qi_h("reff_qi_h", ncol, nlay),
-                  dtau067_h("dtau_067_h", ncol, nlay), dtau105_h("dtau105_h", ncol, nlay);
-            lview_host_3d isccp_ctptau_h("isccp_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d modis_ctptau_h("modis_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d misr_cthtau_h("misr_cthtau_h", ncol, ntau, ncth);
-
-            // Copy to layoutLeft host views
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < nlay; j++) {
-                    T_mid_h(i,j) = T_mid(i,j);
-                    p_mid_h(i,j) = p_mid(i,j);
-                    z_mid_h(i,j) = z_mid(i,j);
-                    qv_h(i,j) = qv(i,j);
-                    qc_h(i,j) = qc(i,j);
-                    qi_h(i,j) = qi(i,j);
-                    cldfrac_h(i,j) = cldfrac(i,j);
-                    reff_qc_h(i,j) = reff_qc(i,j);
-                    reff_qi_h(i,j) = reff_qi(i,j);
-                    dtau067_h(i,j) = dtau067(i,j);
-                    dtau105_h(i,j) = dtau105(i,j);
-                }
-            }
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < nlay+1; j++) {
-                    p_int_h(i,j) = p_int(i,j);
-                }
-            }
-
-            // Subsample here?
-
-            // Call COSP wrapper
-            cosp_c2f_run(ncol, nsubcol, nlay, ntau, nctp, ncth,
-                    emsfc_lw, sunlit.data(), skt.data(), T_mid_h.data(), p_mid_h.data(), p_int_h.data(),
-                    z_mid_h.data(), qv_h.data(), qc_h.data(), qi_h.data(),
-                    cldfrac_h.data(), reff_qc_h.data(), reff_qi_h.data(), dtau067_h.data(), dtau105_h.data(),
-                    isccp_cldtot.data(), isccp_ctptau_h.data(), modis_ctptau_h.data(), misr_cthtau_h.data());
-
-            // Copy outputs back to layoutRight views
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < ntau; j++) {
-                    for (int k = 0; k < nctp; k++) {
-                        isccp_ctptau(i,j,k) = isccp_ctptau_h(i,j,k);
-                        modis_ctptau(i,j,k) = modis_ctptau_h(i,j,k);
-                    }
-                    for (int k = 0; k < ncth; k++) {
-                        misr_cthtau(i,j,k) = misr_cthtau_h(i,j,k);
-                    }
-                }
-            }
+        // Run COSP on the (already permuted) host staging buffers; layout.ncol
+        // may be smaller than the number of columns used at initialization
+        inline void main(const StagingLayout& layout, const Int nsubcol, const Real emsfc_lw,
+                         const Real* inputs, Real* outputs) {
+            using L = StagingLayout;
+            const auto in2d = [&](const int k) { return inputs + layout.input_2d(k); };
+            cosp_c2f_run(layout.ncol, nsubcol, layout.nlay, layout.ntau, layout.nctp, layout.ncth,
+                    emsfc_lw, inputs + layout.sunlit(), inputs + layout.skt(),
+                    in2d(L::T_mid), in2d(L::p_mid), inputs + layout.p_int(),
+                    in2d(L::z_mid), in2d(L::qv), in2d(L::qc), in2d(L::qi),
+                    in2d(L::cldfrac), in2d(L::reff_qc), in2d(L::reff_qi), in2d(L::dtau067), in2d(L::dtau105),
+                    outputs + layout.isccp_cldtot(), outputs + layout.isccp_ctptau(),
+                    outputs + layout.modis_ctptau(), outputs + layout.misr_cthtau());
         }
     }
 }
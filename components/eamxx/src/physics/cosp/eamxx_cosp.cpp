@@ -27,6 +27,9 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Whether to pass only sunlit columns to COSP (night columns are masked anyways)
+  m_sunlit_columns_only = m_params.get<bool>("cosp_sunlit_columns_only", false);
 }
 
 // =========================================================================================
@@ -109,6 +112,15 @@ void Cosp::initialize_impl (const RunType /* run_type */)
   // Set property checks for fields in this process
   CospFunc::initialize(m_num_cols, m_num_subcols, m_num_levs);
 
+  // Allocate staging buffers, large enough to hold all columns
+  const CospFunc::StagingLayout layout {m_num_cols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth};
+  m_active_cols = view_1d<int>("cosp_active_cols",m_num_cols);
+  m_active_slot = view_1d<int>("cosp_active_slot",m_num_cols);
+  m_stage_in    = view_1d<Real>("cosp_stage_in",layout.input_size());
+  m_stage_out   = view_1d<Real>("cosp_stage_out",layout.output_size());
+  m_stage_in_h  = Kokkos::create_mirror_view(m_stage_in);
+  m_stage_out_h = Kokkos::create_mirror_view(m_stage_out);
+
   // Set the mask field for each of the cosp computed fields
   std::list<std::string> vnames = {"isccp_cldtot", "isccp_ctptau", "modis_ctptau", "misr_cthtau"};
   for (const auto& field_name : vnames) {
@@ -140,25 +152,8 @@ void Cosp::run_impl (const double dt)
 
   // Call COSP wrapper routines
   if (update_cosp) {
-    // Get fields from field manager; note that we get host views because this
-    // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
-    // all then need to be copied to layoutLeft views to permute the indices for
-    // F90.
-
-    // Ensure host data of input fields is up to date
-    get_field_in("qv").sync_to_host();
-    get_field_in("qc").sync_to_host();
-    get_field_in("qi").sync_to_host();
-    get_field_in("sunlit_mask").sync_to_host();
-    get_field_in("surf_radiative_T").sync_to_host();
-    get_field_in("T_mid").sync_to_host();
-    get_field_in("p_mid").sync_to_host();
-    get_field_in("p_int").sync_to_host();
-    get_field_in("cldfrac_rad").sync_to_host();
-    get_field_in("eff_radius_qc").sync_to_host();
-    get_field_in("eff_radius_qi").sync_to_host();
-    get_field_in("dtau067").sync_to_host();
-    get_field_in("dtau105").sync_to_host();
+    // All inputs are read on device, and packed (together with z_mid) in a single
+    // buffer, already permuted for F90, which is then copied to host in one transfer.
 
     // Compute z_mid
     const auto T_mid_d = get_field_in("T_mid").get_view<const Real**>();
@@ -171,7 +166,6 @@ void Cosp::run_impl (const double dt)
     const auto ncol = m_num_cols;
     const auto nlev = m_num_levs;
 
-    using KT       = KokkosTypes<DefaultDevice>;
     using ExeSpace = typename KT::ExeSpace;
     using TPF      = ekat::TeamPolicyFactory<ExeSpace>;
     using PF       = scream::PhysicsFunctions<DefaultDevice>;
@@ -201,60 +195,137 @@ void Cosp::run_impl (const double dt)
         PF::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
         team.team_barrier();
     });
-    Kokkos::fence();
-
-    m_z_mid.sync_to_host();
-    const auto z_mid_h = m_z_mid.get_view<const Real**,Host>();
-    const auto T_mid_h   = get_field_in("T_mid").get_view<const Real**, Host>();
-    const auto qv_h      = get_field_in("qv").get_view<const Real**, Host>();
-    const auto p_mid_h   = get_field_in("p_mid").get_view<const Real**,Host>();
-    const auto qc_h      = get_field_in("qc").get_view<const Real**, Host>();
-    const auto qi_h      = get_field_in("qi").get_view<const Real**, Host>();
-    const auto sunlit_h  = get_field_in("sunlit_mask").get_view<const Real*, Host>();
-    const auto skt_h     = get_field_in("surf_radiative_T").get_view<const Real*, Host>();
-    const auto p_int_h   = get_field_in("p_int").get_view<const Real**, Host>();
-    const auto cldfrac_h = get_field_in("cldfrac_rad").get_view<const Real**, Host>();
-    const auto reff_qc_h = get_field_in("eff_radius_qc").get_view<const Real**, Host>();
-    const auto reff_qi_h = get_field_in("eff_radius_qi").get_view<const Real**, Host>();
-    const auto dtau067_h = get_field_in("dtau067").get_view<const Real**, Host>();
-    const auto dtau105_h = get_field_in("dtau105").get_view<const Real**, Host>();
-
-    auto isccp_cldtot_h = get_field_out("isccp_cldtot").get_view<Real*, Host>();
-    auto isccp_ctptau_h = get_field_out("isccp_ctptau").get_view<Real***, Host>();
-    auto modis_ctptau_h = get_field_out("modis_ctptau").get_view<Real***, Host>();
-    auto misr_cthtau_h  = get_field_out("misr_cthtau"). get_view<Real***, Host>();
-
-    Real emsfc_lw = 0.99;
-    CospFunc::main(
-            m_num_cols, m_num_subcols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth, emsfc_lw,
-            sunlit_h, skt_h, T_mid_h, p_mid_h, p_int_h, z_mid_h, qv_h, qc_h, qi_h,
-            cldfrac_h, reff_qc_h, reff_qi_h, dtau067_h, dtau105_h,
-            isccp_cldtot_h, isccp_ctptau_h, modis_ctptau_h, misr_cthtau_h
-    );
-    // Mask night values
-    constexpr auto fill_value = constants::fill_value<Real>;
-    for (int i = 0; i < m_num_cols; i++) {
-      if (sunlit_h(i) == 0) {
-        // if night, set to fill val
-        isccp_cldtot_h(i) = fill_value;
-        for (int j = 0; j < m_num_tau; j++) {
-          for (int k = 0; k < m_num_ctp; k++) {
-            isccp_ctptau_h(i,j,k) = fill_value;
-            modis_ctptau_h(i,j,k) = fill_value;
-          }
-          for (int k = 0; k < m_num_cth; k++) {
-            misr_cthtau_h (i,j,k) = fill_value;
-          }
-        }
+
+    const int num_active = stage_inputs();
+    if (num_active>0) {
+      const CospFunc::StagingLayout layout {num_active, m_num_levs, m_num_tau, m_num_ctp, m_num_cth};
+      Real emsfc_lw = 0.99;
+      CospFunc::main(layout, m_num_subcols, emsfc_lw, m_stage_in_h.data(), m_stage_out_h.data());
+
+      const auto out_range = std::make_pair(0,layout.output_size());
+      Kokkos::deep_copy(Kokkos::subview(m_stage_out,out_range),Kokkos::subview(m_stage_out_h,out_range));
+    }
+    unstage_outputs(num_active);
+  }
+}
+
+// =========================================================================================
+int Cosp::stage_inputs ()
+{
+  using L = CospFunc::StagingLayout;
+  using RangePolicy = Kokkos::RangePolicy<KT::ExeSpace>;
+
+  const auto ncol = m_num_cols;
+  const auto nlev = m_num_levs;
+  const auto sunlit_only = m_sunlit_columns_only;
+  const auto sunlit = get_field_in("sunlit_mask").get_view<const Real*>();
+
+  // Select the columns to pass to COSP
+  const auto cols = m_active_cols;
+  const auto slot = m_active_slot;
+  int num_active = 0;
+  Kokkos::parallel_scan("Cosp::select_columns",RangePolicy(0,ncol),
+                        KOKKOS_LAMBDA(const int i, int& offset, const bool final) {
+    const bool active = not sunlit_only or sunlit(i)!=0;
+    if (final) {
+      slot(i) = active ? offset : -1;
+      if (active) {
+        cols(offset) = i;
       }
     }
+    offset += active ? 1 : 0;
+  },num_active);
 
-    // Make sure dev data is up to date
-    get_field_out("isccp_cldtot").sync_to_dev();
-    get_field_out("isccp_ctptau").sync_to_dev();
-    get_field_out("modis_ctptau").sync_to_dev();
-    get_field_out("misr_cthtau").sync_to_dev();
+  if (num_active==0) {
+    return 0;
   }
+
+  // Pack all inputs of the selected columns in Fortran order
+  const L layout {num_active, nlev, m_num_tau, m_num_ctp, m_num_cth};
+  Kokkos::Array<KT::view_2d<const Real>,L::num_input_2d> in2d;
+  in2d[L::T_mid]   = get_field_in("T_mid").get_view<const Real**>();
+  in2d[L::p_mid]   = get_field_in("p_mid").get_view<const Real**>();
+  in2d[L::z_mid]   = m_z_mid.get_view<const Real**>();
+  in2d[L::qv]      = get_field_in("qv").get_view<const Real**>();
+  in2d[L::qc]      = get_field_in("qc").get_view<const Real**>();
+  in2d[L::qi]      = get_field_in("qi").get_view<const Real**>();
+  in2d[L::cldfrac] = get_field_in("cldfrac_rad").get_view<const Real**>();
+  in2d[L::reff_qc] = get_field_in("eff_radius_qc").get_view<const Real**>();
+  in2d[L::reff_qi] = get_field_in("eff_radius_qi").get_view<const Real**>();
+  in2d[L::dtau067] = get_field_in("dtau067").get_view<const Real**>();
+  in2d[L::dtau105] = get_field_in("dtau105").get_view<const Real**>();
+  const auto skt   = get_field_in("surf_radiative_T").get_view<const Real*>();
+  const auto p_int = get_field_in("p_int").get_view<const Real**>();
+  const auto buf   = m_stage_in;
+  Kokkos::parallel_for("Cosp::stage_inputs",RangePolicy(0,num_active*(nlev+1)),
+                       KOKKOS_LAMBDA(const int idx) {
+    // Consecutive indices map to consecutive columns, so writes to buf are contiguous
+    const int i = idx % num_active;
+    const int k = idx / num_active;
+    const int icol = cols(i);
+    if (k==0) {
+      buf(layout.sunlit()+i) = sunlit(icol);
+      buf(layout.skt()+i)    = skt(icol);
+    }
+    if (k<nlev) {
+      for (int n=0; n<L::num_input_2d; ++n) {
+        buf(layout.input_2d(n) + k*num_active + i) = in2d[n](icol,k);
+      }
+    }
+    buf(layout.p_int() + k*num_active + i) = p_int(icol,k);
+  });
+
+  // Copy the used portion of the buffer to host, fencing only the instance doing the copy
+  const auto exec = KT::ExeSpace();
+  const auto in_range = std::make_pair(0,layout.input_size());
+  Kokkos::deep_copy(exec,Kokkos::subview(m_stage_in_h,in_range),Kokkos::subview(m_stage_in,in_range));
+  exec.fence();
+
+  return num_active;
+}
+
+// =========================================================================================
+void Cosp::unstage_outputs (const int num_active)
+{
+  using L = CospFunc::StagingLayout;
+  using RangePolicy = Kokkos::RangePolicy<KT::ExeSpace>;
+  constexpr auto fill_value = constants::fill_value<Real>;
+
+  const L layout {num_active, m_num_levs, m_num_tau, m_num_ctp, m_num_cth};
+  const int ntau = m_num_tau;
+  const int nctp = m_num_ctp;
+  const int ncth = m_num_cth;
+
+  const auto sunlit = get_field_in("sunlit_mask").get_view<const Real*>();
+  const auto slot   = m_active_slot;
+  const auto buf    = m_stage_out;
+
+  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*>();
+  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***>();
+  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***>();
+  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***>();
+
+  // Loop over the largest (col,tau,hgt) range; night or non-selected columns get fill_value
+  const int nk = ncth>nctp ? ncth : nctp;
+  Kokkos::parallel_for("Cosp::unstage_outputs",RangePolicy(0,m_num_cols*ntau*nk),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / (ntau*nk);
+    const int j    = (idx / nk) % ntau;
+    const int k    = idx % nk;
+    const int i    = slot(icol);
+    const bool masked = i<0 or sunlit(icol)==0;
+    const int n = num_active;
+    if (j==0 and k==0) {
+      isccp_cldtot(icol) = masked ? fill_value : buf(layout.isccp_cldtot() + i);
+    }
+    if (k<nctp) {
+      isccp_ctptau(icol,j,k) = masked ? fill_value : buf(layout.isccp_ctptau() + i + j*n + k*n*ntau);
+      modis_ctptau(icol,j,k) = masked ? fill_value : buf(layout.modis_ctptau() + i + j*n + k*n*ntau);
+    }
+    if (k<ncth) {
+      misr_cthtau(icol,j,k)  = masked ? fill_value : buf(layout.misr_cthtau() + i + j*n + k*n*ntau);
+    }
+  });
 }
 
 // =========================================================================================
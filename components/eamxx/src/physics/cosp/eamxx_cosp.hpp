@@ -18,6 +18,10 @@ namespace scream
 
 class Cosp : public AtmosphereProcess
 {
+  using KT = KokkosTypes<DefaultDevice>;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
 
 public:
   // Constructors
@@ -32,6 +36,11 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
+  // Outputs are only recomputed on cosp steps
+  bool computes_fields_every_step () const {
+    return m_cosp_frequency_units=="steps" and m_cosp_frequency==1;
+  }
+
   inline bool cosp_do(const int icosp, const int nstep) {
       // If icosp == 0, then never do cosp;
       // Otherwise, we always call cosp at the first step,
@@ -54,6 +63,14 @@ protected:
 public:
 #endif
   void run_impl        (const double dt);
+
+  // Select the columns to pass to COSP, and pack all their inputs in the staging buffer.
+  // Returns the number of selected columns.
+  int stage_inputs ();
+
+  // Scatter COSP outputs from the staging buffer to the output fields, setting
+  // night (or not selected) columns to fill_value
+  void unstage_outputs (const int num_active);
 protected:
   void finalize_impl   ();
 
@@ -71,9 +88,23 @@ protected:
 
   std::shared_ptr<const AbstractGrid> m_grid;
 
+  // If true, only sunlit columns are passed to COSP
+  bool m_sunlit_columns_only;
+
   // TODO: use atm buffer instead
   Field m_z_mid;
   Field m_z_int;
+
+  // Staging of COSP inputs/outputs: each buffer holds all the arrays exchanged with
+  // the F90 bridge (in Fortran order), so that a single copy moves them across memory spaces.
+  // m_active_cols stores the columns passed to COSP, and m_active_slot the position of
+  // each column in the staged arrays (or -1 if the column is not passed to COSP).
+  view_1d<int>   m_active_cols;
+  view_1d<int>   m_active_slot;
+  view_1d<Real>  m_stage_in;
+  view_1d<Real>  m_stage_out;
+  typename view_1d<Real>::HostMirror m_stage_in_h;
+  typename view_1d<Real>::HostMirror m_stage_out_h;
 }; // class Cosp
 
 } // namespace scream
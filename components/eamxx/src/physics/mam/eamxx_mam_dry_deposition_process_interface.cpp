@@ -3,14 +3,14 @@
 // Drydep functions are stored in the following hpp file
 #include <physics/mam/eamxx_mam_dry_deposition_functions.hpp>
 
-// For reading fractional land use file
-#include <physics/mam/readfiles/fractional_land_use.hpp>
+// For sharing the fractional land use reader with other processes
+#include <physics/mam/readfiles/tracer_data_service.hpp>
 
 #include <ekat_team_policy_utils.hpp>
 
 namespace scream {
 
-using FracLandUseFunc = frac_landuse::fracLandUseFunctions<Real, DefaultDevice>;
+using mam_coupling::TracerDataService;
 
 MAMDryDep::MAMDryDep(const ekat::Comm &comm, const ekat::ParameterList &params)
     : MAMGenericInterface(comm, params) {
@@ -165,9 +165,12 @@ void MAMDryDep::set_grids(
   const std::string dim_name2 = "class";
 
   // initialize the file read
-  FracLandUseFunc::init_frac_landuse_file_read(
-      ncol_, field_name, dim_name1, dim_name2, grid_, frac_landuse_data_file,
-      mapping_file, horizInterp_, dataReader_);  // output
+  frac_landuse_source_ =
+      TracerDataService::instance().get<FracLandUseFunc::fracLandUseSource>(
+          TracerDataService::make_key(grid_, frac_landuse_data_file,
+                                      mapping_file, {field_name}),
+          ncol_, field_name, dim_name1, dim_name2, grid_,
+          frac_landuse_data_file, mapping_file);
 
 }  // set_grids
 
@@ -326,9 +329,7 @@ void MAMDryDep::initialize_impl(const RunType run_type) {
   frac_landuse_fm_ = get_field_out("fraction_landuse").get_view<Real **>();
   // This data is time-independent, we read all data here for the
   // entire simulation
-  FracLandUseFunc::update_frac_land_use_data_from_file(
-      dataReader_, *horizInterp_,
-      frac_landuse_);  // output
+  frac_landuse_ = frac_landuse_source_->load();
 
   // Copy fractional landuse values to a FM array to be used by other processes
   Kokkos::deep_copy(frac_landuse_fm_, frac_landuse_);
@@ -7,8 +7,8 @@
 // For MAM4 aerosol configuration
 #include <physics/mam/mam_coupling.hpp>
 
-// For AtmosphereInput
-#include "share/io/scorpio_input.hpp"
+// For reading fractional land use file
+#include <physics/mam/readfiles/fractional_land_use.hpp>
 
 // For component name
 #include <string>
@@ -91,8 +91,9 @@ class MAMDryDep final : public MAMGenericInterface {
   view_3d qqcw_;
 
   // For reading fractional land use file
-  std::shared_ptr<AbstractRemapper> horizInterp_;
-  std::shared_ptr<AtmosphereInput> dataReader_;
+  using FracLandUseFunc =
+      frac_landuse::fracLandUseFunctions<Real, DefaultDevice>;
+  std::shared_ptr<FracLandUseFunc::fracLandUseSource> frac_landuse_source_;
   const_view_2d frac_landuse_;
   view_2d frac_landuse_fm_;
   // aerosol state variables
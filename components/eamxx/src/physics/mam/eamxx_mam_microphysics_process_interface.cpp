@@ -250,23 +250,9 @@ void MAMMicrophysics::set_grids(
 
     // in format YYYYMMDD
     const int linoz_cyclical_ymd = m_params.get<int>("mam4_linoz_ymd");
-    scream::mam_coupling::setup_tracer_data(linoz_data_, linoz_file_name_,
-                                            linoz_cyclical_ymd);
-    LinozHorizInterp_ = scream::mam_coupling::create_horiz_remapper(
-        grid_, linoz_file_name_, linoz_map_file, var_names, linoz_data_);
-    LinozDataReader_ = scream::mam_coupling::create_tracer_data_reader(
-        LinozHorizInterp_, linoz_file_name_);
-
-    // linoz reader
-    const auto io_grid_linoz = LinozHorizInterp_->get_tgt_grid();
-    const int num_cols_io_linoz =
-        io_grid_linoz->get_num_local_dofs();  // Number of columns on this rank
-    const int num_levs_io_linoz =
-        io_grid_linoz
-            ->get_num_vertical_levels();  // Number of levels per column
-    const int nvars = int(var_names.size());
-    linoz_data_.init(num_cols_io_linoz, num_levs_io_linoz, nvars);
-    linoz_data_.allocate_temporary_views();
+    linoz_source_ = mam_coupling::TracerDataService::instance().get_source(
+        grid_, linoz_file_name_, linoz_map_file, var_names,
+        linoz_cyclical_ymd);
   }  // LINOZ reader
 
   {
@@ -278,21 +264,10 @@ void MAMMicrophysics::set_grids(
 
     // in format YYYYMMDD
     const int oxid_ymd = m_params.get<int>("mam4_oxid_ymd");
-    scream::mam_coupling::setup_tracer_data(tracer_data_, oxid_file_name_,
-                                            oxid_ymd);
-    TracerHorizInterp_ = scream::mam_coupling::create_horiz_remapper(
-        grid_, oxid_file_name_, oxid_map_file, var_names, tracer_data_);
-    TracerDataReader_ = scream::mam_coupling::create_tracer_data_reader(
-        TracerHorizInterp_, oxid_file_name_);
-
-    const int nvars    = int(var_names.size());
-    const auto io_grid = TracerHorizInterp_->get_tgt_grid();
-    const int num_cols_io =
-        io_grid->get_num_local_dofs();  // Number of columns on this rank
-    const int num_levs_io =
-        io_grid->get_num_vertical_levels();  // Number of levels per column
-    tracer_data_.init(num_cols_io, num_levs_io, nvars);
-    tracer_data_.allocate_temporary_views();
+    oxid_source_ = mam_coupling::TracerDataService::instance().get_source(
+        grid_, oxid_file_name_, oxid_map_file, var_names, oxid_ymd);
+
+    const int nvars = int(var_names.size());
 
     for(int ivar = 0; ivar < nvars; ++ivar) {
       cnst_offline_[ivar] = view_2d("cnst_offline_", ncol_, nlev_);
@@ -339,17 +314,10 @@ void MAMMicrophysics::set_grids(
       const auto file_name = elevated_emis_file_name_[var_name];
       const auto var_names = elevated_emis_var_names_[var_name];
 
-      scream::mam_coupling::TracerData data_tracer;
-      scream::mam_coupling::setup_tracer_data(data_tracer, file_name,
-                                              elevated_emiss_cyclical_ymd);
-      auto hor_rem = scream::mam_coupling::create_horiz_remapper(
-          grid_, file_name, extfrc_map_file, var_names, data_tracer);
-
-      auto file_reader = scream::mam_coupling::create_tracer_data_reader(
-          hor_rem, file_name, data_tracer.file_type);
-      ElevatedEmissionsHorizInterp_.push_back(hor_rem);
-      ElevatedEmissionsDataReader_.push_back(file_reader);
-      elevated_emis_data_.push_back(data_tracer);
+      elevated_emis_sources_.push_back(
+          mam_coupling::TracerDataService::instance().get_source(
+              grid_, file_name, extfrc_map_file, var_names,
+              elevated_emiss_cyclical_ymd));
     }  // var_name elevated emissions
     int i               = 0;
     for(const auto &var_name : extfrc_lst_) {
@@ -361,16 +329,8 @@ void MAMMicrophysics::set_grids(
       // I am assuming the order of species in extfrc_lst_.
       // Indexing in mam4xx is fortran.
       forcings_[i].frc_ndx = i + 1;
-      const auto io_grid_emis =
-          ElevatedEmissionsHorizInterp_[i]->get_tgt_grid();
-      const int num_cols_io_emis =
-          io_grid_emis->get_num_local_dofs();  // Number of columns on this rank
-      const int num_levs_io_emis =
-          io_grid_emis
-              ->get_num_vertical_levels();  // Number of levels per column
-      elevated_emis_data_[i].init(num_cols_io_emis, num_levs_io_emis, nvars);
-      elevated_emis_data_[i].allocate_temporary_views();
-      forcings_[i].file_alt_data = elevated_emis_data_[i].has_altitude_;
+      forcings_[i].file_alt_data =
+          elevated_emis_sources_[i]->data().has_altitude_;
       EKAT_REQUIRE_MSG(
         nvars <= int(mam_coupling::MAX_SECTION_NUM_FORCING),
         "Error! Number of sections is bigger than "
@@ -617,17 +577,16 @@ void MAMMicrophysics::initialize_impl(const RunType run_type) {
   // Note: At the first time step, the data will be moved into extfrc_lst_beg,
   //       and extfrc_lst_end will be reloaded from file with the new month.
   const int curr_month = start_of_step_ts().get_month() - 1;  // 0-based
+  // NOTE: sources shared with another process are only loaded once.
   if (config_.linoz.compute) {
-    scream::mam_coupling::update_tracer_data_from_file(
-      LinozDataReader_, curr_month+linoz_data_.offset_time_index_, *LinozHorizInterp_, linoz_data_);
+    linoz_source_->load_initial_slice(
+        curr_month + linoz_source_->data().offset_time_index_);
   }
-  scream::mam_coupling::update_tracer_data_from_file(
-      TracerDataReader_, curr_month+tracer_data_.offset_time_index_, *TracerHorizInterp_, tracer_data_);
+  oxid_source_->load_initial_slice(
+      curr_month + oxid_source_->data().offset_time_index_);
 
-  for(int i = 0; i < static_cast<int>(extfrc_lst_.size()); ++i) {
-    scream::mam_coupling::update_tracer_data_from_file(
-        ElevatedEmissionsDataReader_[i], curr_month,
-        *ElevatedEmissionsHorizInterp_[i], elevated_emis_data_[i]);
+  for(const auto &source : elevated_emis_sources_) {
+    source->load_initial_slice(curr_month);
   }
 
   // //
@@ -779,13 +738,11 @@ void MAMMicrophysics::run_impl(const double dt) {
     config_.linoz.chlorine_loading=chlorine_loading;
   }
 
-  // Update the TracerTimeState to reflect the current time
-  trace_time_state_.t_now = ts.frac_of_year_in_days();
-  scream::mam_coupling::advance_tracer_data(
-      TracerDataReader_,                 // in
-      *TracerHorizInterp_,               // out
-      ts,                                // in
-      trace_time_state_, tracer_data_,   // out
+  // Update the shared sources to the current time (a no-op if another process
+  // already did it for this ts), then interpolate to our levels.
+  oxid_source_->advance(ts);
+  scream::mam_coupling::perform_vertical_interpolation(
+      oxid_source_->data(),              // in
       dry_atm_.p_mid, dry_atm_.z_iface,  // in
       cnst_offline_);                    // out
   Kokkos::fence();
@@ -801,27 +758,20 @@ void MAMMicrophysics::run_impl(const double dt) {
     linoz_output[6] = linoz_dPmL_dO3col;
     linoz_output[7] = linoz_cariolle_pscs;
 
-    scream::mam_coupling::advance_tracer_data(
-      LinozDataReader_,                  // in
-      *LinozHorizInterp_,                // out
-      ts,                                // in
-      linoz_time_state_, linoz_data_,    // out
+    linoz_source_->advance(ts);
+    scream::mam_coupling::perform_vertical_interpolation(
+      linoz_source_->data(),             // in
       dry_atm_.p_mid, dry_atm_.z_iface,  // in
       linoz_output);                     // out
     Kokkos::fence();
   }
 
-  int i                            = 0;
-  for(const auto &var_name : extfrc_lst_) {
-    elevated_emiss_time_state_[i].t_now = ts.frac_of_year_in_days();
-    const auto file_name = elevated_emis_file_name_[var_name];
-    const auto var_names = elevated_emis_var_names_[var_name];
+  for(int i = 0; i < static_cast<int>(elevated_emis_sources_.size()); ++i) {
     auto& elevated_emis_output= forcings_[i].fields;
-    scream::mam_coupling::advance_tracer_data(
-        ElevatedEmissionsDataReader_[i], *ElevatedEmissionsHorizInterp_[i], ts,
-        elevated_emiss_time_state_[i], elevated_emis_data_[i], dry_atm_.p_mid,
+    elevated_emis_sources_[i]->advance(ts);
+    scream::mam_coupling::perform_vertical_interpolation(
+        elevated_emis_sources_[i]->data(), dry_atm_.p_mid,
         dry_atm_.z_iface, elevated_emis_output);
-    i++;
     Kokkos::fence();
   }
 
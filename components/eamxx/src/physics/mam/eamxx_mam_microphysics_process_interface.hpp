@@ -4,7 +4,7 @@
 #include <physics/mam/eamxx_mam_generic_process_interface.hpp>
 #include <physics/mam/mam_coupling.hpp>
 
-#include "readfiles/tracer_reader_utils.hpp"
+#include "readfiles/tracer_data_service.hpp"
 // For calling MAM4 processes
 #include <mam4xx/mam4.hpp>
 #include <string>
@@ -98,34 +98,27 @@ class MAMMicrophysics final : public MAMGenericInterface {
   // surface albedo: shortwave, direct
   const_view_1d d_sfc_alb_dir_vis_;
 
-  mam_coupling::TracerTimeState linoz_time_state_;
   view_2d work_photo_table_;
   std::vector<Real> chlorine_values_;
   std::vector<int> chlorine_time_secs_;
   view_3d photo_rates_;
 
   // invariants members
-  mam_coupling::TracerTimeState trace_time_state_;
-  std::shared_ptr<AtmosphereInput> TracerDataReader_;
-  std::shared_ptr<AbstractRemapper> TracerHorizInterp_;
-  mam_coupling::TracerData tracer_data_;
+  // NOTE: tracer data sources are shared with other processes reading the
+  //       same files (see readfiles/tracer_data_service.hpp)
+  std::shared_ptr<mam_coupling::TracerDataSource> oxid_source_;
   view_3d invariants_;
   std::string oxid_file_name_;
   view_2d cnst_offline_[4];
 
   // linoz reader
-  std::shared_ptr<AtmosphereInput> LinozDataReader_;
-  std::shared_ptr<AbstractRemapper> LinozHorizInterp_;
-  mam_coupling::TracerData linoz_data_;
+  std::shared_ptr<mam_coupling::TracerDataSource> linoz_source_;
   std::string linoz_file_name_;
 
   // Vertical emission uses 9 files, here I am using std::vector to stote
   // instance of each file.
-  mam_coupling::TracerTimeState elevated_emiss_time_state_[mam4::gas_chemistry::extcnt];
-  std::vector<std::shared_ptr<AtmosphereInput>> ElevatedEmissionsDataReader_;
-  std::vector<std::shared_ptr<AbstractRemapper>> ElevatedEmissionsHorizInterp_;
+  std::vector<std::shared_ptr<mam_coupling::TracerDataSource>> elevated_emis_sources_;
   std::vector<std::string> extfrc_lst_;
-  std::vector<mam_coupling::TracerData> elevated_emis_data_;
   std::map<std::string, std::string> elevated_emis_file_name_;
   std::map<std::string, std::vector<std::string>> elevated_emis_var_names_;
   view_3d extfrc_;
@@ -3,16 +3,14 @@
 // For surface and online emission functions
 #include <physics/mam/eamxx_mam_srf_and_online_emissions_functions.hpp>
 
-// For reading soil erodibility file
-#include <physics/mam/readfiles/soil_erodibility.hpp>
+// For sharing the readers with other processes
+#include <physics/mam/readfiles/tracer_data_service.hpp>
 
 #include <ekat_team_policy_utils.hpp>
 
 namespace scream {
 
-// For reading soil erodibility file
-using soilErodibilityFunc =
-    soil_erodibility::soilErodibilityFunctions<Real, DefaultDevice>;
+using mam_coupling::TracerDataService;
 
 // ================================================================
 //  Constructor
@@ -205,12 +203,12 @@ void MAMSrfOnlineEmiss::set_grids(
   //--------------------------------------------------------------------
   // Init data structures to read and interpolate
   //--------------------------------------------------------------------
+  auto &service = TracerDataService::instance();
   for(srf_emiss_ &ispec_srf : srf_emiss_species_) {
-    srfEmissFunc::init_srf_emiss_objects(
-        ncol_, grid_, ispec_srf.data_file, ispec_srf.sectors, srf_map_file,
-        // output
-        ispec_srf.horizInterp_, ispec_srf.data_start_, ispec_srf.data_end_,
-        ispec_srf.data_out_, ispec_srf.dataReader_);
+    ispec_srf.source_ = service.get<srfEmissFunc::srfEmissSource>(
+        TracerDataService::make_key(grid_, ispec_srf.data_file, srf_map_file,
+                                    ispec_srf.sectors),
+        ncol_, grid_, ispec_srf.data_file, ispec_srf.sectors, srf_map_file);
   }  // srf emissions file read init
 
   // -------------------------------------------------------------
@@ -227,10 +225,11 @@ void MAMSrfOnlineEmiss::set_grids(
   const std::string soil_erod_dname = "ncol";
 
   // initialize the file read
-  soilErodibilityFunc::init_soil_erodibility_file_read(
+  serod_source_ = service.get<soilErodibilityFunc::soilErodibilitySource>(
+      TracerDataService::make_key(grid_, soil_erodibility_data_file,
+                                  srf_map_file, {soil_erod_fld_name}),
       ncol_, soil_erod_fld_name, soil_erod_dname, grid_,
-      soil_erodibility_data_file, srf_map_file, serod_horizInterp_,
-      serod_dataReader_);  // output
+      soil_erodibility_data_file, srf_map_file);
 
   // -------------------------------------------------------------
   // Setup to enable reading marine organics file
@@ -247,12 +246,11 @@ void MAMSrfOnlineEmiss::set_grids(
   const std::string marine_org_dname = "ncol";
 
   // initialize the file read
-  marineOrganicsFunc::init_marine_organics_file_read(
+  morg_source_ = service.get<marineOrganicsFunc::marineOrganicsSource>(
+      TracerDataService::make_key(grid_, marine_organics_data_file,
+                                  srf_map_file, marine_org_fld_name),
       ncol_, marine_org_fld_name, marine_org_dname, grid_,
-      marine_organics_data_file, srf_map_file,
-      // output
-      morg_horizInterp_, morg_data_start_, morg_data_end_, morg_data_out_,
-      morg_dataReader_);
+      marine_organics_data_file, srf_map_file);
 
 }  // set_grid ends
 
@@ -327,9 +325,7 @@ void MAMSrfOnlineEmiss::initialize_impl(const RunType run_type) {
   // Update surface emissions from file
   //--------------------------------------------------------------------
   for(srf_emiss_ &ispec_srf : srf_emiss_species_) {
-    srfEmissFunc::update_srfEmiss_data_from_file(
-        ispec_srf.dataReader_, start_of_step_ts(), curr_month, *ispec_srf.horizInterp_,
-        ispec_srf.data_end_);  // output
+    ispec_srf.source_->load_initial_month(start_of_step_ts(), curr_month);
   }
 
   //-----------------------------------------------------------------
@@ -337,17 +333,13 @@ void MAMSrfOnlineEmiss::initialize_impl(const RunType run_type) {
   //-----------------------------------------------------------------
   // This data is time-independent, we read all data here for the
   // entire simulation
-  soilErodibilityFunc::update_soil_erodibility_data_from_file(
-      serod_dataReader_, *serod_horizInterp_,
-      soil_erodibility_);  // output
+  soil_erodibility_ = serod_source_->load();
 
   //--------------------------------------------------------------------
   // Update marine orgaincs from file
   //--------------------------------------------------------------------
   // Time dependent data
-  marineOrganicsFunc::update_marine_organics_data_from_file(
-      morg_dataReader_, start_of_step_ts(), curr_month, *morg_horizInterp_,
-      morg_data_end_);  // output
+  morg_source_->load_initial_month(start_of_step_ts(), curr_month);
 
   //-----------------------------------------------------------------
   // Setup preprocessing and post processing
@@ -383,23 +375,15 @@ void MAMSrfOnlineEmiss::run_impl(const double dt) {
 
   // --- Interpolate marine organics data --
 
-  // Update TimeState, note the addition of dt
-  morg_timeState_.t_now = ts.frac_of_year_in_days();
-
-  // Update time state and if the month has changed, update the data.
-  marineOrganicsFunc::update_marine_organics_timestate(
-      morg_dataReader_, ts, *morg_horizInterp_,
-      // output
-      morg_timeState_, morg_data_start_, morg_data_end_);
-
-  // Call the main marine organics routine to get interpolated forcings.
-  marineOrganicsFunc::marineOrganics_main(morg_timeState_, morg_data_start_,
-                                          morg_data_end_, morg_data_out_);
+  // Update time state and, if the month has changed, the data; then
+  // interpolate the forcings to ts.
+  morg_source_->advance(ts);
 
   // Marine organics emission data read from the file (order is important here)
-  const const_view_1d mpoly = ekat::subview(morg_data_out_.emiss_sectors, 0);
-  const const_view_1d mprot = ekat::subview(morg_data_out_.emiss_sectors, 1);
-  const const_view_1d mlip  = ekat::subview(morg_data_out_.emiss_sectors, 2);
+  const auto &morg_data_out = morg_source_->data_out();
+  const const_view_1d mpoly = ekat::subview(morg_data_out.emiss_sectors, 0);
+  const const_view_1d mprot = ekat::subview(morg_data_out.emiss_sectors, 1);
+  const const_view_1d mlip  = ekat::subview(morg_data_out.emiss_sectors, 2);
 
   // Ocean fraction [unitless]
   const const_view_1d ocnfrac =
@@ -436,18 +420,9 @@ void MAMSrfOnlineEmiss::run_impl(const double dt) {
   //--------------------------------------------------------------------
 
   for(srf_emiss_ &ispec_srf : srf_emiss_species_) {
-    // Update TimeState, note the addition of dt
-    ispec_srf.timeState_.t_now = ts.frac_of_year_in_days();
-
-    // Update time state and if the month has changed, update the data.
-    srfEmissFunc::update_srfEmiss_timestate(
-        ispec_srf.dataReader_, ts, *ispec_srf.horizInterp_,
-        // output
-        ispec_srf.timeState_, ispec_srf.data_start_, ispec_srf.data_end_);
-
-    // Call the main srfEmiss routine to get interpolated aerosol forcings.
-    srfEmissFunc::srfEmiss_main(ispec_srf.timeState_, ispec_srf.data_start_,
-                                ispec_srf.data_end_, ispec_srf.data_out_);
+    // Update time state and, if the month has changed, the data; then
+    // interpolate the aerosol forcings to ts.
+    ispec_srf.source_->advance(ts);
 
     //--------------------------------------------------------------------
     // Modify units to MKS units (from molecules/cm2/s to kg/m2/s)
@@ -460,8 +435,8 @@ void MAMSrfOnlineEmiss::run_impl(const double dt) {
     auto fluxes_in_mks_units = this->fluxes_in_mks_units_;
     const Real mfactor =
         amufac * mam4::gas_chemistry::adv_mass[species_index - offset_];
-    const view_1d ispec_outdata0 =
-        ekat::subview(ispec_srf.data_out_.emiss_sectors, 0);
+    const const_view_1d ispec_outdata0 =
+        ekat::subview(ispec_srf.source_->data_out().emiss_sectors, 0);
     // Parallel loop over all the columns to update units
     Kokkos::parallel_for(
         "srf_emis_fluxes", ncol_, KOKKOS_LAMBDA(int icol) {
@@ -11,6 +11,9 @@
 // For reading marine organics file
 #include <physics/mam/readfiles/marine_organics.hpp>
 
+// For reading soil erodibility file
+#include <physics/mam/readfiles/soil_erodibility.hpp>
+
 // For declaring surface and online emission class derived from atm process
 // class
 #include <physics/mam/eamxx_mam_generic_process_interface.hpp>
@@ -49,16 +52,18 @@ class MAMSrfOnlineEmiss final : public MAMGenericInterface {
   // Unified atomic mass unit used for unit conversion (BAD constant)
   static constexpr Real amufac = 1.65979e-23;  // 1.e4* kg / amu
 
+  // For reading surface emissions, marine organics and soil erodibility files
+  using srfEmissFunc = mam_coupling::srfEmissFunctions<Real, DefaultDevice>;
+  using marineOrganicsFunc =
+      marine_organics::marineOrganicsFunctions<Real, DefaultDevice>;
+  using soilErodibilityFunc =
+      soil_erodibility::soilErodibilityFunctions<Real, DefaultDevice>;
+
   // For reading soil erodibility file
-  std::shared_ptr<AbstractRemapper> serod_horizInterp_;
-  std::shared_ptr<AtmosphereInput> serod_dataReader_;
+  std::shared_ptr<soilErodibilityFunc::soilErodibilitySource> serod_source_;
   const_view_1d soil_erodibility_;
 
  public:
-  // For reading surface emissions and marine organics file
-  using srfEmissFunc = mam_coupling::srfEmissFunctions<Real, DefaultDevice>;
-  using marineOrganicsFunc =
-      marine_organics::marineOrganicsFunctions<Real, DefaultDevice>;
 
   // Constructor
   MAMSrfOnlineEmiss(const ekat::Comm &comm, const ekat::ParameterList &params);
@@ -146,23 +151,16 @@ class MAMSrfOnlineEmiss final : public MAMGenericInterface {
     // Sector names in file
     std::vector<std::string> sectors;
 
-    // Data structure for reading interpolation
-    std::shared_ptr<AbstractRemapper> horizInterp_;
-    std::shared_ptr<AtmosphereInput> dataReader_;
-    srfEmissFunc::srfEmissTimeState timeState_;
-    srfEmissFunc::srfEmissInput data_start_, data_end_;
-    srfEmissFunc::srfEmissOutput data_out_;
+    // Reader and time-interpolated data, shared through the
+    // TracerDataService with other users of the same file
+    std::shared_ptr<srfEmissFunc::srfEmissSource> source_;
   };
 
   // A vector for carrying emissions for all the species
   std::vector<srf_emiss_> srf_emiss_species_;
 
   // For reading marine organics file
-  std::shared_ptr<AbstractRemapper> morg_horizInterp_;
-  std::shared_ptr<AtmosphereInput> morg_dataReader_;
-  marineOrganicsFunc::marineOrganicsTimeState morg_timeState_;
-  marineOrganicsFunc::marineOrganicsInput morg_data_start_, morg_data_end_;
-  marineOrganicsFunc::marineOrganicsOutput morg_data_out_;
+  std::shared_ptr<marineOrganicsFunc::marineOrganicsSource> morg_source_;
 
   // offset for converting pcnst index to gas_pcnst index
   static constexpr int offset_ =
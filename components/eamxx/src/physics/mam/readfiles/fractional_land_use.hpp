@@ -50,6 +50,44 @@ struct fracLandUseFunctions {
       std::shared_ptr<AbstractRemapper> &FracLandUseHorizInterp,
       std::shared_ptr<AtmosphereInput> &FracLandUseDataReader);
 
+  // -------------------------------------------------------------------------------------------
+  // -------------------------------------------------------------------------------------------
+
+  // The (time-independent) fractional land use of one file, read on a given
+  // model grid. Obtain it from the TracerDataService, so that all the callers
+  // requesting the same file and field share it.
+  class fracLandUseSource {
+   public:
+    fracLandUseSource(const int ncol, const std::string &field_name,
+                      const std::string &dim_name1,
+                      const std::string &dim_name2,
+                      const std::shared_ptr<const AbstractGrid> &grid,
+                      const std::string &data_file,
+                      const std::string &mapping_file) {
+      init_frac_landuse_file_read(ncol, field_name, dim_name1, dim_name2, grid,
+                                  data_file, mapping_file, m_horiz_interp,
+                                  m_reader);
+    }
+
+    // Read the data. Only the first call reads anything.
+    const const_view_2d &load() {
+      if(m_num_reads == 0) {
+        update_frac_land_use_data_from_file(m_reader, *m_horiz_interp, m_data);
+        ++m_num_reads;
+      }
+      return m_data;
+    }
+
+    // Number of times the file was read so far
+    int num_reads() const { return m_num_reads; }
+
+   private:
+    std::shared_ptr<AbstractRemapper> m_horiz_interp;
+    std::shared_ptr<AtmosphereInput> m_reader;
+    const_view_2d m_data;
+    int m_num_reads = 0;
+  };  // fracLandUseSource
+
 };  // struct fracLandUseFunctions
 
 }  // namespace frac_landuse
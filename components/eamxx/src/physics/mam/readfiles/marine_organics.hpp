@@ -124,6 +124,65 @@ struct marineOrganicsFunctions {
       marineOrganicsInput &morg_data_end_, marineOrganicsData &morg_data_out_,
       std::shared_ptr<AtmosphereInput> &marineOrganicsDataReader);
 
+  // -------------------------------------------------------------------------------------------
+  // The marine organics data of one file, read on a given model grid. Obtain
+  // it from the TracerDataService, so that all the callers requesting the
+  // same file and fields share it.
+  class marineOrganicsSource {
+   public:
+    marineOrganicsSource(const int ncol,
+                         const std::vector<std::string> &field_names,
+                         const std::string &dim_name,
+                         const std::shared_ptr<const AbstractGrid> &grid,
+                         const std::string &data_file,
+                         const std::string &map_file) {
+      init_marine_organics_file_read(ncol, field_names, dim_name, grid,
+                                     data_file, map_file, m_horiz_interp,
+                                     m_data_start, m_data_end, m_data_out,
+                                     m_reader);
+    }
+
+    // Load the given (zero-based) month into data_end. Only the first call
+    // loads anything.
+    void load_initial_month(const util::TimeStamp &ts, const int month) {
+      if(m_initial_month_loaded) return;
+      update_marine_organics_data_from_file(m_reader, ts, month,
+                                            *m_horiz_interp, m_data_end);
+      ++m_num_reads;
+      m_initial_month_loaded = true;
+    }
+
+    // Update the monthly slices, and interpolate the data to ts. Calls after
+    // the first one with a given ts do nothing.
+    void advance(const util::TimeStamp &ts) {
+      if(m_last_advance.is_valid() && m_last_advance == ts) return;
+      const int month    = m_time_state.current_month;
+      m_time_state.t_now = ts.frac_of_year_in_days();
+      update_marine_organics_timestate(m_reader, ts, *m_horiz_interp,
+                                       m_time_state, m_data_start, m_data_end);
+      if(m_time_state.current_month != month) ++m_num_reads;
+      marineOrganics_main(m_time_state, m_data_start, m_data_end, m_data_out);
+      m_last_advance = ts;
+    }
+
+    // Shared by all users of the source: do not modify it.
+    const marineOrganicsOutput &data_out() const { return m_data_out; }
+
+    // Number of time slices read from file so far
+    int num_reads() const { return m_num_reads; }
+
+   private:
+    std::shared_ptr<AbstractRemapper> m_horiz_interp;
+    std::shared_ptr<AtmosphereInput> m_reader;
+    marineOrganicsTimeState m_time_state;
+    marineOrganicsInput m_data_start, m_data_end;
+    marineOrganicsOutput m_data_out;
+
+    bool m_initial_month_loaded = false;
+    int m_num_reads             = 0;
+    util::TimeStamp m_last_advance;
+  };  // marineOrganicsSource
+
 };  // struct marineOrganicsFunctions
 
 }  // namespace marine_organics
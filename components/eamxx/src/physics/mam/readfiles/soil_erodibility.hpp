@@ -35,6 +35,41 @@ struct soilErodibilityFunctions {
       std::shared_ptr<AbstractRemapper> &SoilErodibilityHorizInterp,
       std::shared_ptr<AtmosphereInput> &SoilErodibilityDataReader);
 
+  // The (time-independent) soil erodibility of one file, read on a given
+  // model grid. Obtain it from the TracerDataService, so that all the callers
+  // requesting the same file share it.
+  class soilErodibilitySource {
+   public:
+    soilErodibilitySource(const int ncol, const std::string &field_name,
+                          const std::string &dim_name,
+                          const std::shared_ptr<const AbstractGrid> &grid,
+                          const std::string &data_file,
+                          const std::string &map_file) {
+      init_soil_erodibility_file_read(ncol, field_name, dim_name, grid,
+                                      data_file, map_file, m_horiz_interp,
+                                      m_reader);
+    }
+
+    // Read the data. Only the first call reads anything.
+    const const_view_1d &load() {
+      if(m_num_reads == 0) {
+        update_soil_erodibility_data_from_file(m_reader, *m_horiz_interp,
+                                               m_data);
+        ++m_num_reads;
+      }
+      return m_data;
+    }
+
+    // Number of times the file was read so far
+    int num_reads() const { return m_num_reads; }
+
+   private:
+    std::shared_ptr<AbstractRemapper> m_horiz_interp;
+    std::shared_ptr<AtmosphereInput> m_reader;
+    const_view_1d m_data;
+    int m_num_reads = 0;
+  };  // soilErodibilitySource
+
 };  // struct soilErodilityFunctions
 
 }  // namespace soil_erodibility
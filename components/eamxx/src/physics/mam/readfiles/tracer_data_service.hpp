@@ -0,0 +1,149 @@
+#ifndef EAMXX_MAM_TRACER_DATA_SERVICE
+#define EAMXX_MAM_TRACER_DATA_SERVICE
+
+#include "tracer_reader_utils.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace scream::mam_coupling {
+
+// A tracer data file, read on a given model grid: its reader, horizontal
+// remapper, time slices, and time-interpolated data.
+// Sources are obtained from the TracerDataService, so that all the MAM
+// processes requesting the same data share a single source.
+class TracerDataSource {
+public:
+  TracerDataSource(const std::shared_ptr<const AbstractGrid> &model_grid,
+                   const std::string &file_name, const std::string &map_file,
+                   const std::vector<std::string> &var_names,
+                   const int cyclical_ymd)
+   : m_file_name(file_name)
+  {
+    setup_tracer_data(m_data, file_name, cyclical_ymd);
+    m_horiz_interp = create_horiz_remapper(model_grid, file_name, map_file,
+                                           var_names, m_data);
+    m_reader = create_tracer_data_reader(m_horiz_interp, file_name,
+                                         m_data.file_type);
+
+    const auto io_grid = m_horiz_interp->get_tgt_grid();
+    m_data.init(io_grid->get_num_local_dofs(),
+                io_grid->get_num_vertical_levels(),
+                static_cast<int>(var_names.size()));
+    m_data.allocate_temporary_views();
+  }
+
+  const std::string &file_name() const { return m_file_name; }
+
+  // The time-interpolated data is in data().data[TracerDataIndex::OUT], and,
+  // for FORMULA_PS files, the source pressure is in data().p_src_.
+  // These views are shared by all users of the source: do not modify them.
+  const TracerData &data() const { return m_data; }
+
+  // Load the time slice with the given (zero-based) index into the END
+  // slot. Only the first call loads anything.
+  void load_initial_slice(const int time_index) {
+    if(m_initial_slice_loaded) return;
+    update_tracer_data_from_file(m_reader, time_index, *m_horiz_interp, m_data);
+    m_initial_slice_loaded = true;
+  }
+
+  // Update the time slices, and interpolate the data to ts. Calls after the
+  // first one with a given ts do nothing, so the work is done once per step
+  // regardless of how many processes use the source.
+  void advance(const util::TimeStamp &ts) {
+    if(m_last_advance.is_valid() && m_last_advance == ts) return;
+    advance_tracer_data_in_time(m_reader, *m_horiz_interp, ts, m_time_state,
+                                m_data);
+    m_last_advance = ts;
+    ++m_num_advances;
+  }
+
+  // Number of times the data was advanced in time so far
+  int num_advances() const { return m_num_advances; }
+
+private:
+  std::string m_file_name;
+
+  TracerData m_data;
+  TracerTimeState m_time_state;
+
+  std::shared_ptr<AbstractRemapper> m_horiz_interp;
+  std::shared_ptr<AtmosphereInput> m_reader;
+
+  bool m_initial_slice_loaded = false;
+  util::TimeStamp m_last_advance;
+  int m_num_advances = 0;
+};
+
+// Process-wide registry of tracer data sources. A source is identified by its
+// type and by a key built from the model grid, file, map file and whatever
+// else determines its content (variables, cyclical date, ...), and is shared
+// by all the callers that request it while at least one of them holds it.
+// NOTE: the service only holds weak pointers, so sources (and their views)
+//       are released together with the last process using them.
+class TracerDataService {
+public:
+  static TracerDataService &instance() {
+    static TracerDataService service;
+    return service;
+  }
+
+  // Build the key of a source from its grid, files and the list of strings
+  // that identify the data read from them
+  static std::string make_key(
+      const std::shared_ptr<const AbstractGrid> &model_grid,
+      const std::string &file_name, const std::string &map_file,
+      const std::vector<std::string> &ids) {
+    std::string key = model_grid->name() + "|" + file_name + "|" + map_file;
+    for(const auto &id : ids) {
+      key += "|" + id;
+    }
+    return key;
+  }
+
+  // Get the source of type SourceT with the given key. If nobody holds it,
+  // it is built as SourceT(args...).
+  template <typename SourceT, typename... Args>
+  std::shared_ptr<SourceT> get(const std::string &key, Args &&...args) {
+    auto &entry = m_sources[typeid(SourceT).name() + ("|" + key)];
+    auto source = std::static_pointer_cast<SourceT>(entry.lock());
+    if(not source) {
+      source = std::make_shared<SourceT>(std::forward<Args>(args)...);
+      entry = source;
+    }
+    return source;
+  }
+
+  std::shared_ptr<TracerDataSource> get_source(
+      const std::shared_ptr<const AbstractGrid> &model_grid,
+      const std::string &file_name, const std::string &map_file,
+      const std::vector<std::string> &var_names, const int cyclical_ymd) {
+    auto ids = var_names;
+    ids.push_back(std::to_string(cyclical_ymd));
+    return get<TracerDataSource>(make_key(model_grid, file_name, map_file, ids),
+                                 model_grid, file_name, map_file, var_names,
+                                 cyclical_ymd);
+  }
+
+  // Number of sources currently in use
+  int num_sources() const {
+    int n = 0;
+    for(const auto &it : m_sources) {
+      if(not it.second.expired()) ++n;
+    }
+    return n;
+  }
+
+private:
+  TracerDataService() = default;
+
+  std::map<std::string, std::weak_ptr<void>> m_sources;
+};
+
+}  // namespace scream::mam_coupling
+#endif  // EAMXX_MAM_TRACER_DATA_SERVICE
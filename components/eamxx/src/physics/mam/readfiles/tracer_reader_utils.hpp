@@ -893,13 +893,15 @@ inline void perform_vertical_interpolation(const const_view_1d &altitude_int,
       });
 }
 
-inline void advance_tracer_data(
-    const std::shared_ptr<AtmosphereInput> &scorpio_reader,   // in
-    AbstractRemapper &tracer_horiz_interp,                    // out
-    const util::TimeStamp &ts,                                // in
-    TracerTimeState &time_state, TracerData &data_tracer,     // out
-    const const_view_2d &p_tgt, const const_view_2d &zi_tgt,  // in
-    const view_2d output[]) {                                 // out
+// Steps 1-2 of advance_tracer_data: update the time slices, interpolate them
+// in time, and (for FORMULA_PS files) compute the source pressure levels.
+// Everything is on the source levels, so the result does not depend on the
+// target column state.
+inline void advance_tracer_data_in_time(
+    const std::shared_ptr<AtmosphereInput> &scorpio_reader,  // in
+    AbstractRemapper &tracer_horiz_interp,                   // out
+    const util::TimeStamp &ts,                               // in
+    TracerTimeState &time_state, TracerData &data_tracer) {  // out
   /* Update the TracerTimeState to reflect the current time, note the addition
    * of dt */
   time_state.t_now = ts.frac_of_year_in_days();
@@ -915,8 +917,14 @@ inline void advance_tracer_data(
     compute_source_pressure_levels(ps, data_tracer.p_src_, data_tracer.hyam,
                                    data_tracer.hybm);
   }
+}  // advance_tracer_data_in_time
 
-  // Step 3. Perform vertical interpolation
+// Step 3 of advance_tracer_data: interpolate the time-interpolated data to
+// the target levels, using pressure or altitude depending on the file type.
+inline void perform_vertical_interpolation(
+    const TracerData &data_tracer,                            // in
+    const const_view_2d &p_tgt, const const_view_2d &zi_tgt,  // in
+    const view_2d output[]) {                                 // out
   if(data_tracer.file_type == FORMULA_PS || data_tracer.file_type == ZONAL) {
     perform_vertical_interpolation(data_tracer.p_src_, p_tgt, data_tracer,
                                    output);
@@ -924,7 +932,20 @@ inline void advance_tracer_data(
     perform_vertical_interpolation(data_tracer.altitude_int_, zi_tgt,
                                    data_tracer, output);
   }
+}
+
+inline void advance_tracer_data(
+    const std::shared_ptr<AtmosphereInput> &scorpio_reader,   // in
+    AbstractRemapper &tracer_horiz_interp,                    // out
+    const util::TimeStamp &ts,                                // in
+    TracerTimeState &time_state, TracerData &data_tracer,     // out
+    const const_view_2d &p_tgt, const const_view_2d &zi_tgt,  // in
+    const view_2d output[]) {                                 // out
+  advance_tracer_data_in_time(scorpio_reader, tracer_horiz_interp, ts,
+                              time_state, data_tracer);
 
+  // Step 3. Perform vertical interpolation
+  perform_vertical_interpolation(data_tracer, p_tgt, zi_tgt, output);
 }  // advance_tracer_data
 
 }  // namespace scream::mam_coupling
@@ -128,6 +128,62 @@ struct srfEmissFunctions {
       srfEmissOutput &SrfEmissData_out,
       std::shared_ptr<AtmosphereInput> &SrfEmissDataReader);
 
+  // The surface emission data of one file, read on a given model grid: its
+  // reader, horizontal remapper, monthly slices and time-interpolated data.
+  // Obtain it from the TracerDataService, so that all the callers requesting
+  // the same file and sectors share it.
+  class srfEmissSource {
+   public:
+    srfEmissSource(const int ncol,
+                   const std::shared_ptr<const AbstractGrid> &grid,
+                   const std::string &data_file,
+                   const std::vector<std::string> &sectors,
+                   const std::string &map_file) {
+      init_srf_emiss_objects(ncol, grid, data_file, sectors, map_file,
+                             m_horiz_interp, m_data_start, m_data_end,
+                             m_data_out, m_reader);
+    }
+
+    // Load the given (zero-based) month into data_end. Only the first call
+    // loads anything.
+    void load_initial_month(const util::TimeStamp &ts, const int month) {
+      if(m_initial_month_loaded) return;
+      update_srfEmiss_data_from_file(m_reader, ts, month, *m_horiz_interp,
+                                     m_data_end);
+      ++m_num_reads;
+      m_initial_month_loaded = true;
+    }
+
+    // Update the monthly slices, and interpolate the data to ts. Calls after
+    // the first one with a given ts do nothing.
+    void advance(const util::TimeStamp &ts) {
+      if(m_last_advance.is_valid() && m_last_advance == ts) return;
+      const int month       = m_time_state.current_month;
+      m_time_state.t_now    = ts.frac_of_year_in_days();
+      update_srfEmiss_timestate(m_reader, ts, *m_horiz_interp, m_time_state,
+                                m_data_start, m_data_end);
+      if(m_time_state.current_month != month) ++m_num_reads;
+      srfEmiss_main(m_time_state, m_data_start, m_data_end, m_data_out);
+      m_last_advance = ts;
+    }
+
+    // Shared by all users of the source: do not modify it.
+    const srfEmissOutput &data_out() const { return m_data_out; }
+
+    // Number of time slices read from file so far
+    int num_reads() const { return m_num_reads; }
+
+   private:
+    std::shared_ptr<AbstractRemapper> m_horiz_interp;
+    std::shared_ptr<AtmosphereInput> m_reader;
+    srfEmissTimeState m_time_state;
+    srfEmissInput m_data_start, m_data_end;
+    srfEmissOutput m_data_out;
+
+    bool m_initial_month_loaded = false;
+    int m_num_reads             = 0;
+    util::TimeStamp m_last_advance;
+  };  // srfEmissSource
 };  // struct srfEmissFunctions
 }  // namespace scream::mam_coupling
 #endif  // SRF_EMISSION_HPP
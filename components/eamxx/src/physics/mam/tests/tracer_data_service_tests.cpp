@@ -0,0 +1,148 @@
+#include <catch2/catch.hpp>
+
+#include "physics/mam/readfiles/tracer_data_service.hpp"
+#include "physics/mam/readfiles/fractional_land_use.hpp"
+
+#include "share/io/eamxx_scorpio_interface.hpp"
+#include "share/grid/point_grid.hpp"
+
+namespace scream {
+
+TEST_CASE("tracer_data_service")
+{
+  using mam_coupling::TracerDataService;
+  using FracLandUseFunc = frac_landuse::fracLandUseFunctions<Real, DefaultDevice>;
+  using Source = FracLandUseFunc::fracLandUseSource;
+
+  constexpr int ncols  = 6;
+  constexpr int nclass = 3;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // We use raw scorpio calls without decomp, so ensure we're in serial case
+  EKAT_REQUIRE_MSG (comm.size()==1,
+      "Error! You should run the tracer_data_service test with ONE rank.\n");
+
+  // The file is on the model grid, so the sources use the identity remapper
+  std::shared_ptr<const AbstractGrid> grid = create_point_grid("pg",ncols,1,comm);
+
+  const std::string fname = "tracer_data_service_frac_landuse.nc";
+  std::vector<Real> data(ncols*nclass);
+  for (int i=0; i<ncols*nclass; ++i) {
+    data[i] = i;
+  }
+  scorpio::register_file(fname,scorpio::Write);
+  scorpio::define_dim(fname,"ncol",ncols);
+  scorpio::define_dim(fname,"class",nclass);
+  for (std::string name : {"fraction_landuse", "fraction_landuse_copy"}) {
+    scorpio::define_var(fname,name,{"ncol","class"},"real");
+  }
+  scorpio::enddef(fname);
+  for (std::string name : {"fraction_landuse", "fraction_landuse_copy"}) {
+    scorpio::write_var(fname,name,data.data());
+  }
+  scorpio::release_file(fname);
+
+  auto& service = TracerDataService::instance();
+  auto get = [&](const std::string& field_name) {
+    return service.get<Source>(
+        TracerDataService::make_key(grid,fname,"",{field_name}),
+        ncols,field_name,"ncol","class",grid,fname,"");
+  };
+
+  // Two requests with the same key share the source, and the file is read once
+  auto s1 = get("fraction_landuse");
+  auto s2 = get("fraction_landuse");
+  REQUIRE (s1==s2);
+  REQUIRE (service.num_sources()==1);
+
+  const auto d1 = s1->load();
+  const auto d2 = s2->load();
+  REQUIRE (s1->num_reads()==1);
+  REQUIRE (d1.data()==d2.data());
+
+  auto d1_h = Kokkos::create_mirror_view(d1);
+  Kokkos::deep_copy(d1_h,d1);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int ic=0; ic<nclass; ++ic) {
+      REQUIRE (d1_h(icol,ic)==data[icol*nclass+ic]);
+    }
+  }
+
+  // A different key gets its own source
+  auto s3 = get("fraction_landuse_copy");
+  REQUIRE (s3!=s1);
+  REQUIRE (service.num_sources()==2);
+
+  // Sources are released with their last user
+  s1 = s2 = s3 = nullptr;
+  REQUIRE (service.num_sources()==0);
+
+  scorpio::finalize_subsystem();
+}
+
+TEST_CASE("tracer_data_source_advance")
+{
+  using namespace mam_coupling;
+
+  constexpr int ncols   = 4;
+  constexpr int nlevs   = 3;
+  constexpr int nmonths = 12;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // We use raw scorpio calls without decomp, so ensure we're in serial case
+  EKAT_REQUIRE_MSG (comm.size()==1,
+      "Error! You should run the tracer_data_service test with ONE rank.\n");
+
+  std::shared_ptr<const AbstractGrid> grid = create_point_grid("pg",ncols,nlevs,comm);
+
+  // A zonal file with one slice per month, so the data is updated monthly
+  const std::string fname = "tracer_data_service_zonal.nc";
+  scorpio::register_file(fname,scorpio::Write);
+  scorpio::define_dim(fname,"ncol",ncols);
+  scorpio::define_dim(fname,"lev",nlevs);
+  scorpio::define_time(fname,"days since 2000-01-01","time");
+  scorpio::define_var(fname,"lev",{"lev"},"real");
+  scorpio::define_var(fname,"date",{},"int",true);
+  scorpio::define_var(fname,"O3",{"ncol","lev"},"real",true);
+  scorpio::enddef(fname);
+  std::vector<Real> levs = {100, 500, 1000};
+  scorpio::write_var(fname,"lev",levs.data());
+  std::vector<Real> o3(ncols*nlevs);
+  for (int m=0; m<nmonths; ++m) {
+    scorpio::update_time(fname,30*m);
+    const int date = 20000000 + 100*(m+1) + 15; // YYYYMMDD, mid-month
+    std::fill(o3.begin(),o3.end(),m);
+    scorpio::write_var(fname,"date",&date);
+    scorpio::write_var(fname,"O3",o3.data());
+  }
+  scorpio::release_file(fname);
+
+  // Two processes requesting the same data get the same source
+  auto& service = TracerDataService::instance();
+  auto s1 = service.get_source(grid,fname,"",{"O3"},20000101);
+  auto s2 = service.get_source(grid,fname,"",{"O3"},20000101);
+  REQUIRE (s1==s2);
+
+  s1->load_initial_slice(s1->data().offset_time_index_);
+  s2->load_initial_slice(s2->data().offset_time_index_);
+
+  // Each timestamp triggers only one advance, no matter how many users advance it
+  util::TimeStamp ts(2000,1,15,0,0,0);
+  for (int step=0; step<3; ++step) {
+    s1->advance(ts);
+    s2->advance(ts);
+    REQUIRE (s1->num_advances()==step+1);
+    ts += 3600;
+  }
+
+  s1 = s2 = nullptr;
+  REQUIRE (service.num_sources()==0);
+
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
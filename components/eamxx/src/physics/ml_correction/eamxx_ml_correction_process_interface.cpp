@@ -8,8 +8,33 @@
 #include <ekat_units.hpp>
 #include <ekat_team_policy_utils.hpp>
 #include <ekat_fpe.hpp>
+#include <ekat_string_utils.hpp>
+
+#include <set>
 
 namespace scream {
+
+namespace {
+
+bool is_none (const std::string& path) {
+  return ekat::upper_case(path)=="NONE";
+}
+
+// Quantities that native models can use as inputs/outputs. Column quantities
+// have one entry per level in the net input/output vectors, the others just one.
+const std::set<std::string> native_col_inputs = {"T_mid", "qv", "U", "V"};
+const std::set<std::string> native_sfc_inputs = {
+  "lat", "lon", "surface_geopotential", "cos_zenith_angle",
+  "surface_diffused_shortwave_albedo",
+  "total_sky_downward_shortwave_flux_at_top_of_atmosphere"};
+// Outputs are either tendencies (state += output*dt) or overrides (flux = output)
+const std::set<std::string> native_col_tendencies = {"dQ1", "dQ2", "dQu", "dQv", "dQxwind", "dQywind"};
+const std::set<std::string> native_sfc_overrides = {
+  "net_shortwave_sfc_flux_via_transmissivity",
+  "override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface"};
+
+}  // anonymous namespace
+
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
                            const ekat::ParameterList &params)
@@ -19,6 +44,11 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ml_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ml_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ml_correction_unit_test");
+  m_inference_backend = m_params.get<std::string>("ml_inference_backend","python");
+  EKAT_REQUIRE_MSG (m_inference_backend=="python" or m_inference_backend=="native",
+      "Error! Invalid value for ml_inference_backend.\n"
+      " - value: " + m_inference_backend + "\n"
+      " - valid values: python, native\n");
 }
 
 // =========================================================================================
@@ -71,22 +101,71 @@ void MLCorrection::set_grids(
   /* ----------------------- WARNING --------------------------------*/
   add_tracer<Updated>("qv", m_grid, kg/kg, ps);
   add_group<Updated>("tracers", grid_name, 1, MonolithicAlloc::Required);
+
+  if (m_inference_backend=="native") {
+    // Load the networks once. For this backend, model paths point to NetCDF
+    // files storing the network weights (see MLDenseNet for the format).
+    bool need_cosz = false;
+    for (const auto& path : {m_ML_model_path_tq, m_ML_model_path_uv, m_ML_model_path_sfc_fluxes}) {
+      if (is_none(path)) {
+        continue;
+      }
+      auto& model = m_native_models.emplace_back();
+      model.net.load(path);
+
+      int n_in = 0;
+      for (const auto& name : model.net.input_names()) {
+        EKAT_REQUIRE_MSG (native_col_inputs.count(name)==1 or native_sfc_inputs.count(name)==1,
+            "Error! Unsupported input for native ML model.\n"
+            " - model file: " + path + "\n"
+            " - input name: " + name + "\n");
+        n_in += native_col_inputs.count(name)==1 ? m_num_levs : 1;
+        need_cosz |= name=="cos_zenith_angle";
+      }
+      int n_out = 0;
+      for (const auto& name : model.net.output_names()) {
+        EKAT_REQUIRE_MSG (native_col_tendencies.count(name)==1 or native_sfc_overrides.count(name)==1,
+            "Error! Unsupported output for native ML model.\n"
+            " - model file : " + path + "\n"
+            " - output name: " + name + "\n");
+        n_out += native_col_tendencies.count(name)==1 ? m_num_levs : 1;
+      }
+      EKAT_REQUIRE_MSG (n_in==model.net.num_inputs() and n_out==model.net.num_outputs(),
+          "Error! Native ML model inputs/outputs sizes do not match the listed variables.\n"
+          " - model file: " + path + "\n"
+          " - num levels: " + std::to_string(m_num_levs) + "\n"
+          " - net inputs : " + std::to_string(model.net.num_inputs()) + " (expected " + std::to_string(n_in) + ")\n"
+          " - net outputs: " + std::to_string(model.net.num_outputs()) + " (expected " + std::to_string(n_out) + ")\n");
+
+      model.inputs  = MLDenseNet::view_2d<Real>("ml_inputs",  m_num_cols, n_in);
+      model.outputs = MLDenseNet::view_2d<Real>("ml_outputs", m_num_cols, n_out);
+    }
+
+    // Unlike the python backend, we don't compute the zenith angle, but use the one from radiation
+    if (need_cosz) {
+      add_field<Required>("cosine_solar_zenith_angle", scalar2d, Units::nondimensional(), grid_name);
+    }
+    m_lat = m_grid->get_geometry_data("lat");
+    m_lon = m_grid->get_geometry_data("lon");
+  }
 }
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_inference_backend=="python") {
+    fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -101,66 +180,17 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
-  // use model time to infer solar zenith angle for the ML prediction
-  auto current_ts = start_of_step_ts();
-  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
-
-  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
-  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();
-
-  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
-  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
-  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
-  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
-  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
-  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
-
   // For precipitation adjustment we need to track the change in column integrated 'qv'
   // So we clone the original qv before ML changes the state so we can back out a qv_tend
   // to use with precip adjustment.
   auto qv_src = get_field_in("qv");
   auto qv_in = qv_src.clone();
 
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
-
-  const auto& tracers = get_group_out("tracers");
-  const auto& tracers_info = tracers.m_info;
-  Int num_tracers = tracers_info->size();
-
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_inference_backend=="native") {
+    run_native_inference(dt);
+  } else {
+    run_python_inference(dt);
   }
-  // for qv, we need to stride across number of tracers
-  pybind11::object ob1     = py_correction.attr("update_fields")(
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, u.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, v.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lat.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lon.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, phis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),
-      m_num_cols, m_num_levs, num_tracers, dt,
-      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
-  pybind11::gil_scoped_release no_gil;
-  ekat::enable_fpes(fpe_mask);
 
   // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
   if (m_ML_model_path_tq != "none") {
@@ -168,6 +198,7 @@ void MLCorrection::run_impl(const double dt) {
     using KT  = KokkosTypes<DefaultDevice>;
     using MT  = typename KT::MemberType;
     using TPF = ekat::TeamPolicyFactory<typename KT::ExeSpace>;
+    const auto &T_mid                = get_field_in("T_mid").get_view<const Real**>();
     const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
     const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
     const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
@@ -230,6 +261,165 @@ void MLCorrection::run_impl(const double dt) {
   }
 }
 
+// =========================================================================================
+void MLCorrection::run_python_inference(const double dt) {
+  // use model time to infer solar zenith angle for the ML prediction
+  auto current_ts = start_of_step_ts();
+  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
+
+  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
+  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();
+
+  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
+  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
+  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
+  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
+  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
+  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
+  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
+
+  auto h_lat  = m_lat.get_view<const Real*,Host>();
+  auto h_lon  = m_lon.get_view<const Real*,Host>();
+
+  const auto& tracers = get_group_out("tracers");
+  const auto& tracers_info = tracers.m_info;
+  Int num_tracers = tracers_info->size();
+
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    pybind11::initialize_interpreter();
+  }
+  // for qv, we need to stride across number of tracers
+  pybind11::object ob1     = py_correction.attr("update_fields")(
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, u.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, v.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lat.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lon.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, phis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),
+      m_num_cols, m_num_levs, num_tracers, dt,
+      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
+  pybind11::gil_scoped_release no_gil;
+  ekat::enable_fpes(fpe_mask);
+}
+
+// =========================================================================================
+void MLCorrection::run_native_inference(const double dt) {
+  // Same order as the python backend: T/q first, then u/v, then surface fluxes,
+  // with each model seeing the state updated by the previous ones
+  for (auto& model : m_native_models) {
+    pack_native_inputs(model);
+    model.net.evaluate(model.inputs, model.outputs);
+    unpack_native_outputs(model, dt);
+  }
+}
+
+// =========================================================================================
+Field MLCorrection::get_native_io_field(const std::string& name) const {
+  if (name=="T_mid" or name=="dQ1") {
+    return get_field_out("T_mid");
+  } else if (name=="qv" or name=="dQ2") {
+    return get_field_out("qv");
+  } else if (name=="U" or name=="dQu" or name=="dQxwind") {
+    return get_field_out("horiz_winds").get_component(0);
+  } else if (name=="V" or name=="dQv" or name=="dQywind") {
+    return get_field_out("horiz_winds").get_component(1);
+  } else if (name=="lat") {
+    return m_lat;
+  } else if (name=="lon") {
+    return m_lon;
+  } else if (name=="surface_geopotential") {
+    return get_field_in("phis");
+  } else if (name=="cos_zenith_angle") {
+    return get_field_in("cosine_solar_zenith_angle");
+  } else if (name=="surface_diffused_shortwave_albedo") {
+    return get_field_in("sfc_alb_dif_vis");
+  } else if (name=="total_sky_downward_shortwave_flux_at_top_of_atmosphere") {
+    return get_field_out("SW_flux_dn").subfield(1,0);
+  } else if (name=="net_shortwave_sfc_flux_via_transmissivity") {
+    return get_field_out("sfc_flux_sw_net");
+  } else if (name=="override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface") {
+    return get_field_out("sfc_flux_lw_dn");
+  }
+  EKAT_ERROR_MSG ("Error! Unsupported native ML model input/output: " + name + "\n");
+}
+
+// =========================================================================================
+void MLCorrection::pack_native_inputs(NativeModel& model) const {
+  using KT = KokkosTypes<DefaultDevice>;
+  using RP = typename KT::RangePolicy;
+  using MDRP = Kokkos::MDRangePolicy<typename KT::ExeSpace,Kokkos::Rank<2>>;
+
+  const int ncols = m_num_cols;
+  const int nlevs = m_num_levs;
+  const auto x = model.inputs;
+  int offset = 0;
+  for (const auto& name : model.net.input_names()) {
+    const auto f = get_native_io_field(name);
+    if (native_col_inputs.count(name)==1) {
+      const auto v = f.get_view<const Real**>();
+      Kokkos::parallel_for("ml_pack_"+name, MDRP({0,0},{ncols,nlevs}),
+                           KOKKOS_LAMBDA(const int icol, const int ilev) {
+        x(icol,offset+ilev) = v(icol,ilev);
+      });
+      offset += nlevs;
+    } else {
+      const auto v = f.get_strided_view<const Real*>();
+      Kokkos::parallel_for("ml_pack_"+name, RP(0,ncols),
+                           KOKKOS_LAMBDA(const int icol) {
+        x(icol,offset) = v(icol);
+      });
+      ++offset;
+    }
+  }
+}
+
+// =========================================================================================
+void MLCorrection::unpack_native_outputs(const NativeModel& model, const double dt) const {
+  using KT = KokkosTypes<DefaultDevice>;
+  using RP = typename KT::RangePolicy;
+  using MDRP = Kokkos::MDRangePolicy<typename KT::ExeSpace,Kokkos::Rank<2>>;
+
+  const int ncols = m_num_cols;
+  const int nlevs = m_num_levs;
+  const auto y = model.outputs;
+  int offset = 0;
+  for (const auto& name : model.net.output_names()) {
+    const auto f = get_native_io_field(name);
+    if (native_col_tendencies.count(name)==1) {
+      const auto v = f.get_view<Real**>();
+      Kokkos::parallel_for("ml_unpack_"+name, MDRP({0,0},{ncols,nlevs}),
+                           KOKKOS_LAMBDA(const int icol, const int ilev) {
+        v(icol,ilev) += y(icol,offset+ilev)*dt;
+      });
+      offset += nlevs;
+    } else {
+      const auto v = f.get_strided_view<Real*>();
+      Kokkos::parallel_for("ml_unpack_"+name, RP(0,ncols),
+                           KOKKOS_LAMBDA(const int icol) {
+        v(icol) = y(icol,offset);
+      });
+      ++offset;
+    }
+  }
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
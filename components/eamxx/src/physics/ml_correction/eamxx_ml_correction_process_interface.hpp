@@ -7,6 +7,7 @@
 #include <array>
 #include <string>
 #include "share/atm_process/atmosphere_process.hpp"
+#include "physics/ml_correction/ml_dense_net.hpp"
 #include <ekat_parameter_list.hpp>
 #include <ekat_lin_interp.hpp>
 #include "share/io/eamxx_output_manager.hpp"
@@ -49,6 +50,26 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+#ifdef KOKKOS_ENABLE_CUDA
+ public:
+#endif
+  // A network evaluated natively (no python), and its inputs/outputs buffers
+  struct NativeModel {
+    MLDenseNet                  net;
+    MLDenseNet::view_2d<Real>   inputs;
+    MLDenseNet::view_2d<Real>   outputs;
+  };
+
+  // Run the ML models via the python interpreter or natively, depending on m_inference_backend
+  void run_python_inference(const double dt);
+  void run_native_inference(const double dt);
+
+  // Helpers for the native backend, to map the net inputs/outputs to/from the fields
+  Field get_native_io_field(const std::string& name) const;
+  void pack_native_inputs(NativeModel& model) const;
+  void unpack_native_outputs(const NativeModel& model, const double dt) const;
+ protected:
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -60,6 +81,9 @@ class MLCorrection : public AtmosphereProcess {
   std::string m_ML_model_path_sfc_fluxes;
   std::vector<std::string> m_fields_ml_output_variables;
   bool m_ML_correction_unit_test;
+  // Either "python" (call the ml_correction python module) or "native" (see MLDenseNet)
+  std::string m_inference_backend;
+  std::vector<NativeModel> m_native_models;
   pybind11::module py_correction;
   pybind11::object ML_model_tq;
   pybind11::object ML_model_uv;
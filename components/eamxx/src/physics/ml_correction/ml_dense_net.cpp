@@ -0,0 +1,232 @@
+#include "ml_dense_net.hpp"
+
+#include "share/io/eamxx_scorpio_interface.hpp"
+
+#include <ekat_assert.hpp>
+#include <ekat_string_utils.hpp>
+#include <ekat_team_policy_utils.hpp>
+
+namespace scream {
+
+namespace {
+
+std::vector<std::string> split_names (const std::string& s)
+{
+  std::vector<std::string> names;
+  for (const auto& n : ekat::split(s,',')) {
+    const auto name = ekat::trim(n);
+    if (name!="") {
+      names.push_back(name);
+    }
+  }
+  return names;
+}
+
+// Read a (non-decomposed) var of given rank from file into a newly allocated device view
+template<typename ViewT>
+ViewT read_var_to_dev (const std::string& filename,
+                       const std::string& varname,
+                       const int rank)
+{
+  const auto& var = scorpio::get_var(filename,varname);
+  EKAT_REQUIRE_MSG (static_cast<int>(var.dims.size())==rank,
+      "Error! Unexpected rank for variable in ML weights file.\n"
+      " - file name: " + filename + "\n"
+      " - var name : " + varname + "\n"
+      " - expected rank: " + std::to_string(rank) + "\n"
+      " - actual rank  : " + std::to_string(var.dims.size()) + "\n");
+
+  const int n0 = var.dims[0]->length;
+  const int n1 = rank==2 ? var.dims[1]->length : 1;
+  std::vector<Real> data(n0*n1);
+  scorpio::read_var(filename,varname,data.data());
+
+  ViewT v;
+  if constexpr (ViewT::rank==1) {
+    v = ViewT(varname,n0);
+  } else {
+    v = ViewT(varname,n0,n1);
+  }
+  auto v_h = Kokkos::create_mirror_view(v);
+  for (int i=0; i<n0; ++i) {
+    if constexpr (ViewT::rank==1) {
+      v_h(i) = data[i];
+    } else {
+      for (int j=0; j<n1; ++j) {
+        v_h(i,j) = data[i*n1+j];
+      }
+    }
+  }
+  Kokkos::deep_copy(v,v_h);
+  return v;
+}
+
+} // anonymous namespace
+
+void MLDenseNet::load (const std::string& filename)
+{
+  m_filename = filename;
+  m_layers.clear();
+
+  scorpio::register_file(filename,scorpio::FileMode::Read);
+
+  const int num_layers = scorpio::get_attribute<int>(filename,"GLOBAL","num_layers");
+  EKAT_REQUIRE_MSG (num_layers>0,
+      "Error! ML weights file must contain at least one layer.\n"
+      " - file name : " + filename + "\n"
+      " - num layers: " + std::to_string(num_layers) + "\n");
+
+  m_input_names  = split_names(scorpio::get_attribute<std::string>(filename,"GLOBAL","input_variables"));
+  m_output_names = split_names(scorpio::get_attribute<std::string>(filename,"GLOBAL","output_variables"));
+
+  m_max_width = 0;
+  for (int k=0; k<num_layers; ++k) {
+    const auto W_name = "W_" + std::to_string(k);
+    const auto b_name = "b_" + std::to_string(k);
+
+    auto& layer = m_layers.emplace_back();
+    layer.W = read_var_to_dev<view_2d<Real>>(filename,W_name,2);
+    layer.b = read_var_to_dev<view_1d<Real>>(filename,b_name,1);
+
+    const auto act = scorpio::get_attribute<std::string>(filename,W_name,"activation");
+    if (act=="relu") {
+      layer.act = Activation::ReLU;
+    } else if (act=="tanh") {
+      layer.act = Activation::Tanh;
+    } else if (act=="linear") {
+      layer.act = Activation::Linear;
+    } else {
+      EKAT_ERROR_MSG ("Error! Unsupported activation in ML weights file.\n"
+          " - file name : " + filename + "\n"
+          " - layer     : " + std::to_string(k) + "\n"
+          " - activation: " + act + "\n"
+          " - supported : relu, tanh, linear\n");
+    }
+
+    const int n_out = layer.W.extent(0);
+    const int n_in  = layer.W.extent(1);
+    EKAT_REQUIRE_MSG (static_cast<int>(layer.b.extent(0))==n_out,
+        "Error! Weights and bias sizes do not match in ML weights file.\n"
+        " - file name: " + filename + "\n"
+        " - layer    : " + std::to_string(k) + "\n");
+    if (k>0) {
+      EKAT_REQUIRE_MSG (n_in==static_cast<int>(m_layers[k-1].W.extent(0)),
+          "Error! Input size of layer does not match output size of previous layer.\n"
+          " - file name: " + filename + "\n"
+          " - layer    : " + std::to_string(k) + "\n");
+    }
+    m_max_width = std::max(m_max_width,std::max(n_in,n_out));
+  }
+
+  m_input_mean   = read_var_to_dev<view_1d<Real>>(filename,"input_mean",1);
+  m_input_scale  = read_var_to_dev<view_1d<Real>>(filename,"input_scale",1);
+  m_output_mean  = read_var_to_dev<view_1d<Real>>(filename,"output_mean",1);
+  m_output_scale = read_var_to_dev<view_1d<Real>>(filename,"output_scale",1);
+
+  scorpio::release_file(filename);
+
+  EKAT_REQUIRE_MSG (static_cast<int>(m_input_mean.extent(0))==num_inputs() and
+                    static_cast<int>(m_input_scale.extent(0))==num_inputs(),
+      "Error! Input normalization sizes do not match the network input size.\n"
+      " - file name: " + filename + "\n");
+  EKAT_REQUIRE_MSG (static_cast<int>(m_output_mean.extent(0))==num_outputs() and
+                    static_cast<int>(m_output_scale.extent(0))==num_outputs(),
+      "Error! Output normalization sizes do not match the network output size.\n"
+      " - file name: " + filename + "\n");
+}
+
+int MLDenseNet::num_inputs () const
+{
+  EKAT_REQUIRE_MSG (is_loaded(), "Error! MLDenseNet was not loaded.\n");
+  return m_layers.front().W.extent(1);
+}
+
+int MLDenseNet::num_outputs () const
+{
+  EKAT_REQUIRE_MSG (is_loaded(), "Error! MLDenseNet was not loaded.\n");
+  return m_layers.back().W.extent(0);
+}
+
+void MLDenseNet::
+apply_layer (const Layer& layer,
+             const view_2d<const Real>& a_in,
+             const view_2d<Real>& a_out,
+             const int nrows) const
+{
+  using TPF = ekat::TeamPolicyFactory<typename KT::ExeSpace>;
+  using MT  = typename KT::MemberType;
+
+  const auto W   = layer.W;
+  const auto b   = layer.b;
+  const auto act = layer.act;
+  const int n_out = W.extent(0);
+  const int n_in  = W.extent(1);
+
+  const auto policy = TPF::get_default_team_policy(nrows,n_out);
+  Kokkos::parallel_for("MLDenseNet::apply_layer",policy,
+                       KOKKOS_LAMBDA(const MT& team) {
+    const int i = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,n_out),
+                         [&](const int o) {
+      Real z = b(o);
+      for (int j=0; j<n_in; ++j) {
+        z += W(o,j)*a_in(i,j);
+      }
+      switch (act) {
+        case Activation::ReLU: z = z>0 ? z : 0;    break;
+        case Activation::Tanh: z = Kokkos::tanh(z); break;
+        default:                                   break;
+      }
+      a_out(i,o) = z;
+    });
+  });
+}
+
+void MLDenseNet::evaluate (const view_2d<const Real>& x, const view_2d<Real>& y) const
+{
+  const int nrows = x.extent(0);
+  const int n_in  = num_inputs();
+  const int n_out = num_outputs();
+  EKAT_REQUIRE_MSG (static_cast<int>(x.extent(1))==n_in,
+      "Error! Wrong number of inputs passed to MLDenseNet::evaluate.\n"
+      " - file name: " + m_filename + "\n"
+      " - expected : " + std::to_string(n_in) + "\n"
+      " - actual   : " + std::to_string(x.extent(1)) + "\n");
+  EKAT_REQUIRE_MSG (static_cast<int>(y.extent(0))==nrows and static_cast<int>(y.extent(1))==n_out,
+      "Error! Wrong output view extents passed to MLDenseNet::evaluate.\n"
+      " - file name: " + m_filename + "\n");
+
+  if (static_cast<int>(m_buf0.extent(0))<nrows) {
+    m_buf0 = view_2d<Real>("MLDenseNet::buf0",nrows,m_max_width);
+    m_buf1 = view_2d<Real>("MLDenseNet::buf1",nrows,m_max_width);
+  }
+
+  using RP = Kokkos::MDRangePolicy<typename KT::ExeSpace,Kokkos::Rank<2>>;
+
+  // Normalize inputs
+  const auto in_mean  = m_input_mean;
+  const auto in_scale = m_input_scale;
+  auto a_in  = m_buf0;
+  auto a_out = m_buf1;
+  Kokkos::parallel_for("MLDenseNet::normalize",RP({0,0},{nrows,n_in}),
+                       KOKKOS_LAMBDA(const int i, const int j) {
+    a_in(i,j) = (x(i,j)-in_mean(j)) / in_scale(j);
+  });
+
+  // Hidden and output layers
+  for (const auto& layer : m_layers) {
+    apply_layer(layer,a_in,a_out,nrows);
+    std::swap(a_in,a_out);
+  }
+
+  // Denormalize outputs (after the last swap, a_in holds the last layer output)
+  const auto out_mean  = m_output_mean;
+  const auto out_scale = m_output_scale;
+  const auto a_last    = a_in;
+  Kokkos::parallel_for("MLDenseNet::denormalize",RP({0,0},{nrows,n_out}),
+                       KOKKOS_LAMBDA(const int i, const int o) {
+    y(i,o) = a_last(i,o)*out_scale(o) + out_mean(o);
+  });
+}
+
+} // namespace scream
@@ -0,0 +1,97 @@
+#ifndef SCREAM_ML_DENSE_NET_HPP
+#define SCREAM_ML_DENSE_NET_HPP
+
+#include "share/core/eamxx_types.hpp"
+
+#include <ekat_kokkos_types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A small inference engine for fully connected (dense) neural networks,
+ * used by MLCorrection when running without the python interpreter.
+ *
+ * The network is loaded once from a NetCDF file, which must contain:
+ *  - the global attributes
+ *      num_layers (int)
+ *      input_variables/output_variables (string): comma-separated names of
+ *        the quantities packed (in that order) in the input/output vectors
+ *  - for each layer k=0,...,num_layers-1, the variables
+ *      W_k(n_out_k,n_in_k) and b_k(n_out_k)
+ *    with W_k having a string attribute "activation" (relu, tanh, or linear)
+ *  - the variables input_mean/input_scale(n_in) and output_mean/output_scale(n_out),
+ *    used to normalize inputs as (x-mean)/scale, and denormalize outputs as y*scale+mean.
+ *
+ * The network is evaluated for all columns at once: each layer is a single
+ * kernel, with one team per column and threads spread over the layer outputs.
+ */
+
+class MLDenseNet {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  enum class Activation : int {
+    Linear,
+    ReLU,
+    Tanh
+  };
+
+  MLDenseNet () = default;
+  MLDenseNet (const std::string& filename) { load(filename); }
+
+  void load (const std::string& filename);
+
+  bool is_loaded () const { return not m_layers.empty(); }
+
+  int num_inputs  () const;
+  int num_outputs () const;
+
+  const std::vector<std::string>& input_names  () const { return m_input_names;  }
+  const std::vector<std::string>& output_names () const { return m_output_names; }
+
+  // Compute y(i,:) = net(x(i,:)) for all rows i of x
+  void evaluate (const view_2d<const Real>& x, const view_2d<Real>& y) const;
+
+#ifndef KOKKOS_ENABLE_CUDA
+private:
+#endif
+  struct Layer {
+    view_2d<Real>  W;
+    view_1d<Real>  b;
+    Activation     act;
+  };
+
+  void apply_layer (const Layer& layer,
+                    const view_2d<const Real>& a_in,
+                    const view_2d<Real>& a_out,
+                    const int nrows) const;
+
+  std::string                 m_filename;
+  std::vector<std::string>    m_input_names;
+  std::vector<std::string>    m_output_names;
+
+  std::vector<Layer>          m_layers;
+  int                         m_max_width = 0;
+
+  view_1d<Real>  m_input_mean;
+  view_1d<Real>  m_input_scale;
+  view_1d<Real>  m_output_mean;
+  view_1d<Real>  m_output_scale;
+
+  // Ping-pong buffers for the hidden layers activations, (re)allocated
+  // if evaluate is called with more rows than they can hold
+  mutable view_2d<Real>  m_buf0;
+  mutable view_2d<Real>  m_buf1;
+};
+
+} // namespace scream
+
+#endif // SCREAM_ML_DENSE_NET_HPP
@@ -3,36 +3,98 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include <ekat_comm.hpp>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <vector>
 
 namespace scream {
 namespace p3 {
 
 namespace {
 
-template <typename S, typename IceT, typename CollT>
-void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, const char* p3_version, IceT& ice_table_vals, CollT& collect_table_vals, int densize, int rimsize, int isize, int rcollsize)
-{
-  using DeviceIcetable = typename IceT::non_const_type;
-  using DeviceColtable = typename CollT::non_const_type;
-
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
-
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
-
-  //
-  // read in ice microphysics table into host views. We always read these as doubles.
-  //
+// Sizes of the ice tables, as stored in the ascii/binary files
+struct IceTablesDims {
+  int densize, rimsize, isize, ice_ncols, rcollsize, coll_ncols;
 
-  std::string filename = std::string(p3_lookup_base) + std::string(p3_version);
+  size_t num_ice  () const { return size_t(densize)*rimsize*isize*ice_ncols; }
+  size_t num_coll () const { return size_t(densize)*rimsize*isize*rcollsize*coll_ncols; }
+  size_t ice_idx  (int jj, int ii, int i, int j) const {
+    return ((size_t(jj)*rimsize + ii)*isize + i)*ice_ncols + j;
+  }
+  size_t coll_idx (int jj, int ii, int i, int j, int k) const {
+    return (((size_t(jj)*rimsize + ii)*isize + i)*rcollsize + j)*coll_ncols + k;
+  }
+};
+
+// The binary version of the ice tables is made of this header, followed by the
+// ice table and by the collection table, stored as doubles. The tables are stored
+// *after* processing the ascii file, so they can be copied as they are.
+// The binary file is generated from the ascii one by p3_init(write_tables=true).
+struct IceTablesBinHeader {
+  char     magic[8];
+  int32_t  format_version;
+  char     p3_version[16];
+  int32_t  dims[6];
+  uint64_t num_ice;
+  uint64_t num_coll;
+  uint64_t checksum;
+};
+
+constexpr char    ice_tables_bin_magic[8] = {'P','3','I','C','E','T','B','L'};
+constexpr int32_t ice_tables_bin_format_version = 1;
+
+inline std::string ice_tables_bin_filename (const std::string& ascii_filename)
+{
+  return ascii_filename + ".bin";
+}
 
-  if (masterproc) {
-    std::cout << "Reading ice lookup tables in file: " << filename << std::endl;
+// FNV-1a hash of the tables bytes
+inline uint64_t ice_tables_checksum (const double* data, const size_t size)
+{
+  const auto bytes = reinterpret_cast<const unsigned char*>(data);
+  uint64_t h = 14695981039346656037ull;
+  for (size_t i=0; i<size*sizeof(double); ++i) {
+    h ^= bytes[i];
+    h *= 1099511628211ull;
   }
+  return h;
+}
 
+inline IceTablesBinHeader make_ice_tables_bin_header (const char* p3_version, const IceTablesDims& d,
+                                                      const double* tables)
+{
+  IceTablesBinHeader header;
+  std::memset(&header,0,sizeof(IceTablesBinHeader));
+  std::memcpy(header.magic,ice_tables_bin_magic,sizeof(header.magic));
+  header.format_version = ice_tables_bin_format_version;
+  std::strncpy(header.p3_version,p3_version,sizeof(header.p3_version)-1);
+  header.dims[0] = d.densize;
+  header.dims[1] = d.rimsize;
+  header.dims[2] = d.isize;
+  header.dims[3] = d.ice_ncols;
+  header.dims[4] = d.rcollsize;
+  header.dims[5] = d.coll_ncols;
+  header.num_ice  = d.num_ice();
+  header.num_coll = d.num_coll();
+  header.checksum = ice_tables_checksum(tables,d.num_ice()+d.num_coll());
+  return header;
+}
+
+// Parse the ascii ice tables into a flat array, storing the ice table first,
+// and the collection table right after it.
+inline void parse_ice_tables_ascii (const std::string& filename, const char* p3_version,
+                                    const IceTablesDims& d, double* tables)
+{
   std::ifstream in(filename);
+  EKAT_REQUIRE_MSG (in.is_open(), "Error! Could not open ice lookup tables file " << filename << "\n");
 
   // read header
   std::string version, version_val;
@@ -40,34 +102,219 @@ void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, c
   EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
   EKAT_REQUIRE_MSG(version_val == p3_version, "Bad " << filename << ", expected version " << p3_version << ", but got " << version_val);
 
+  double* ice  = tables;
+  double* coll = tables + d.num_ice();
+
   // read tables
   double dum_s; int dum_i; // dum_s needs to be double to stream correctly
-  for (int jj = 0; jj < densize; ++jj) {
-    for (int ii = 0; ii < rimsize; ++ii) {
-      for (int i = 0; i < isize; ++i) {
+  for (int jj = 0; jj < d.densize; ++jj) {
+    for (int ii = 0; ii < d.rimsize; ++ii) {
+      for (int i = 0; i < d.isize; ++i) {
         in >> dum_i >> dum_i;
         int j_idx = 0;
         for (int j = 0; j < 15; ++j) {
           in >> dum_s;
           if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+            ice[d.ice_idx(jj, ii, i, j_idx++)] = dum_s;
           }
         }
       }
 
-      for (int i = 0; i < isize; ++i) {
-        for (int j = 0; j < rcollsize; ++j) {
+      for (int i = 0; i < d.isize; ++i) {
+        for (int j = 0; j < d.rcollsize; ++j) {
           in >> dum_i >> dum_i;
           int k_idx = 0;
           for (int k = 0; k < 6; ++k) {
             in >> dum_s;
             if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+              coll[d.coll_idx(jj, ii, i, j, k_idx++)] = std::log10(dum_s);
+            }
+          }
+        }
+      }
+    }
+  }
+  EKAT_REQUIRE_MSG (not in.fail(), "Error! Something went wrong while parsing " << filename << "\n");
+}
+
+// Load the binary ice tables via mmap. Returns false (and the reason) if the file
+// is not there or does not match the expected format/version/sizes/checksum.
+inline bool load_ice_tables_bin (const std::string& filename, const char* p3_version,
+                                 const IceTablesDims& d, double* tables, std::string& reason)
+{
+  reason.clear();
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd<0) {
+    reason = "file not found";
+    return false;
+  }
+
+  struct stat st;
+  const size_t num_tables = d.num_ice() + d.num_coll();
+  const size_t expected_size = sizeof(IceTablesBinHeader) + num_tables*sizeof(double);
+  if (fstat(fd,&st)!=0 or size_t(st.st_size)!=expected_size) {
+    close(fd);
+    reason = "unexpected file size";
+    return false;
+  }
+
+  void* addr = mmap(nullptr, expected_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr==MAP_FAILED) {
+    reason = "mmap failed";
+    return false;
+  }
+
+  IceTablesBinHeader header;
+  std::memcpy(&header,addr,sizeof(IceTablesBinHeader));
+  const auto data = reinterpret_cast<const double*>(static_cast<const char*>(addr) + sizeof(IceTablesBinHeader));
+
+  const auto expected = make_ice_tables_bin_header(p3_version,d,data);
+  if (std::memcmp(header.magic,expected.magic,sizeof(header.magic))!=0 or
+      header.format_version!=expected.format_version) {
+    reason = "bad magic number or format version";
+  } else if (std::strncmp(header.p3_version,expected.p3_version,sizeof(header.p3_version))!=0) {
+    reason = "bad p3 tables version";
+  } else if (std::memcmp(header.dims,expected.dims,sizeof(header.dims))!=0 or
+             header.num_ice!=expected.num_ice or header.num_coll!=expected.num_coll) {
+    reason = "bad tables sizes";
+  } else if (header.checksum!=expected.checksum) {
+    reason = "checksum mismatch";
+  } else {
+    std::memcpy(tables,data,num_tables*sizeof(double));
+  }
+
+  munmap(addr,expected_size);
+  return reason.empty();
+}
+
+inline void write_ice_tables_bin (const std::string& filename, const char* p3_version,
+                                  const IceTablesDims& d, const double* tables)
+{
+  const auto header = make_ice_tables_bin_header(p3_version,d,tables);
+  std::ofstream out(filename, std::ios::binary);
+  EKAT_REQUIRE_MSG (out.is_open(), "Error! Could not open " << filename << " for writing.\n");
+  out.write(reinterpret_cast<const char*>(&header),sizeof(IceTablesBinHeader));
+  out.write(reinterpret_cast<const char*>(tables),(d.num_ice()+d.num_coll())*sizeof(double));
+  EKAT_REQUIRE_MSG (not out.fail(), "Error! Something went wrong while writing " << filename << "\n");
+}
+
+// Fill the flat tables array, from the binary file if possible, from the ascii one otherwise
+inline void fill_ice_tables (const bool masterproc, const std::string& filename, const char* p3_version,
+                             const IceTablesDims& d, double* tables, const bool force_ascii)
+{
+  const auto bin_filename = ice_tables_bin_filename(filename);
+  std::string reason = "ascii tables requested";
+  if (not force_ascii and load_ice_tables_bin(bin_filename,p3_version,d,tables,reason)) {
+    if (masterproc) {
+      std::cout << "Reading ice lookup tables in file: " << bin_filename << std::endl;
+    }
+    return;
+  }
+
+  if (masterproc) {
+    std::cout << "Reading ice lookup tables in file: " << filename
+              << " (binary tables not used: " << reason << ")" << std::endl;
+  }
+  parse_ice_tables_ascii(filename,p3_version,d,tables);
+}
+
+template <typename S, typename IceT, typename CollT>
+void read_ice_lookup_tables(const bool masterproc, const ekat::Comm* comm, const char* p3_lookup_base, const char* p3_version, IceT& ice_table_vals, CollT& collect_table_vals, const bool write_bin)
+{
+  using DeviceIcetable = typename IceT::non_const_type;
+  using DeviceColtable = typename CollT::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  const IceTablesDims d = {int(ice_table_vals_h.extent(0)), int(ice_table_vals_h.extent(1)),
+                           int(ice_table_vals_h.extent(2)), int(ice_table_vals_h.extent(3)),
+                           int(collect_table_vals_h.extent(3)), int(collect_table_vals_h.extent(4))};
+  const size_t num_tables = d.num_ice() + d.num_coll();
+
+  //
+  // read in ice microphysics tables into a flat array. We always read these as doubles.
+  //
+
+  std::string filename = std::string(p3_lookup_base) + std::string(p3_version);
+
+  auto copy_to_host_views = [&](const double* tables) {
+    const double* ice  = tables;
+    const double* coll = tables + d.num_ice();
+    for (int jj = 0; jj < d.densize; ++jj) {
+      for (int ii = 0; ii < d.rimsize; ++ii) {
+        for (int i = 0; i < d.isize; ++i) {
+          for (int j = 0; j < d.ice_ncols; ++j) {
+            ice_table_vals_h(jj, ii, i, j) = ice[d.ice_idx(jj, ii, i, j)];
+          }
+          for (int j = 0; j < d.rcollsize; ++j) {
+            for (int k = 0; k < d.coll_ncols; ++k) {
+              collect_table_vals_h(jj, ii, i, j, k) = coll[d.coll_idx(jj, ii, i, j, k)];
             }
           }
         }
       }
     }
+  };
+
+  if (comm==nullptr or comm->size()==1) {
+    // Every rank reads the file
+    std::vector<double> tables(num_tables);
+    fill_ice_tables(masterproc,filename,p3_version,d,tables.data(),write_bin);
+    if (write_bin and masterproc) {
+      write_ice_tables_bin(ice_tables_bin_filename(filename),p3_version,d,tables.data());
+    }
+    copy_to_host_views(tables.data());
+  } else {
+    // Only one rank per node reads the file, into a node-shared window,
+    // and the other ranks on the node grab the tables from there.
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(comm->mpi_comm(),MPI_COMM_TYPE_SHARED,comm->rank(),MPI_INFO_NULL,&node_comm);
+    int node_rank;
+    MPI_Comm_rank(node_comm,&node_rank);
+
+    const MPI_Aint my_size = node_rank==0 ? num_tables*sizeof(double) : 0;
+    double* tables;
+    MPI_Win win;
+    MPI_Win_allocate_shared(my_size,sizeof(double),MPI_INFO_NULL,node_comm,&tables,&win);
+
+    MPI_Win_fence(0,win);
+    int my_ok = 1;
+    std::string err_msg;
+    if (node_rank==0) {
+      try {
+        fill_ice_tables(masterproc,filename,p3_version,d,tables,write_bin);
+        if (write_bin and masterproc) {
+          write_ice_tables_bin(ice_tables_bin_filename(filename),p3_version,d,tables);
+        }
+      } catch (const std::exception& e) {
+        my_ok = 0;
+        err_msg = e.what();
+      }
+    }
+    MPI_Win_fence(0,win);
+
+    // Make sure all ranks error out if any node reader failed
+    int ok;
+    MPI_Allreduce(&my_ok,&ok,1,MPI_INT,MPI_MIN,comm->mpi_comm());
+    if (ok==1) {
+      MPI_Aint size;
+      int disp_unit;
+      double* node_tables;
+      MPI_Win_shared_query(win,0,&size,&disp_unit,&node_tables);
+      copy_to_host_views(node_tables);
+    }
+
+    MPI_Win_free(&win);
+    MPI_Comm_free(&node_comm);
+
+    EKAT_REQUIRE_MSG (my_ok==1, err_msg);
+    EKAT_REQUIRE_MSG (ok==1,
+        "Error! Reading the ice lookup tables failed on another rank.\n");
   }
 
   // deep copy to device
@@ -312,21 +559,14 @@ void compute_dnu(DnuT& dnu_table_vals)
   dnu_table_vals = DnuT(dnu_table_vals_non_const);
 }
 
-}
-
-/*
- * Implementation of p3 init. Clients should NOT #include
- * this file, #include p3_functions.hpp instead.
- */
-template <typename S, typename D>
-typename Functions<S,D>::P3LookupTables Functions<S,D>
-::p3_init (const bool write_tables, const bool masterproc) {
-  P3LookupTables lookup_tables; // This struct could be our global singleton
+template <typename S, typename P3C, typename LookupTables>
+void init_lookup_tables (LookupTables& lookup_tables, const bool write_tables, const bool masterproc, const ekat::Comm* comm)
+{
   auto version = P3C::p3_version;
   auto p3_lookup_base = P3C::p3_lookup_base;
   static const char* dir = SCREAM_DATA_DIR "/tables";
   // p3_init_a (reads ice_table, collect_table)
-  read_ice_lookup_tables<S>(masterproc, p3_lookup_base, version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize);
+  read_ice_lookup_tables<S>(masterproc, comm, p3_lookup_base, version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, write_tables);
   if (write_tables) {
     //p3_init_b (computes tables mu_r_table, revap_table, vn_table, vm_table)
     compute_tables<S, P3C>(masterproc, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
@@ -337,7 +577,27 @@ typename Functions<S,D>::P3LookupTables Functions<S,D>
   }
   // dnu is always computed/hardcoded
   compute_dnu<S>(lookup_tables.dnu_table_vals);
+}
+
+}
+
+/*
+ * Implementation of p3 init. Clients should NOT #include
+ * this file, #include p3_functions.hpp instead.
+ */
+template <typename S, typename D>
+typename Functions<S,D>::P3LookupTables Functions<S,D>
+::p3_init (const bool write_tables, const bool masterproc) {
+  P3LookupTables lookup_tables; // This struct could be our global singleton
+  init_lookup_tables<S,P3C>(lookup_tables, write_tables, masterproc, nullptr);
+  return lookup_tables;
+}
 
+template <typename S, typename D>
+typename Functions<S,D>::P3LookupTables Functions<S,D>
+::p3_init (const ekat::Comm& comm, const bool write_tables) {
+  P3LookupTables lookup_tables;
+  init_lookup_tables<S,P3C>(lookup_tables, write_tables, comm.am_i_root(), &comm);
   return lookup_tables;
 }
 
@@ -5,6 +5,7 @@
 
 #include "share/core/eamxx_types.hpp"
 
+#include <ekat_comm.hpp>
 #include <ekat_pack_kokkos.hpp>
 #include <ekat_parameter_list.hpp>
 #include <ekat_workspace.hpp>
@@ -402,6 +403,10 @@ template <typename ScalarT, typename DeviceT> struct Functions {
 
   static P3LookupTables p3_init(const bool write_tables = false, const bool masterproc = false);
 
+  // Same as above, but the ice tables are read by one rank per node, and shared with
+  // the other ranks of the node via MPI shared memory.
+  static P3LookupTables p3_init(const ekat::Comm& comm, const bool write_tables = false);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack &mu_r, const Spack &lamr, Table3 &tab,
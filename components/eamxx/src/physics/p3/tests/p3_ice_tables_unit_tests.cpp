@@ -1,14 +1,19 @@
 #include "catch2/catch.hpp"
 
 #include "p3_functions.hpp"
+#include "p3_init_impl.hpp"
 #include "p3_test_data.hpp"
 #include "p3_unit_tests_common.hpp"
 
 #include "share/core/eamxx_types.hpp"
 
+#include <ekat_comm.hpp>
+
 #include <thread>
 #include <array>
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <random>
 
 namespace scream {
@@ -57,6 +62,99 @@ struct UnitWrap::UnitTest<D>::TestTableIce : public UnitWrap::UnitTest<D>::Base
     table = view_device;
   }
 
+  void run_shared_read()
+  {
+    // Reading the ice tables with one rank per node must give the same tables
+    ekat::Comm comm(MPI_COMM_WORLD);
+    const auto tables_ref    = Functions::p3_init();
+    const auto tables_shared = Functions::p3_init(comm);
+
+    const auto ice_ref     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tables_ref.ice_table_vals);
+    const auto ice_shared  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tables_shared.ice_table_vals);
+    const auto coll_ref    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tables_ref.collect_table_vals);
+    const auto coll_shared = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tables_shared.collect_table_vals);
+
+    for (size_t i = 0; i < ice_ref.size(); ++i) {
+      REQUIRE(ice_ref.data()[i] == ice_shared.data()[i]);
+    }
+    for (size_t i = 0; i < coll_ref.size(); ++i) {
+      REQUIRE(coll_ref.data()[i] == coll_shared.data()[i]);
+    }
+  }
+
+  void run_bin_tables()
+  {
+    // The binary ice tables must round trip, be preferred over the ascii ones,
+    // and be discarded in favor of the ascii ones if they do not validate
+    using P3C = typename Functions::P3C;
+    const char* version = P3C::p3_version;
+    const IceTablesDims d = {int(view_ice_table::static_extent(0)), int(view_ice_table::static_extent(1)),
+                             int(view_ice_table::static_extent(2)), int(view_ice_table::static_extent(3)),
+                             int(view_collect_table::static_extent(3)), int(view_collect_table::static_extent(4))};
+    const size_t num_tables = d.num_ice() + d.num_coll();
+
+    // Work on a private copy of the ascii tables, so we can write/corrupt the binary ones
+    ekat::Comm comm(MPI_COMM_WORLD);
+    const std::string filename = "p3_ice_tables_np" + std::to_string(comm.size()) +
+                                 "_rank" + std::to_string(comm.rank()) + ".dat";
+    const auto bin_filename = ice_tables_bin_filename(filename);
+    {
+      std::ifstream src(std::string(P3C::p3_lookup_base) + version);
+      std::ofstream dst(filename);
+      dst << src.rdbuf();
+    }
+    std::remove(bin_filename.c_str());
+
+    std::vector<double> ascii_tables(num_tables), tables(num_tables);
+    parse_ice_tables_ascii(filename,version,d,ascii_tables.data());
+
+    std::string reason;
+    REQUIRE (not load_ice_tables_bin(bin_filename,version,d,tables.data(),reason));
+    REQUIRE (reason=="file not found");
+
+    // Write -> load round trip
+    write_ice_tables_bin(bin_filename,version,d,ascii_tables.data());
+    REQUIRE (load_ice_tables_bin(bin_filename,version,d,tables.data(),reason));
+    REQUIRE (reason.empty());
+    REQUIRE (tables==ascii_tables);
+    REQUIRE (not load_ice_tables_bin(bin_filename,"0.0.0",d,tables.data(),reason));
+    REQUIRE (reason=="bad p3 tables version");
+
+    // When valid, the binary tables are used, unless ascii tables are requested.
+    // Store tables different from the ascii ones, to tell which file was read.
+    auto bin_tables = ascii_tables;
+    for (auto& v : bin_tables) {
+      v += 1;
+    }
+    write_ice_tables_bin(bin_filename,version,d,bin_tables.data());
+    fill_ice_tables(false,filename,version,d,tables.data(),false);
+    REQUIRE (tables==bin_tables);
+    fill_ice_tables(false,filename,version,d,tables.data(),true);
+    REQUIRE (tables==ascii_tables);
+
+    // Flip a byte of the stored tables: the checksum no longer matches, and we must
+    // fall back to the ascii tables
+    {
+      const auto pos = std::streamoff(sizeof(IceTablesBinHeader) + num_tables/2*sizeof(double));
+      std::fstream f(bin_filename, std::ios::in | std::ios::out | std::ios::binary);
+      char c;
+      f.seekg(pos);
+      f.read(&c,1);
+      c ^= 0xff;
+      f.seekp(pos);
+      f.write(&c,1);
+      REQUIRE (not f.fail());
+    }
+    REQUIRE (not load_ice_tables_bin(bin_filename,version,d,tables.data(),reason));
+    REQUIRE (reason=="checksum mismatch");
+    std::fill(tables.begin(),tables.end(),0);
+    fill_ice_tables(false,filename,version,d,tables.data(),false);
+    REQUIRE (tables==ascii_tables);
+
+    std::remove(bin_filename.c_str());
+    std::remove(filename.c_str());
+  }
+
   void run_bfb()
   {
     using KTH = KokkosTypes<HostDevice>;
@@ -335,6 +433,8 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
 
   T t;
   t.run_phys();
+  t.run_shared_read();
+  t.run_bin_tables();
   t.run_bfb();
 }
 
@@ -454,12 +454,19 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for RRTMGPRadiation.");
 } // RRTMGPRadiation::init_buffers
 
-void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
+void RRTMGPRadiation::initialize_impl(const RunType run_type) {
   using PC = scream::physics::Constants<Real>;
 
   // Determine rad timestep, specified as number of atm steps
   m_rad_freq_in_steps = m_params.get<Int>("rad_frequency", 1);
 
+  // Whether to spread the column chunks across the steps of the rad interval
+  m_stagger_col_chunks = m_params.get<bool>("stagger_column_chunks", false);
+
+  // In a restarted run, all chunks were already updated before the restart, and the fluxes
+  // were read from the restart file, so we must resume the staggered schedule right away
+  m_all_chunks_updated = run_type==RunType::Restart;
+
   // Determine orbital year. If orbital_year is negative, use current year
   // from timestamp for orbital year; if positive, use provided orbital year
   // for duration of simulation.
@@ -639,8 +646,18 @@ void RRTMGPRadiation::run_impl (const double dt) {
   const auto do_aerosol_rad = m_do_aerosol_rad;
 
   // Are we going to update fluxes and heating this step?
+  // If chunks are staggered, only the chunks ic with ic%rad_freq equal to the position of
+  // this step within the rad interval are updated (stagger_slot<0 means all chunks)
   auto ts = start_of_step_ts();
-  auto update_rad = scream::rrtmgp::radiation_do(m_rad_freq_in_steps, ts.get_num_steps());
+  const int rad_freq = m_rad_freq_in_steps;
+  int stagger_slot = -1;
+  bool update_rad;
+  if (m_stagger_col_chunks and rad_freq>1 and m_all_chunks_updated) {
+    stagger_slot = ts.get_num_steps() % rad_freq;
+    update_rad = stagger_slot < m_num_col_chunks;
+  } else {
+    update_rad = scream::rrtmgp::radiation_do(rad_freq, ts.get_num_steps());
+  }
 
   if (update_rad) {
     // On each chunk, we internally "reset" the GasConcs object to subview the concs 3d array
@@ -729,6 +746,9 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
     // Loop over each chunk of columns
     for (int ic=0; ic<m_num_col_chunks; ++ic) {
+      if (stagger_slot>=0 and ic%rad_freq!=stagger_slot) {
+        continue;
+      }
       const int beg  = m_col_chunk_beg[ic];
       const int ncol = m_col_chunk_beg[ic+1] - beg;
       this->log(LogLevel::debug,
@@ -1166,19 +1186,26 @@ void RRTMGPRadiation::run_impl (const double dt) {
     // Restore the refCounted array.
     m_gas_concs_k.concs = gas_concs_k;
     m_gas_concs_k.ncol = orig_ncol_k;
+
+    if (stagger_slot<0) {
+      m_all_chunks_updated = true;
+    }
   } // update_rad
 
   // Apply temperature tendency; if we updated radiation this timestep, then d_rad_heating_pdel should
   // contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
   // radiative heating, then we need to back out the heating from the rad_heating*pdel term that we carry
-  // across timesteps to conserve energy.
+  // across timesteps to conserve energy. With staggered chunks, this is decided column by column.
   const int ncols = m_ncol;
   const int nlays = m_nlay;
+  const int col_chunk_size = m_col_chunk_size;
   const auto policy = TPF::get_default_team_policy(ncols, nlays);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const int i = team.league_rank();
+    const bool col_updated = update_rad and
+                             (stagger_slot<0 or (i/col_chunk_size)%rad_freq==stagger_slot);
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlays), [&] (const int& k) {
-      if (update_rad) {
+      if (col_updated) {
         d_tmid(i,k) = d_tmid(i,k) + d_rad_heating_pdel(i,k) * dt;
         d_rad_heating_pdel(i,k) = d_pdel(i,k) * d_rad_heating_pdel(i,k);
       } else {
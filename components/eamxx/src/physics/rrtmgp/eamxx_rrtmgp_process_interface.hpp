@@ -62,6 +62,11 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grid_manager);
 
+  // Fluxes are only recomputed on radiation steps, and read by other procs at every step
+  bool computes_fields_every_step () const {
+    return not m_params.isParameter("rad_frequency") or m_params.get<Int>("rad_frequency")==1;
+  }
+
 // NOTE: cannot use lambda functions for CUDA devices if these are protected!
 public:
   // The three main interfaces for the subcomponent
@@ -129,6 +134,12 @@ public:
   // Rad frequency in number of steps
   int m_rad_freq_in_steps;
 
+  // If true, the column chunks are updated round-robin across the steps of the rad
+  // interval, rather than all at once every m_rad_freq_in_steps steps. All chunks
+  // are still updated together the first time radiation is called in an initial run.
+  bool m_stagger_col_chunks;
+  bool m_all_chunks_updated = false;
+
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
@@ -5,8 +5,10 @@
 
 #include "eamxx_zm_process_interface.hpp"
 #include "physics/share/physics_constants.hpp"
+#include "share/physics/eamxx_common_physics_functions.hpp"
 
 #include <ekat_assert.hpp>
+#include <ekat_team_policy_utils.hpp>
 
 namespace scream
 {
@@ -21,6 +23,17 @@ ZMDeepConvection::ZMDeepConvection (const ekat::Comm& comm, const ekat::Paramete
  : AtmosphereProcess(comm,params)
 {
   // params holds all runtime options - what do we need for ZM?
+
+  // Max number of columns passed to each call of the F90 scheme, and number of
+  // chunks used to pipeline host-device transfers with the F90 computation
+  m_pcols      = m_params.get<int>("pcols",16);
+  m_num_chunks = m_params.get<int>("num_pipeline_chunks",4);
+  EKAT_REQUIRE_MSG (m_pcols>0,
+      "Error! Invalid value for ZM parameter 'pcols'.\n"
+      " - pcols: " + std::to_string(m_pcols) + "\n");
+  EKAT_REQUIRE_MSG (m_num_chunks>0,
+      "Error! Invalid value for ZM parameter 'num_pipeline_chunks'.\n"
+      " - num_pipeline_chunks: " + std::to_string(m_num_chunks) + "\n");
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -56,6 +69,8 @@ set_grids (const std::shared_ptr<const GridsManager> grids_manager)
   add_field<Required>("pseudo_density", scalar3d_mid, Pa,    grid_name, ps);
   add_field<Required>("phis",           scalar2d    , m2/s2, grid_name, ps);
   add_field<Required>("omega",          scalar3d_mid, Pa/s,  grid_name, ps);
+  add_field<Required>("pbl_height",     scalar2d    , m,     grid_name);
+  add_field<Required>("landfrac",       scalar2d    , nondim,grid_name);
 
   // Input/Output variables
   add_field <Updated> ("T_mid",         scalar3d_mid, K,     grid_name, ps);
@@ -63,36 +78,241 @@ set_grids (const std::shared_ptr<const GridsManager> grids_manager)
   add_tracer<Updated>("qv",             m_grid,       kg/kg,            ps);
   add_tracer<Updated>("qc",             m_grid,       kg/kg,            ps);
 
-  // // Output variables
-  // add_field<Computed>("???", scalar2d    , ???, grid_name);
-  // add_field<Computed>("???", scalar3d_mid, ???, grid_name, ps);
-  
+  // The water removed from qv by ZM is detrained as cloud liquid (into qc, above),
+  // or precipitated to the surface
+  add_field<Updated>("precip_liq_surf_mass", scalar2d, kg/m2, grid_name, "ACCUMULATED");
+
 }
 
 /*------------------------------------------------------------------------------------------------*/
 void ZMDeepConvection::initialize_impl (const RunType /* run_type */)
 {
-  // placeholder for initialization
+  using BL = zm::BridgeBlockLayout;
+
+  zm_eamxx_bridge_init(m_pcols, m_nlevs, MPI_Comm_c2f(m_comm.mpi_comm()));
+
+  m_z_mid = view_2d_real("z_mid",m_ncols,m_nlevs);
+  m_z_int = view_2d_real("z_int",m_ncols,m_nlevs+1);
+
+  // Chunks are made of whole blocks, so round the chunk size up to a multiple of pcols
+  const int nblocks = (m_ncols + m_pcols - 1) / m_pcols;
+  const int blocks_per_chunk = std::max((nblocks + m_num_chunks - 1) / m_num_chunks,1);
+  m_cols_per_chunk = blocks_per_chunk*m_pcols;
+  m_num_chunks = (m_ncols + m_cols_per_chunk - 1) / m_cols_per_chunk;
+
+  const BL layout {m_pcols, m_nlevs};
+  for (int s=0; s<2; ++s) {
+    m_buf_in[s]  = view_1d_real("zm_buf_in", blocks_per_chunk*layout.input_size());
+    m_buf_out[s] = view_1d_real("zm_buf_out",blocks_per_chunk*layout.output_size());
+#ifdef EAMXX_ENABLE_GPU
+    m_buf_in_h[s]  = pinned_view_1d_real("zm_buf_in_h", m_buf_in[s].size());
+    m_buf_out_h[s] = pinned_view_1d_real("zm_buf_out_h",m_buf_out[s].size());
+#else
+    // Device memory is host memory: alias the buffers, so that deep copies are no-ops
+    m_buf_in_h[s]  = pinned_view_1d_real(m_buf_in[s].data(), m_buf_in[s].size());
+    m_buf_out_h[s] = pinned_view_1d_real(m_buf_out[s].data(),m_buf_out[s].size());
+#endif
+  }
+
+#ifdef EAMXX_ENABLE_GPU
+  // Separate instances, so that transfers in both directions can overlap
+  auto instances = Kokkos::Experimental::partition_space(ExeSpace(),1,1);
+  m_exec_in  = instances[0];
+  m_exec_out = instances[1];
+#else
+  m_exec_in  = ExeSpace();
+  m_exec_out = ExeSpace();
+#endif
 }
 
 /*------------------------------------------------------------------------------------------------*/
 void ZMDeepConvection::run_impl (const double dt)
 {
+  compute_heights();
+
+  // The pipeline instances must see the up-to-date state and heights
+  Kokkos::fence();
+
+  stage_inputs(0,0);
+  for (int c=0; c<m_num_chunks; ++c) {
+    const int s = c % 2;
+
+    // Inputs of chunk c are on host. Start staging chunk c+1 in the other slot,
+    // which is free since chunk c-1 was already computed.
+    m_exec_in.fence();
+    if (c+1<m_num_chunks) {
+      stage_inputs(c+1,1-s);
+    }
+
+    // While the F90 scheme runs on chunk c, outputs of chunk c-1 are copied/applied on device
+    run_bridge(c,s,dt);
+
+    // Outputs of chunk c-1 are done, so the instance can be reused for chunk c
+    m_exec_out.fence();
+    unstage_outputs(c,s,dt);
+  }
+  m_exec_out.fence();
+
+  m_is_first_step = false;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+void ZMDeepConvection::compute_heights ()
+{
+  using TPF = ekat::TeamPolicyFactory<ExeSpace>;
+  using PF  = scream::PhysicsFunctions<DefaultDevice>;
+
+  const auto T_mid = get_field_out("T_mid").get_view<const Real**>();
+  const auto qv    = get_field_out("qv").get_view<const Real**>();
+  const auto p_mid = get_field_in("p_mid").get_view<const Real**>();
+  const auto pdel  = get_field_in("pseudo_density").get_view<const Real**>();
+  const auto phis  = get_field_in("phis").get_view<const Real*>();
+  const auto z_mid = m_z_mid;
+  const auto z_int = m_z_int;
+  const int  nlev  = m_nlevs;
+  const auto g     = physics::Constants<Real>::gravit;
+
+  const auto policy = TPF::get_thread_range_parallel_scan_team_policy(m_ncols,nlev);
+  Kokkos::parallel_for("ZM::compute_heights",policy,
+                       KOKKOS_LAMBDA (const KT::MemberType& team) {
+    const int i = team.league_rank();
+    const auto z_mid_s = ekat::subview(z_mid,i);
+    const auto z_int_s = ekat::subview(z_int,i);
+
+    // Recycle z_mid as temporary for dz
+    PF::calculate_dz(team,ekat::subview(pdel,i),ekat::subview(p_mid,i),
+                     ekat::subview(T_mid,i),ekat::subview(qv,i),z_mid_s);
+    team.team_barrier();
+    PF::calculate_z_int(team,nlev,z_mid_s,phis(i)/g,z_int_s);
+    team.team_barrier();
+    PF::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
+  });
+}
+
+/*------------------------------------------------------------------------------------------------*/
+void ZMDeepConvection::stage_inputs (const int ichunk, const int islot)
+{
+  using BL = zm::BridgeBlockLayout;
+  using RP = Kokkos::RangePolicy<ExeSpace>;
+
+  const BL layout {m_pcols, m_nlevs};
+  const int pcols   = m_pcols;
+  const int nlev    = m_nlevs;
+  const int col_beg = ichunk*m_cols_per_chunk;
+  const int ncols   = std::min(m_cols_per_chunk,m_ncols-col_beg);
+  const int nblocks = (ncols + pcols - 1) / pcols;
+
+  Kokkos::Array<KT::view_2d<const Real>,BL::num_input_mid> in_mid;
+  in_mid[BL::T_mid]          = get_field_out("T_mid").get_view<const Real**>();
+  in_mid[BL::qv]             = get_field_out("qv").get_view<const Real**>();
+  in_mid[BL::omega]          = get_field_in("omega").get_view<const Real**>();
+  in_mid[BL::p_mid]          = get_field_in("p_mid").get_view<const Real**>();
+  in_mid[BL::pseudo_density] = get_field_in("pseudo_density").get_view<const Real**>();
+  in_mid[BL::z_mid]          = m_z_mid;
+  Kokkos::Array<KT::view_2d<const Real>,BL::num_input_int> in_int;
+  in_int[BL::p_int] = get_field_in("p_int").get_view<const Real**>();
+  in_int[BL::z_int] = m_z_int;
+  Kokkos::Array<KT::view_1d<const Real>,BL::num_input_col> in_col;
+  in_col[BL::phis]     = get_field_in("phis").get_view<const Real*>();
+  in_col[BL::pblh]     = get_field_in("pbl_height").get_view<const Real*>();
+  in_col[BL::landfrac] = get_field_in("landfrac").get_view<const Real*>();
+  const auto buf  = m_buf_in[islot];
+
+  // Consecutive indices map to consecutive columns, so writes to buf are contiguous
+  Kokkos::parallel_for("ZM::stage_inputs",RP(m_exec_in,0,ncols*(nlev+1)),
+                       KOKKOS_LAMBDA (const int idx) {
+    const int i   = idx % ncols;
+    const int k   = idx / ncols;
+    const int col = col_beg + i;
+    const int offset = (i/pcols)*layout.input_size() + i%pcols;
+    if (k<nlev) {
+      for (int n=0; n<BL::num_input_mid; ++n) {
+        buf(offset + layout.input_mid(n) + k*pcols) = in_mid[n](col,k);
+      }
+    } else {
+      for (int n=0; n<BL::num_input_col; ++n) {
+        buf(offset + layout.input_col(n)) = in_col[n](col);
+      }
+    }
+    for (int n=0; n<BL::num_input_int; ++n) {
+      buf(offset + layout.input_int(n) + k*pcols) = in_int[n](col,k);
+    }
+  });
+
+  const auto range = std::make_pair(0,nblocks*layout.input_size());
+  Kokkos::deep_copy(m_exec_in,Kokkos::subview(m_buf_in_h[islot],range),Kokkos::subview(buf,range));
+}
+
+/*------------------------------------------------------------------------------------------------*/
+void ZMDeepConvection::run_bridge (const int ichunk, const int islot, const double dt)
+{
+  using BL = zm::BridgeBlockLayout;
+
+  const BL layout {m_pcols, m_nlevs};
+  const int col_beg = ichunk*m_cols_per_chunk;
+  const int ncols   = std::min(m_cols_per_chunk,m_ncols-col_beg);
+  const int nblocks = (ncols + m_pcols - 1) / m_pcols;
+  const Real* in = m_buf_in_h[islot].data();
+  Real* out      = m_buf_out_h[islot].data();
+  const bool is_first_step = m_is_first_step;
+
+  // NOTE: the F90 scheme relies on module (and implicitly saved) variables, so it
+  //       is not safe to call it concurrently: blocks are run one after the other.
+  for (int b=0; b<nblocks; ++b) {
+    const Real* bin = in  + b*layout.input_size();
+    Real* bout      = out + b*layout.output_size();
+    const int ncol  = std::min(m_pcols,ncols-b*m_pcols);
+    zm_eamxx_bridge_run(ncol, dt, is_first_step,
+                        bin + layout.input_mid(BL::T_mid), bin + layout.input_mid(BL::qv),
+                        bin + layout.input_mid(BL::omega),
+                        bin + layout.input_mid(BL::p_mid), bin + layout.input_int(BL::p_int),
+                        bin + layout.input_mid(BL::pseudo_density), bin + layout.input_col(BL::phis),
+                        bin + layout.input_mid(BL::z_mid), bin + layout.input_int(BL::z_int),
+                        bin + layout.input_col(BL::pblh), bin + layout.input_col(BL::landfrac),
+                        bout + layout.output_mid(BL::tend_s), bout + layout.output_mid(BL::tend_q),
+                        bout + layout.output_mid(BL::detrain_ql), bout + layout.output_col(BL::prec));
+  }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+void ZMDeepConvection::unstage_outputs (const int ichunk, const int islot, const double dt)
+{
+  using BL = zm::BridgeBlockLayout;
+  using RP = Kokkos::RangePolicy<ExeSpace>;
+
+  const BL layout {m_pcols, m_nlevs};
+  const int pcols   = m_pcols;
+  const int nlev    = m_nlevs;
+  const int col_beg = ichunk*m_cols_per_chunk;
+  const int ncols   = std::min(m_cols_per_chunk,m_ncols-col_beg);
+  const int nblocks = (ncols + pcols - 1) / pcols;
+  const auto buf    = m_buf_out[islot];
+
+  const auto range = std::make_pair(0,nblocks*layout.output_size());
+  Kokkos::deep_copy(m_exec_out,Kokkos::subview(buf,range),Kokkos::subview(m_buf_out_h[islot],range));
 
-  // get fields
-  const auto& T_mid    = get_field_out("T_mid").get_view<Spack**>();
-  const auto& p_mid    = get_field_in("p_mid").get_view<const Spack**>();
-  const auto& p_int    = get_field_in("p_int").get_view<const Spack**>();
-  const auto& rho      = get_field_in("pseudo_density").get_view<const Spack**>();
-  const auto& omega    = get_field_in("omega").get_view<const Spack**>();
-  const auto& qc       = get_field_out("qc").get_view<Spack**>();
-  const auto& qv       = get_field_out("qv").get_view<Spack**>();
-  const auto& phis     = get_field_in("phis").get_view<const Real*>();
-  
-  // Run ZM
-  
-  // Update output fields
-  
+  // Apply tendencies (tend_s is a dry static energy tendency). The water removed
+  // from qv goes either to qc (detrained cloud water) or to the surface (prec, in m/s)
+  const auto T_mid = get_field_out("T_mid").get_view<Real**>();
+  const auto qv    = get_field_out("qv").get_view<Real**>();
+  const auto qc    = get_field_out("qc").get_view<Real**>();
+  const auto precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real*>();
+  const Real cpair   = physics::Constants<Real>::Cpair;
+  const Real rho_h2o = physics::Constants<Real>::RHO_H2O;
+  Kokkos::parallel_for("ZM::unstage_outputs",RP(m_exec_out,0,ncols*nlev),
+                       KOKKOS_LAMBDA (const int idx) {
+    const int i   = idx % ncols;
+    const int k   = idx / ncols;
+    const int col = col_beg + i;
+    const int block  = (i/pcols)*layout.output_size();
+    const int offset = block + k*pcols + i%pcols;
+    T_mid(col,k) += buf(offset + layout.output_mid(BL::tend_s))/cpair*dt;
+    qv(col,k)    += buf(offset + layout.output_mid(BL::tend_q))*dt;
+    qc(col,k)    += buf(offset + layout.output_mid(BL::detrain_ql))*dt;
+    if (k==0) {
+      precip_liq_surf_mass(col) += buf(block + layout.output_col(BL::prec) + i%pcols)*rho_h2o*dt;
+    }
+  });
 }
 
 /*------------------------------------------------------------------------------------------------*/
@@ -3,6 +3,7 @@
 
 #include "share/atm_process/atmosphere_process.hpp"
 #include "physics/zm/zm_functions.hpp"
+#include "physics/zm/zm_eamxx_bridge.hpp"
 
 #include <ekat_parameter_list.hpp>
 
@@ -28,6 +29,11 @@ class ZMDeepConvection : public AtmosphereProcess
   using view_3d_const        = typename ZMF::view_3d<const Spack>;
   using view_3d_strided      = typename ZMF::view_3d_strided<Spack>;
 
+  using ExeSpace             = typename KT::ExeSpace;
+  using view_1d_real         = typename KT::template view_1d<Real>;
+  using view_2d_real         = typename KT::template view_2d<Real>;
+  using pinned_view_1d_real  = Kokkos::View<Real*,Kokkos::SharedHostPinnedSpace>;
+
   public:
 
     // Constructors
@@ -44,14 +50,52 @@ class ZMDeepConvection : public AtmosphereProcess
 
   protected:
     void initialize_impl (const RunType run_type) override;
+#ifdef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+  public:
+#endif
     void run_impl        (const double dt) override;
+
+    // Compute z_mid/z_int, needed by the F90 scheme
+    void compute_heights ();
+
+    // Pipeline stages for chunk ichunk, using staging buffers in slot islot:
+    //  - stage_inputs: pack chunk inputs on device, and start their copy to host
+    //  - run_bridge: run the F90 scheme on all blocks of the chunk (one after the other, since
+    //    the F90 scheme is not thread safe)
+    //  - unstage_outputs: start the copy of the chunk outputs to device, and apply them to the state
+    void stage_inputs    (const int ichunk, const int islot);
+    void run_bridge      (const int ichunk, const int islot, const double dt);
+    void unstage_outputs (const int ichunk, const int islot, const double dt);
+  protected:
     void finalize_impl   () override;
 
     // define ZM process variables
     std::shared_ptr<const AbstractGrid> m_grid;
     int m_ncols;
     int m_nlevs;
-    
+
+    // Columns are processed in chunks, each made of blocks of (at most) m_pcols columns.
+    // Chunks are pipelined: while the F90 scheme runs on chunk k, the inputs of chunk k+1
+    // are packed and copied to host, and the outputs of chunk k-1 are copied back to device.
+    int m_pcols;
+    int m_num_chunks;
+    int m_cols_per_chunk;
+    bool m_is_first_step = true;
+
+    view_2d_real m_z_mid;
+    view_2d_real m_z_int;
+
+    // Double-buffered staging (one slot for the chunk being computed, one for the chunk in flight)
+    view_1d_real        m_buf_in[2];
+    view_1d_real        m_buf_out[2];
+    pinned_view_1d_real m_buf_in_h[2];
+    pinned_view_1d_real m_buf_out_h[2];
+
+    // Execution space instances for device->host and host->device stages
+    ExeSpace m_exec_in;
+    ExeSpace m_exec_out;
+
 };
 
 } // namespace scream
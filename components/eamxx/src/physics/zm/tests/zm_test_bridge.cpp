@@ -0,0 +1,108 @@
+#include "catch2/catch.hpp"
+
+#include "share/core/eamxx_types.hpp"
+#include "physics/zm/zm_eamxx_bridge.hpp"
+#include "physics/share/physics_constants.hpp"
+
+#include <ekat_comm.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Build a moist, conditionally unstable column, and run the F90 bridge on it.
+// The bridge must return finite tendencies, and the water removed from qv must
+// be exactly what ZM detrains as cloud water plus what it precipitates.
+TEST_CASE("zm_bridge", "[zm]")
+{
+  using namespace scream;
+  using PC = physics::Constants<Real>;
+
+  constexpr int pcols = 4;
+  constexpr int ncol  = 3;
+  constexpr int pver  = 72;
+  constexpr Real dt   = 1800;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  zm_eamxx_bridge_init(pcols, pver, MPI_Comm_c2f(comm.mpi_comm()));
+
+  const Real g = PC::gravit;
+  const Real Rd = PC::Rair;
+
+  // All arrays in Fortran order, with leading dimension pcols
+  auto idx = [&](const int i, const int k) { return i + k*pcols; };
+  std::vector<Real> T(pcols*pver), qv(pcols*pver), omega(pcols*pver,0), pmid(pcols*pver),
+                    pint(pcols*(pver+1)), pdel(pcols*pver), zm(pcols*pver), zi(pcols*(pver+1)),
+                    phis(pcols,0), pblh(pcols,1000), landfrac(pcols,0);
+  for (int i=0; i<ncol; ++i) {
+    const Real T_sfc = 300 + 2*i;
+    const Real ptop = 200, ps = 1e5;
+    for (int k=0; k<=pver; ++k) {
+      pint[idx(i,k)] = ptop + (ps-ptop)*k/pver;
+    }
+    // Integrate heights from the surface up
+    zi[idx(i,pver)] = 0;
+    for (int k=pver-1; k>=0; --k) {
+      pmid[idx(i,k)] = 0.5*(pint[idx(i,k)] + pint[idx(i,k+1)]);
+      pdel[idx(i,k)] = pint[idx(i,k+1)] - pint[idx(i,k)];
+      // Moist adiabat-ish: 6.5 K/km lapse rate, capped at a 200 K tropopause
+      const Real z_guess = zi[idx(i,k+1)] + 0.5*Rd*T_sfc/g*std::log(pint[idx(i,k+1)]/pmid[idx(i,k)]);
+      T[idx(i,k)] = std::max(T_sfc - 6.5e-3*z_guess, Real(200));
+      const Real es = 611.2*std::exp(17.67*(T[idx(i,k)]-273.15)/(T[idx(i,k)]-29.65));
+      qv[idx(i,k)] = 0.8*0.622*es/pmid[idx(i,k)];
+      const Real dz = Rd*T[idx(i,k)]/g*std::log(pint[idx(i,k+1)]/pint[idx(i,k)]);
+      zm[idx(i,k)] = zi[idx(i,k+1)] + 0.5*dz;
+      zi[idx(i,k)] = zi[idx(i,k+1)] + dz;
+    }
+    landfrac[i] = 0.5*i;
+  }
+
+  auto run = [&](std::vector<Real>& tend_s, std::vector<Real>& tend_q,
+                 std::vector<Real>& dlf, std::vector<Real>& prec) {
+    tend_s.assign(pcols*pver,0);
+    tend_q.assign(pcols*pver,0);
+    dlf.assign(pcols*pver,0);
+    prec.assign(pcols,0);
+    zm_eamxx_bridge_run(ncol, dt, true,
+                        T.data(), qv.data(), omega.data(),
+                        pmid.data(), pint.data(), pdel.data(), phis.data(),
+                        zm.data(), zi.data(), pblh.data(), landfrac.data(),
+                        tend_s.data(), tend_q.data(), dlf.data(), prec.data());
+  };
+
+  std::vector<Real> tend_s, tend_q, dlf, prec;
+  run(tend_s,tend_q,dlf,prec);
+
+  for (int i=0; i<ncol; ++i) {
+    REQUIRE (std::isfinite(prec[i]));
+    REQUIRE (prec[i]>=0);
+
+    // Column water budget [kg/m2/s]
+    Real dq = 0, det = 0, scale = prec[i]*PC::RHO_H2O;
+    for (int k=0; k<pver; ++k) {
+      REQUIRE (std::isfinite(tend_s[idx(i,k)]));
+      REQUIRE (std::isfinite(tend_q[idx(i,k)]));
+      REQUIRE (std::isfinite(dlf[idx(i,k)]));
+      dq  += tend_q[idx(i,k)]*pdel[idx(i,k)]/g;
+      det += dlf[idx(i,k)]*pdel[idx(i,k)]/g;
+      scale += std::abs(tend_q[idx(i,k)]*pdel[idx(i,k)]/g);
+    }
+    // NOTE: ZM clips negative precipitation to 0, so the budget only closes if it precipitates
+    if (prec[i]>0) {
+      const Real tol = 1000*std::numeric_limits<Real>::epsilon()*scale;
+      REQUIRE (std::abs(dq + det + prec[i]*PC::RHO_H2O) <= tol);
+    }
+  }
+
+  // The bridge must not carry state across calls
+  std::vector<Real> tend_s2, tend_q2, dlf2, prec2;
+  run(tend_s2,tend_q2,dlf2,prec2);
+  REQUIRE (tend_s2==tend_s);
+  REQUIRE (tend_q2==tend_q);
+  REQUIRE (dlf2==dlf);
+  REQUIRE (prec2==prec);
+}
+
+} // empty namespace
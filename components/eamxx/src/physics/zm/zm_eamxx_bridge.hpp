@@ -0,0 +1,55 @@
+#ifndef ZM_EAMXX_BRIDGE_HPP
+#define ZM_EAMXX_BRIDGE_HPP
+
+#include "share/core/eamxx_types.hpp"
+
+// Entry points of the F90 bridge (see zm_eamxx_bridge_main.F90)
+extern "C" {
+
+void zm_eamxx_bridge_init (const int pcols, const int pver, const int f_comm);
+
+void zm_eamxx_bridge_run (const int ncol, const scream::Real dtime, const bool is_first_step,
+                          const scream::Real* state_t,    const scream::Real* state_q,
+                          const scream::Real* state_omega,
+                          const scream::Real* state_pmid, const scream::Real* state_pint,
+                          const scream::Real* state_pdel, const scream::Real* state_phis,
+                          const scream::Real* state_zm,   const scream::Real* state_zi,
+                          const scream::Real* state_pblh, const scream::Real* state_landfrac,
+                          scream::Real* ptend_s,          scream::Real* ptend_q,
+                          scream::Real* dlf,              scream::Real* prec);
+
+} // extern "C"
+
+namespace scream {
+namespace zm {
+
+/*
+ * Layout of one block of (at most) pcols columns in the ZM staging buffers.
+ *
+ * A block holds all the arrays exchanged with zm_eamxx_bridge_run, back to back
+ * and in Fortran order with leading dimension pcols, so that each block can be
+ * handed to the bridge independently of the others.
+ */
+struct BridgeBlockLayout {
+  enum InputMid  { T_mid, qv, omega, p_mid, pseudo_density, z_mid, num_input_mid };
+  enum InputInt  { p_int, z_int, num_input_int };
+  enum InputCol  { phis, pblh, landfrac, num_input_col };
+  enum OutputMid { tend_s, tend_q, detrain_ql, num_output_mid };
+  enum OutputCol { prec, num_output_col };
+
+  int pcols, nlev;
+
+  KOKKOS_INLINE_FUNCTION int input_mid (const int n) const { return n*pcols*nlev; }
+  KOKKOS_INLINE_FUNCTION int input_int (const int n) const { return input_mid(num_input_mid) + n*pcols*(nlev+1); }
+  KOKKOS_INLINE_FUNCTION int input_col (const int n) const { return input_int(num_input_int) + n*pcols; }
+  KOKKOS_INLINE_FUNCTION int input_size () const { return input_col(num_input_col); }
+
+  KOKKOS_INLINE_FUNCTION int output_mid (const int n) const { return n*pcols*nlev; }
+  KOKKOS_INLINE_FUNCTION int output_col (const int n) const { return output_mid(num_output_mid) + n*pcols; }
+  KOKKOS_INLINE_FUNCTION int output_size () const { return output_col(num_output_col); }
+};
+
+} // namespace zm
+} // namespace scream
+
+#endif // ZM_EAMXX_BRIDGE_HPP
@@ -6,6 +6,7 @@
 #include "share/grid/remap/iop_remapper.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/io/eamxx_scorpio_interface.hpp"
+#include "share/io/eamxx_async_writer.hpp"
 #include "share/io/scorpio_input.hpp"
 #include "share/io/eamxx_io_utils.hpp"
 #include "share/util/eamxx_universal_constants.hpp"
@@ -42,6 +43,17 @@ DataInterpolation (const std::shared_ptr<const AbstractGrid>& model_grid,
   m_logger = console_logger(ekat::logger::LogLevel::warn);
 }
 
+DataInterpolation::~DataInterpolation ()
+{
+  // Do not leave a read in flight, since it uses our reader and fields.
+  // Also, do not throw from a destructor.
+  if (m_prefetch_ticket>0) {
+    try {
+      scorpio::AsyncWriter::instance().wait(m_prefetch_ticket);
+    } catch (...) {}
+  }
+}
+
 void DataInterpolation::
 set_logger (const std::shared_ptr<ekat::logger::LoggerBase>& logger)
 {
@@ -54,6 +66,20 @@ void DataInterpolation::run (const util::TimeStamp& ts)
   EKAT_REQUIRE_MSG (m_data_initialized,
       "[DataInterpolation] Error! You must call 'init_data_interval' before calling 'run'.\n");
 
+  // Advance the prefetch of the next slice, without ever blocking on the read.
+  // NOTE: finish_prefetch remaps the slice, which requires MPI communication,
+  //       so all ranks must agree on when to call it.
+  if (m_prefetch_ticket>0) {
+    int done = scorpio::AsyncWriter::instance().is_done(m_prefetch_ticket) ? 1 : 0;
+    int all_done;
+    m_comm.all_reduce(&done,&all_done,1,MPI_MIN);
+    if (all_done==1) {
+      finish_prefetch ();
+    }
+  } else if (m_prefetch_pending) {
+    start_prefetch ();
+  }
+
   // If we went past the current interval end, we need to update the end state
   if (not m_data_interval.contains(ts)) {
     shift_data_interval ();
@@ -141,33 +167,55 @@ void DataInterpolation::shift_data_interval ()
   m_curr_interval_idx.second = m_time_database.get_next_idx(m_curr_interval_idx.first);
 
   m_data_interval.advance(m_time_database.slices[m_curr_interval_idx.second].time);
-  std::swap (m_horiz_remapper_beg,m_horiz_remapper_end);
-  update_end_fields ();
+  if (m_prefetch and m_next_slice_idx==m_curr_interval_idx.second) {
+    // The new end slice was prefetched: make sure it's ready, then rotate remappers
+    finish_prefetch ();
+    auto old_beg = m_horiz_remapper_beg;
+    m_horiz_remapper_beg  = m_horiz_remapper_end;
+    m_horiz_remapper_end  = m_horiz_remapper_next;
+    m_horiz_remapper_next = old_beg;
+  } else {
+    // The reader may still be busy with a (useless) prefetch
+    finish_prefetch ();
+    std::swap (m_horiz_remapper_beg,m_horiz_remapper_end);
+    update_end_fields ();
+  }
+  m_next_slice_idx = -1;
+
+  // Do not start reading the next slice right away, to keep this step cheap
+  m_prefetch_pending = m_prefetch;
 }
 
 void DataInterpolation::
-update_end_fields ()
+setup_reader (const AbstractRemapper& hremap, const int slice_idx)
 {
   // First, set the correct fields in the reader
   std::vector<Field> fields;
   for (int i=0; i<m_nfields; ++i) {
-    fields.push_back(m_horiz_remapper_end->get_src_field(i));
+    fields.push_back(hremap.get_src_field(i));
   }
 
   if (m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef) {
     // We also need to read the src pressure profile
-    fields.push_back(m_horiz_remapper_end->get_src_field(m_nfields));
+    fields.push_back(hremap.get_src_field(m_nfields));
   }
   m_reader->set_fields(fields);
 
   // If we're also changing the file, must (re)init the scorpio structures
-  const auto& slice_beg = m_time_database.slices[m_curr_interval_idx.first];
-  const auto& slice_end = m_time_database.slices[m_curr_interval_idx.second];
-  if (m_reader->get_filename()!=slice_end.filename) {
-    m_reader->reset_filename(slice_end.filename);
+  const auto& slice = m_time_database.slices[slice_idx];
+  if (m_reader->get_filename()!=slice.filename) {
+    m_reader->reset_filename(slice.filename);
   }
+}
+
+void DataInterpolation::
+update_end_fields ()
+{
+  setup_reader (*m_horiz_remapper_end,m_curr_interval_idx.second);
 
   // Read and interpolate fields
+  const auto& slice_beg = m_time_database.slices[m_curr_interval_idx.first];
+  const auto& slice_end = m_time_database.slices[m_curr_interval_idx.second];
   m_logger->info("[DataInterpolation] Reading end of interval fields.");
   m_logger->info(" - interval: [" + slice_beg.time.to_string() + ", " + slice_end.time.to_string() + "]");
   m_logger->info(" - filename: " + slice_end.filename);
@@ -176,6 +224,62 @@ update_end_fields ()
   m_horiz_remapper_end->remap_fwd();
 }
 
+void DataInterpolation::
+set_prefetch (const bool prefetch)
+{
+  EKAT_REQUIRE_MSG (m_horiz_remapper_beg==nullptr,
+      "[DataInterpolation] Error! Cannot change prefetch setting after horiz remappers creation.\n");
+
+  // Without a background thread, the "prefetch" read would run inline in the
+  // run call, which only moves the read cost around (and costs an extra remapper)
+  if (prefetch and not scorpio::AsyncWriter::instance().is_async()) {
+    m_logger->warn("[DataInterpolation] Warning! Prefetch requested, but MPI does not provide\n"
+                   "  MPI_THREAD_MULTIPLE, so reads cannot run in the background. Disabling prefetch.\n");
+    m_prefetch = false;
+    return;
+  }
+
+  m_prefetch = prefetch;
+}
+
+void DataInterpolation::start_prefetch ()
+{
+  m_prefetch_pending = false;
+
+  // With a linear timeline, there may be no slice after the current interval
+  const int end_idx = m_curr_interval_idx.second;
+  if (m_time_database.timeline==util::TimeLine::Linear and end_idx+1>=m_time_database.size()) {
+    return;
+  }
+  m_next_slice_idx = m_time_database.get_next_idx(end_idx);
+
+  setup_reader (*m_horiz_remapper_next,m_next_slice_idx);
+
+  const auto& slice = m_time_database.slices[m_next_slice_idx];
+  m_logger->info("[DataInterpolation] Prefetching next interval end fields.");
+  m_logger->info(" - filename: " + slice.filename);
+  m_logger->info(" - file time idx: " + std::to_string(slice.time_idx));
+
+  auto reader = m_reader;
+  const int time_idx = slice.time_idx;
+  m_prefetch_ticket = scorpio::AsyncWriter::instance().enqueue([reader,time_idx]() {
+    reader->read_variables_to_host(time_idx);
+  });
+}
+
+void DataInterpolation::finish_prefetch ()
+{
+  if (m_prefetch_ticket==0) {
+    return;
+  }
+
+  scorpio::AsyncWriter::instance().wait(m_prefetch_ticket);
+  m_prefetch_ticket = 0;
+
+  m_reader->sync_variables_to_dev();
+  m_horiz_remapper_next->remap_fwd();
+}
+
 void DataInterpolation::
 init_data_interval (const util::TimeStamp& t0)
 {
@@ -205,6 +309,12 @@ init_data_interval (const util::TimeStamp& t0)
   update_end_fields ();
   shift_data_interval ();
 
+  // Init is not a cheap step anyways, so start reading the next slice right away,
+  // rather than at the first run call
+  if (m_prefetch_pending) {
+    start_prefetch ();
+  }
+
   m_data_initialized = true;
 }
 
@@ -408,6 +518,9 @@ create_horiz_remappers (const std::string& map_file)
   if (map_file!="") {
     m_horiz_remapper_beg = std::make_shared<RefiningRemapperP2P>(m_grid_after_hremap,map_file);
     m_horiz_remapper_end = std::make_shared<RefiningRemapperP2P>(m_grid_after_hremap,map_file);
+    if (m_prefetch) {
+      m_horiz_remapper_next = std::make_shared<RefiningRemapperP2P>(m_grid_after_hremap,map_file);
+    }
 
     int map_ncols_src = m_horiz_remapper_beg->get_src_grid()->get_num_global_dofs();
     int map_ncols_tgt = m_horiz_remapper_beg->get_tgt_grid()->get_num_global_dofs();
@@ -433,6 +546,9 @@ create_horiz_remappers (const std::string& map_file)
 
     m_horiz_remapper_beg = std::make_shared<IDR>(m_grid_after_hremap,SAT);
     m_horiz_remapper_end = std::make_shared<IDR>(m_grid_after_hremap,SAT);
+    if (m_prefetch) {
+      m_horiz_remapper_next = std::make_shared<IDR>(m_grid_after_hremap,SAT);
+    }
   }
 }
 
@@ -468,6 +584,9 @@ create_horiz_remappers (const Real iop_lat, const Real iop_lon)
   // Create IOP remappers
   m_horiz_remapper_beg = std::make_shared<IOPRemapper>(data_grid,m_grid_after_hremap,iop_lat,iop_lon);
   m_horiz_remapper_end = std::make_shared<IOPRemapper>(data_grid,m_grid_after_hremap,iop_lat,iop_lon);
+  if (m_prefetch) {
+    m_horiz_remapper_next = std::make_shared<IOPRemapper>(data_grid,m_grid_after_hremap,iop_lat,iop_lon);
+  }
 }
 
 void DataInterpolation::
@@ -618,18 +737,20 @@ void DataInterpolation::register_fields_in_remappers ()
   }
   m_vert_remapper->registration_ends();
 
-  for (int i=0; i<m_nfields; ++i) {
-    const auto& f = m_vert_remapper->get_src_field(i);
-    m_horiz_remapper_beg->register_field_from_tgt(f.clone(f.name(), m_horiz_remapper_beg->get_src_grid()->name()));
-    m_horiz_remapper_end->register_field_from_tgt(f.clone(f.name(), m_horiz_remapper_end->get_src_grid()->name()));
-  }
-  if (m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef) {
-    const auto& data_p = m_helper_pressure_fields["p_file"];
-    m_horiz_remapper_beg->register_field_from_tgt(data_p.clone(data_p.name(), m_horiz_remapper_beg->get_src_grid()->name()));
-    m_horiz_remapper_end->register_field_from_tgt(data_p.clone(data_p.name(), m_horiz_remapper_end->get_src_grid()->name()));
+  for (auto hremap : {m_horiz_remapper_beg, m_horiz_remapper_end, m_horiz_remapper_next}) {
+    if (hremap==nullptr) {
+      continue; // No prefetch
+    }
+    for (int i=0; i<m_nfields; ++i) {
+      const auto& f = m_vert_remapper->get_src_field(i);
+      hremap->register_field_from_tgt(f.clone(f.name(), hremap->get_src_grid()->name()));
+    }
+    if (m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef) {
+      const auto& data_p = m_helper_pressure_fields["p_file"];
+      hremap->register_field_from_tgt(data_p.clone(data_p.name(), hremap->get_src_grid()->name()));
+    }
+    hremap->registration_ends();
   }
-  m_horiz_remapper_beg->registration_ends();
-  m_horiz_remapper_end->registration_ends();
 }
 
 } // namespace scream
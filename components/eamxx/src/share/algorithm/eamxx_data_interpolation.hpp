@@ -45,7 +45,7 @@ public:
   DataInterpolation (const std::shared_ptr<const AbstractGrid>& model_grid,
                      const std::vector<Field>& fields);
 
-  ~DataInterpolation () = default;
+  ~DataInterpolation ();
 
   void set_logger (const std::shared_ptr<ekat::logger::LoggerBase>& logger);
 
@@ -63,6 +63,16 @@ public:
 
   void register_fields_in_remappers ();
 
+  // If enabled, the slice following the current interval end is read and remapped
+  // ahead of time into a third set of fields, so that crossing an interval boundary
+  // is just a swap of remappers. The read is executed in the background by the scorpio
+  // async queue, and the horiz remap is done at the first run call after the read
+  // completed on all ranks.
+  // NOTE: must be called before creating the horiz remappers. If MPI does not provide
+  //       MPI_THREAD_MULTIPLE, the read cannot run in the background, and prefetch is
+  //       disabled (with a warning).
+  void set_prefetch (const bool prefetch);
+
   void init_data_interval (const util::TimeStamp& t0);
 
   void run (const util::TimeStamp& ts);
@@ -74,6 +84,12 @@ protected:
   void shift_data_interval ();
   void update_end_fields ();
 
+  // Set the src fields of the given horiz remapper in the reader, and point it to the slice file
+  void setup_reader (const AbstractRemapper& hremap, const int slice_idx);
+
+  void start_prefetch ();
+  void finish_prefetch ();
+
   int get_input_files_dimlen (const std::string& dimname) const;
 
   // ----------- Internal data types ---------- //
@@ -105,9 +121,11 @@ protected:
 
   std::vector<Field>                  m_fields;
 
-  // Use two horiz remappers, so we only set them up once (it may be costly)
+  // Use two horiz remappers, so we only set them up once (it may be costly).
+  // When prefetching, a third one holds the slice after the interval end.
   std::shared_ptr<AbstractRemapper> m_horiz_remapper_beg;
   std::shared_ptr<AbstractRemapper> m_horiz_remapper_end;
+  std::shared_ptr<AbstractRemapper> m_horiz_remapper_next;
   std::shared_ptr<AbstractRemapper> m_vert_remapper;
 
   // These are inited as the usual "ncol" and "lev" at construction, but the user
@@ -132,6 +150,13 @@ protected:
   bool                  m_time_db_created   = false;
   bool                  m_data_initialized  = false;
 
+  // Prefetch status: the slice in m_horiz_remapper_next (-1 if none), the ticket of the
+  // read in flight (0 if none), and whether a prefetch must start at the next run call
+  bool                  m_prefetch            = false;
+  int                   m_next_slice_idx      = -1;
+  long long             m_prefetch_ticket     = 0;
+  bool                  m_prefetch_pending    = false;
+
   std::shared_ptr<ekat::logger::LoggerBase> m_logger;
 };
 
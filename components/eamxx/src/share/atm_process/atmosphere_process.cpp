@@ -2,6 +2,7 @@
 #include "share/util/eamxx_timing.hpp"
 #include "share/property_checks/mass_and_energy_conservation_check.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_expression.hpp"
 #include "share/util/eamxx_utils.hpp"
 
 #ifdef EAMXX_HAS_PYTHON
@@ -141,7 +142,7 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 
 void AtmosphereProcess::run (const double dt) {
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
-  start_timer (m_timer_prefix + this->name() + "::run");
+  start_timer (get_run_timers().run);
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -211,7 +212,20 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
-  stop_timer (m_timer_prefix + this->name() + "::run");
+  stop_timer (get_run_timers().run);
+}
+
+const AtmosphereProcess::RunTimers& AtmosphereProcess::get_run_timers () const {
+  if (not m_run_timers_registered) {
+    const auto prefix = m_timer_prefix + this->name();
+    m_run_timers.run                        = register_timer(prefix + "::run");
+    m_run_timers.precondition_checks        = register_timer(prefix + "::run-precondition-checks");
+    m_run_timers.postcondition_checks       = register_timer(prefix + "::run-postcondition-checks");
+    m_run_timers.column_conservation_checks = register_timer(prefix + "::run-column-conservation-checks");
+    m_run_timers.compute_tendencies         = register_timer(prefix + "::compute_tendencies");
+    m_run_timers_registered = true;
+  }
+  return m_run_timers;
 }
 
 void AtmosphereProcess::finalize () {
@@ -455,9 +469,10 @@ void AtmosphereProcess::set_computed_group (const FieldGroup& group) {
   add_py_fields(group);
 }
 
-void AtmosphereProcess::run_property_check (const prop_check_ptr&       property_check,
-                                            const CheckFailHandling     check_fail_handling,
-                                            const PropertyCheckCategory property_check_category) const {
+CheckResult AtmosphereProcess::
+run_property_check (const prop_check_ptr&       property_check,
+                    const CheckFailHandling     check_fail_handling,
+                    const PropertyCheckCategory property_check_category) const {
   m_atm_logger->trace("[" + this->name() + "] run_property_check '" + property_check->name() + "'...");
   auto res_and_msg = property_check->check();
 
@@ -548,53 +563,74 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
       EKAT_ERROR_MSG(ss.str());
     }
   }
+
+  return res_and_msg.result;
 }
 
 void AtmosphereProcess::run_precondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  start_timer(get_run_timers().precondition_checks);
   // Run all pre-condition property checks
-  for (const auto& it : m_precondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Precondition);
-  }
-  stop_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  run_property_checks(m_precondition_checks, m_precondition_checks_batch,
+                      PropertyCheckCategory::Precondition);
+  stop_timer(get_run_timers().precondition_checks);
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...done!");
 }
 
 void AtmosphereProcess::run_postcondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  start_timer(get_run_timers().postcondition_checks);
   // Run all post-condition property checks
-  for (const auto& it : m_postcondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Postcondition);
-  }
-  stop_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  run_property_checks(m_postcondition_checks, m_postcondition_checks_batch,
+                      PropertyCheckCategory::Postcondition);
+  stop_timer(get_run_timers().postcondition_checks);
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...done!");
 }
 
+void AtmosphereProcess::
+run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                     const PropertyChecksBatch&  batch,
+                     const PropertyCheckCategory property_check_category) const
+{
+  EKAT_REQUIRE_MSG (batch.size()==static_cast<int>(checks.size()),
+      "Error! Property checks list and batch are out of sync.\n"
+      "  - Atmosphere process name: " + name() + "\n");
+
+  const auto must_run = batch.screen();
+  bool repaired = false;
+  int i = 0;
+  for (const auto& it : checks) {
+    // If a check repaired some field, the screening of the following
+    // checks may be outdated, so run them all individually.
+    if (must_run[i] or repaired) {
+      auto res = run_property_check(it.second, it.first, property_check_category);
+      repaired |= res==CheckResult::Repairable;
+    }
+    ++i;
+  }
+}
+
 void AtmosphereProcess::run_column_conservation_check () const {
   m_atm_logger->debug("[" + this->name() + "] run_column_conservation_check...");
-  start_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  start_timer(get_run_timers().column_conservation_checks);
   // Conservation check is run as a postcondition check
   run_property_check(m_conservation.second,
                      m_conservation.first,
                      PropertyCheckCategory::Postcondition);
-  stop_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  stop_timer(get_run_timers().column_conservation_checks);
   m_atm_logger->debug("[" + this->name() + "] run_column-conservation_checks...done!");
 }
 
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    start_timer(get_run_timers().compute_tendencies);
     for (auto& it : m_start_of_step_fields) {
       const auto& fname = it.first;
       const auto& f     = get_field_out(fname);
             auto& f_beg = it.second;
       f_beg.deep_copy(f);
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    stop_timer(get_run_timers().compute_tendencies);
   }
 }
 
@@ -602,20 +638,18 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
   using namespace ShortFieldTagsNames;
   if (m_compute_proc_tendencies) {
     m_atm_logger->debug("[" + this->name() + "] computing tendencies...");
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    start_timer(get_run_timers().compute_tendencies);
     for (auto it : m_proc_tendencies) {
-      // Note: f_beg is nonconst, so we can store step tendency in it
       const auto& tname = it.first;
       const auto& fname = m_tend_to_field.at(tname);
       const auto& f     = get_field_out(fname);
-            auto& f_beg = m_start_of_step_fields.at(fname);
-            auto& tend  = it.second;
+      const auto& f_beg = m_start_of_step_fields.at(fname);
+      const auto& tend  = it.second;
 
-      // Compute tend from this atm proc step, then sum into overall atm timestep tendency
-      f_beg.update(f,1,-1);
-      tend.update(f_beg,1,1);
+      // Sum the tend from this atm proc step into overall atm timestep tendency (single kernel)
+      assign(tend, tend + (f - f_beg));
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    stop_timer(get_run_timers().compute_tendencies);
   }
 }
 
@@ -827,6 +861,7 @@ add_precondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_precondition_checks.push_back(std::make_pair(cfh,pc));
+  m_precondition_checks_batch.add(pc);
 }
 
 void AtmosphereProcess::
@@ -874,6 +909,7 @@ add_postcondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_postcondition_checks.push_back(std::make_pair(cfh,pc));
+  m_postcondition_checks_batch.add(pc);
 }
 
 void AtmosphereProcess::
@@ -8,6 +8,7 @@
 #include "share/field/field_identifier.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/property_checks/property_check.hpp"
+#include "share/property_checks/property_checks_batch.hpp"
 #include "share/field/field_request.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
@@ -185,6 +186,12 @@ public:
   const std::list<GroupRequest>& get_required_group_requests () const { return m_required_group_requests; }
   const std::list<GroupRequest>& get_computed_group_requests () const { return m_computed_group_requests; }
 
+  // Whether this process recomputes all of its computed fields at every atm time step.
+  // Processes that only update their outputs on some steps (e.g., radiation, when called
+  // less often than the atm step) must return false, so that their outputs are treated
+  // as carrying data across steps (see AtmProcDAG::compute_field_lifetimes).
+  virtual bool computes_fields_every_step () const { return true; }
+
   // These sets allow to get all the actual in/out fields stored by the atm proc
   // Note: if an atm proc requires a group, then all the fields in the group, as well as
   //       the monolithic field (if present) will be added as required fields for this atm proc.
@@ -499,6 +506,19 @@ protected:
   // A prefix to add to this atm proc timer
   std::string m_timer_prefix;
 
+  // Ids of the timers used at every run. Since name() is virtual, they
+  // cannot be registered in the constructor, so they are registered lazily
+  struct RunTimers {
+    int run;
+    int precondition_checks;
+    int postcondition_checks;
+    int column_conservation_checks;
+    int compute_tendencies;
+  };
+  const RunTimers& get_run_timers () const;
+  mutable RunTimers m_run_timers;
+  mutable bool      m_run_timers_registered = false;
+
   // The logger for the whole atmosphere
   // WARNING: this is non-const, but you should *NOT* modify its
   //          log level and/or its sinks. If you just need to log
@@ -547,9 +567,16 @@ private:
   void fix_energy (const double dt, const bool & print_debug_info);
 
   // Run an individual property check. The input property_check_category_name
-  void run_property_check (const prop_check_ptr&       property_check,
-                           const CheckFailHandling     check_fail_handling,
-                           const PropertyCheckCategory property_check_category) const;
+  // Returns the result of the check (before any repair).
+  CheckResult run_property_check (const prop_check_ptr&       property_check,
+                                  const CheckFailHandling     check_fail_handling,
+                                  const PropertyCheckCategory property_check_category) const;
+
+  // Run a list of property checks, screening them all at once first (see PropertyChecksBatch),
+  // so that only the ones that may not pass are run individually.
+  void run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                            const PropertyChecksBatch&  batch,
+                            const PropertyCheckCategory property_check_category) const;
 
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
@@ -581,6 +608,10 @@ private:
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_precondition_checks;
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_postcondition_checks;
 
+  // Same checks as above, batched for a fast screening
+  PropertyChecksBatch m_precondition_checks_batch;
+  PropertyChecksBatch m_postcondition_checks_batch;
+
   // Column local mass and energy conservation check
   std::pair<CheckFailHandling,prop_check_ptr> m_conservation;
 
@@ -2,6 +2,7 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 
 #include <fstream>
+#include <functional>
 
 namespace scream {
 
@@ -113,6 +114,110 @@ void AtmProcDAG::add_surface_coupling (const std::set<FieldIdentifier>& imports,
   update_unmet_deps();
 }
 
+AtmProcDAG::lifetimes_map AtmProcDAG::
+compute_field_lifetimes (const group_type& atm_procs) const
+{
+  lifetimes_map lifetimes;
+  std::map<std::string,std::set<std::string>> excluded;
+
+  // The span of subcycled groups, with inner groups coming before outer ones
+  std::vector<FieldLifetime> subcycled_groups;
+
+  int pos = 0;
+  std::function<void(const group_type&,const bool)> scan;
+  scan = [&](const group_type& group, const bool in_parallel_block) {
+    // In a parallel block, all procs see the state at the beginning of the block,
+    // so they all get the same position
+    const bool parallel = in_parallel_block or
+                          group.get_schedule_type()!=ScheduleType::Sequential;
+    const int group_first = pos;
+
+    for (int i=0; i<group.get_num_processes(); ++i) {
+      const auto proc = group.get_process(i);
+      if (proc->type()==AtmosphereProcessType::Group) {
+        auto sub_group = std::dynamic_pointer_cast<const group_type>(proc);
+        EKAT_REQUIRE_MSG(sub_group, "Error! Unexpected failure in dynamic_pointer_cast.\n"
+                                    "       Please, contact developers.\n");
+        scan(*sub_group,parallel);
+        continue;
+      }
+
+      // Inputs first: a field that is required by a proc (or a parallel block) before
+      // being computed by an earlier one holds data from the previous time step
+      for (const auto& req : proc->get_required_field_requests()) {
+        const auto& gname = req.fid.get_grid_name();
+        const auto& fname = req.fid.name();
+        auto& grid_lifetimes = lifetimes[gname];
+        auto it = grid_lifetimes.find(fname);
+        if (it==grid_lifetimes.end() or it->second.first>=pos) {
+          excluded[gname].insert(fname);
+        } else {
+          it->second.last = std::max(it->second.last,pos);
+        }
+        if (req.groups.size()>0) {
+          excluded[gname].insert(fname);
+        }
+      }
+      // Outputs of procs that do not run at every step must keep their value across steps
+      const bool every_step = proc->computes_fields_every_step();
+      for (const auto& req : proc->get_computed_field_requests()) {
+        const auto& gname = req.fid.get_grid_name();
+        const auto& fname = req.fid.name();
+        auto& grid_lifetimes = lifetimes[gname];
+        if (grid_lifetimes.count(fname)==0) {
+          grid_lifetimes[fname] = FieldLifetime{pos,pos};
+        }
+        if (req.groups.size()>0 or not every_step) {
+          excluded[gname].insert(fname);
+        }
+      }
+
+      if (not parallel) {
+        ++pos;
+      }
+    }
+    if (parallel and not in_parallel_block) {
+      ++pos;
+    }
+
+    if (group.get_num_subcycles()>1) {
+      subcycled_groups.push_back(FieldLifetime{group_first,pos-1});
+    }
+  };
+  scan(atm_procs,false);
+
+  // Remove excluded fields, as well as fields that are not required by anyone
+  // after being computed (they are likely needed outside of the atm procs)
+  for (auto& it_grid : lifetimes) {
+    const auto& grid_excluded = excluded[it_grid.first];
+    auto& grid_lifetimes = it_grid.second;
+    for (auto it=grid_lifetimes.begin(); it!=grid_lifetimes.end(); ) {
+      if (grid_excluded.count(it->first)==1 or it->second.last==it->second.first) {
+        it = grid_lifetimes.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  // A field that is alive across the boundary of a subcycled group must stay alive
+  // during all the iterations, so extend its lifetime to the whole group
+  for (const auto& group_lifetime : subcycled_groups) {
+    for (auto& it_grid : lifetimes) {
+      for (auto& it : it_grid.second) {
+        auto& lt = it.second;
+        const bool inside = lt.first>=group_lifetime.first and lt.last<=group_lifetime.last;
+        if (lt.overlaps(group_lifetime) and not inside) {
+          lt.first = std::min(lt.first,group_lifetime.first);
+          lt.last  = std::max(lt.last,group_lifetime.last);
+        }
+      }
+    }
+  }
+
+  return lifetimes;
+}
+
 void AtmProcDAG::write_dag (const std::string& fname, const int verbosity) const {
 
   if (verbosity<=0) {
@@ -3,6 +3,7 @@
 
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/field/field_group.hpp"
+#include "share/field/field_memory_planner.hpp"
 
 #include <memory>
 #include <string>
@@ -27,6 +28,18 @@ public:
 
   void write_dag (const std::string& fname, const int verbosity = VERB_MAX) const;
 
+  // For each grid, the lifetimes of the fields that are computed and then consumed within
+  // the atm time step. Fields that are required before being computed (i.e., that carry
+  // data across time steps), that are never required after being computed, that are
+  // computed by a process that does not recompute them at every step (see
+  // AtmosphereProcess::computes_fields_every_step), or that are part of a group are not
+  // included. Positions are the indices of the atomic processes
+  // in execution order, with all the processes of a parallel block sharing one position.
+  // NOTE: this only relies on the field requests of the processes, so it can be called
+  //       before the fields are created.
+  using lifetimes_map = std::map<std::string,std::map<std::string,FieldLifetime>>;
+  lifetimes_map compute_field_lifetimes (const group_type& atm_procs) const;
+
   bool has_unmet_dependencies () const { return m_has_unmet_deps; }
   const std::map<int,std::set<int>>& unmet_deps () const {
     return m_unmet_deps;
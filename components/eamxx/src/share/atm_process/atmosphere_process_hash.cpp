@@ -1,6 +1,5 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/field/field_utils.hpp"
-#include "share/util/eamxx_array_utils.hpp"
 #include "share/util/eamxx_bfbhash.hpp"
 
 #include <ekat_assert.hpp>
@@ -14,102 +13,15 @@ namespace {
 using ExeSpace = KokkosTypes<DefaultDevice>::ExeSpace;
 using bfbhash::HashType;
 
-void hash (const Field::view_dev_t<const Real*>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      bfbhash::hash(v(idx), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
+// Append all the fields in the list/groups to fields
+void gather (const std::list<Field>& fs, std::vector<Field>& fields) {
+  fields.insert(fields.end(),fs.begin(),fs.end());
 }
 
-void hash (const Field::view_dev_t<const Real**>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j;
-      unflatten_idx(idx, dims, i, j);
-      bfbhash::hash(v(i,j), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
-}
-
-void hash (const Field::view_dev_t<const Real***>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k;
-      unflatten_idx(idx, dims, i, j, k);
-      bfbhash::hash(v(i,j,k), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
-}
-
-void hash (const Field::view_dev_t<const Real****>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k, m;
-      unflatten_idx(idx, dims, i, j, k, m);
-      bfbhash::hash(v(i,j,k,m), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
-}
-
-void hash (const Field::view_dev_t<const Real*****>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k, m, n;
-      unflatten_idx(idx, dims, i, j, k, m, n);
-      bfbhash::hash(v(i,j,k,m,n), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
-}
-
-void hash (const Field& f, HashType& accum) {
-  const auto& hd = f.get_header();
-  const auto& id = hd.get_identifier();
-  const auto& lo = id.get_layout();
-  const auto rank = lo.rank();
-  switch (rank) {
-  case 1: hash(f.get_view<const Real*    >(), lo, accum); break;
-  case 2: hash(f.get_view<const Real**   >(), lo, accum); break;
-  case 3: hash(f.get_view<const Real***  >(), lo, accum); break;
-  case 4: hash(f.get_view<const Real**** >(), lo, accum); break;
-  case 5: hash(f.get_view<const Real*****>(), lo, accum); break;
-  default: break;
-  }
-}
-
-void hash (const std::list<Field>& fs, HashType& accum) {
-  for (const auto& f : fs)
-    hash(f, accum);
-}
-
-void hash (const std::list<FieldGroup>& fgs, HashType& accum) {
+void gather (const std::list<FieldGroup>& fgs, std::vector<Field>& fields) {
   for (const auto& g : fgs)
     for (const auto& e : g.m_individual_fields)
-      hash(*e.second, accum);
+      fields.push_back(*e.second);
 }
 
 } // namespace anon
@@ -126,24 +38,31 @@ void AtmosphereProcess
 
   // When calling printf later, how much space does the hash name take (we'll update later)
   int slen = 0;
-  // Compute local hashes
+  // Compute local hashes. All fields are hashed at once, so gather them
+  // first, and keep track of which accumulator each of them contributes to.
+  std::vector<Field> fields;
+  std::vector<int> field_accum;
+  auto add_fields = [&](const auto& fs, const int iaccum) {
+    gather(fs,fields);
+    field_accum.resize(fields.size(),iaccum);
+  };
   if (m_internal_diagnostics_level==1) {
     // Lump fields together (but keep in/out/internal separated)
     if (compute[0]) {
-      laccum.emplace_back();
-      hash(m_fields_in, laccum.back());
-      hash(m_groups_in, laccum.back());
+      add_fields(m_fields_in,laccum.size());
+      add_fields(m_groups_in,laccum.size());
+      laccum.emplace_back(0);
       hash_names.push_back("inputs");
     }
     if (compute[1]) {
-      laccum.emplace_back();
-      hash(m_fields_out, laccum.back());
-      hash(m_groups_out, laccum.back());
+      add_fields(m_fields_out,laccum.size());
+      add_fields(m_groups_out,laccum.size());
+      laccum.emplace_back(0);
       hash_names.push_back("outputs");
     }
     if (compute[2]) {
-      laccum.emplace_back();
-      hash(m_internal_fields, laccum.back());
+      add_fields(m_internal_fields,laccum.size());
+      laccum.emplace_back(0);
       hash_names.push_back("internals");
     }
 
@@ -157,42 +76,28 @@ void AtmosphereProcess
       return f.name() + " (" + ekat::join(fl.names(),",") + ") <" + fid.get_grid_name() + ">";
     };
     if (compute[0]) {
-      for (const auto& f : m_fields_in) {
-        laccum.emplace_back();
-        hash_names.push_back(make_hash_name(f));
-        hash(f,laccum.back());
-      }
-      for (const auto& g : m_groups_in) {
-        for (const auto& [fn,f] : g.m_individual_fields) {
-          laccum.emplace_back();
-          hash_names.push_back(make_hash_name(*f));
-          hash(*f,laccum.back());
-        }
-      }
+      gather(m_fields_in,fields);
+      gather(m_groups_in,fields);
     }
     if (compute[1]) {
-      for (const auto& f : m_fields_out) {
-        laccum.emplace_back();
-        hash_names.push_back(make_hash_name(f));
-        hash(f,laccum.back());
-      }
-      for (const auto& g : m_groups_out) {
-        for (const auto& [fn,f] : g.m_individual_fields) {
-          laccum.emplace_back();
-          hash_names.push_back(make_hash_name(*f));
-          hash(*f,laccum.back());
-        }
-      }
+      gather(m_fields_out,fields);
+      gather(m_groups_out,fields);
     }
     if (compute[2]) {
-      for (const auto& f : m_internal_fields) {
-        laccum.emplace_back();
-        hash_names.push_back(make_hash_name(f));
-        hash(f,laccum.back());
-      }
+      gather(m_internal_fields,fields);
+    }
+    for (const auto& f : fields) {
+      field_accum.push_back(laccum.size());
+      laccum.emplace_back(0);
+      hash_names.push_back(make_hash_name(f));
     }
   }
 
+  const auto fhashes = hash_fields(fields);
+  for (size_t i=0; i<fields.size(); ++i) {
+    bfbhash::hash(fhashes[i],laccum[field_accum[i]]);
+  }
+
   if (compute[3]) {
     laccum.emplace_back();
 
@@ -244,7 +149,10 @@ void AtmosphereProcess::
 print_fast_global_state_hash (const std::string& label, const TimeStamp& t) const
 {
   HashType laccum = 0;
-  hash(m_fields_in, laccum);
+  std::vector<Field> fields;
+  gather(m_fields_in, fields);
+  for (const auto& h : hash_fields(fields))
+    bfbhash::hash(h, laccum);
   HashType gaccum;
   bfbhash::all_reduce_HashType(m_comm.mpi_comm(), &laccum, &gaccum, 1);
   if (m_comm.am_i_root())
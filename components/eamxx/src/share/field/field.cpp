@@ -239,4 +239,29 @@ void Field::allocate_view ()
   m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
 }
 
+void Field::allocate_view (const view_dev_t<char*>& arena, const long long offset)
+{
+  EKAT_REQUIRE_MSG(!is_allocated(), "Error! View was already allocated.\n");
+
+  // Short names
+  const auto& id     = m_header->get_identifier();
+  const auto& layout = id.get_layout();
+  auto& alloc_prop   = m_header->get_alloc_properties();
+
+  // Commit the allocation properties
+  alloc_prop.commit(layout);
+
+  const auto view_dim = alloc_prop.get_alloc_size();
+  EKAT_REQUIRE_MSG(offset>=0 && offset+view_dim<=static_cast<long long>(arena.size()),
+      "Error! Field does not fit in the input arena.\n"
+      "  - field name : " + id.name() + "\n"
+      "  - alloc size : " + std::to_string(view_dim) + "\n"
+      "  - offset     : " + std::to_string(offset) + "\n"
+      "  - arena size : " + std::to_string(arena.size()) + "\n");
+
+  // The subview keeps a reference to the arena, so the arena stays alive as long as the field does
+  m_data.d_view = Kokkos::subview(arena,Kokkos::make_pair(offset,offset+view_dim));
+  m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
+}
+
 } // namespace scream
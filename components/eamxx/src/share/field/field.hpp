@@ -311,6 +311,10 @@ public:
   // Allocate the actual view
   void allocate_view ();
 
+  // Use a slice of a pre-allocated arena as the view, starting at the given byte offset.
+  // NOTE: fields sharing an arena may alias each other (see FieldMemoryPlanner).
+  void allocate_view (const view_dev_t<char*>& arena, const long long offset);
+
   // Create contiguous helper field for running sync_to_host
   // and sync_to_device with non-contiguous fields
   void initialize_contiguous_helper_field () {
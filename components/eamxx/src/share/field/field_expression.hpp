@@ -0,0 +1,381 @@
+#ifndef SCREAM_FIELD_EXPRESSION_HPP
+#define SCREAM_FIELD_EXPRESSION_HPP
+
+#include "share/field/field.hpp"
+#include "share/util/eamxx_universal_constants.hpp"
+
+#include <ekat_math_utils.hpp>
+
+#include <type_traits>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * Lazy arithmetic expressions over Real-valued fields
+ *
+ * Arithmetic operators on fields (and scalars) do not compute anything, but
+ * build an expression tree, which is evaluated by assign(y,expr) in a single
+ * kernel over the layout of y. E.g.,
+ *
+ *   assign(tend, tend + (f - f_beg));
+ *   assign(y, a*x + b*y/z);
+ *
+ * reads each field once and writes y once, while the equivalent chain of
+ * Field::update/scale/scale_inv calls launches one kernel (and streams the
+ * whole field through memory) per call.
+ *
+ * All fields in the expression must have the same layout as y (packed fields and
+ * subfields are fine, since entries are accessed via strided views over the
+ * logical layout dims), and data type Real.
+ *
+ * Fill values: if an operand field may be filled (see FieldHeader::may_be_filled),
+ * entries where it equals fill_value are skipped, leaving y unchanged. This matches
+ * the semantic of the fill-aware Field::update (for all combine modes but Replace).
+ *
+ * Masks: assign(y,expr,mask) only updates y where the (IntType) mask field is nonzero.
+ */
+
+namespace expr {
+
+// Data type of a rank-N view of T (including N=0)
+template<typename T, int N>
+struct data_nd { using type = typename data_nd<T,N-1>::type*; };
+template<typename T>
+struct data_nd<T,0> { using type = T; };
+template<typename T, int N>
+using data_nd_t = typename data_nd<T,N>::type;
+
+// Leaf storing a field
+struct FieldLeaf {
+  Field f;
+
+  template<int N, HostOrDevice HD>
+  struct Eval {
+    using view_t = Field::get_strided_view_type<expr::data_nd_t<const Real,N>,HD>;
+    view_t v;
+    bool   fill_aware;
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    Real operator() (const Idx... i) const { return v(i...); }
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    bool is_filled (const Idx... i) const {
+      return fill_aware and v(i...)==constants::fill_value<Real>;
+    }
+  };
+
+  template<int N, HostOrDevice HD>
+  Eval<N,HD> get_eval () const {
+    using data_t = expr::data_nd_t<const Real,N>;
+    return Eval<N,HD>{f.get_strided_view<data_t,HD>(),f.get_header().may_be_filled()};
+  }
+
+  void get_fields (std::vector<Field>& fields) const { fields.push_back(f); }
+};
+
+// Leaf storing a scalar
+struct ScalarLeaf {
+  Real value;
+
+  template<int N, HostOrDevice HD>
+  struct Eval {
+    Real value;
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    Real operator() (const Idx...) const { return value; }
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    bool is_filled (const Idx...) const { return false; }
+  };
+
+  template<int N, HostOrDevice HD>
+  Eval<N,HD> get_eval () const { return Eval<N,HD>{value}; }
+
+  void get_fields (std::vector<Field>&) const {}
+};
+
+// Binary operations
+struct Plus  { KOKKOS_INLINE_FUNCTION static Real apply (const Real a, const Real b) { return a+b; } };
+struct Minus { KOKKOS_INLINE_FUNCTION static Real apply (const Real a, const Real b) { return a-b; } };
+struct Times { KOKKOS_INLINE_FUNCTION static Real apply (const Real a, const Real b) { return a*b; } };
+struct Over  { KOKKOS_INLINE_FUNCTION static Real apply (const Real a, const Real b) { return a/b; } };
+struct Max   { KOKKOS_INLINE_FUNCTION static Real apply (const Real a, const Real b) { return ekat::impl::max(a,b); } };
+struct Min   { KOKKOS_INLINE_FUNCTION static Real apply (const Real a, const Real b) { return ekat::impl::min(a,b); } };
+
+template<typename Op, typename L, typename R>
+struct BinaryNode {
+  L lhs;
+  R rhs;
+
+  template<int N, HostOrDevice HD>
+  struct Eval {
+    typename L::template Eval<N,HD> lhs;
+    typename R::template Eval<N,HD> rhs;
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    Real operator() (const Idx... i) const { return Op::apply(lhs(i...),rhs(i...)); }
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    bool is_filled (const Idx... i) const { return lhs.is_filled(i...) or rhs.is_filled(i...); }
+  };
+
+  template<int N, HostOrDevice HD>
+  Eval<N,HD> get_eval () const {
+    return Eval<N,HD>{lhs.template get_eval<N,HD>(),rhs.template get_eval<N,HD>()};
+  }
+
+  void get_fields (std::vector<Field>& fields) const {
+    lhs.get_fields(fields);
+    rhs.get_fields(fields);
+  }
+};
+
+template<typename E>
+struct NegateNode {
+  E arg;
+
+  template<int N, HostOrDevice HD>
+  struct Eval {
+    typename E::template Eval<N,HD> arg;
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    Real operator() (const Idx... i) const { return -arg(i...); }
+
+    template<typename... Idx>
+    KOKKOS_INLINE_FUNCTION
+    bool is_filled (const Idx... i) const { return arg.is_filled(i...); }
+  };
+
+  template<int N, HostOrDevice HD>
+  Eval<N,HD> get_eval () const { return Eval<N,HD>{arg.template get_eval<N,HD>()}; }
+
+  void get_fields (std::vector<Field>& fields) const { arg.get_fields(fields); }
+};
+
+// Type traits, to restrict the operators below to fields/expressions
+template<typename T> struct is_node : std::false_type {};
+template<> struct is_node<FieldLeaf> : std::true_type {};
+template<> struct is_node<ScalarLeaf> : std::true_type {};
+template<typename Op, typename L, typename R> struct is_node<BinaryNode<Op,L,R>> : std::true_type {};
+template<typename E> struct is_node<NegateNode<E>> : std::true_type {};
+
+template<typename T>
+constexpr bool is_expr_v = is_node<T>::value or std::is_same_v<T,Field>;
+
+template<typename T>
+constexpr bool is_operand_v = is_expr_v<T> or std::is_arithmetic_v<T>;
+
+// At least one of the operands must be a field/expression, so we don't hijack scalar arithmetic
+template<typename L, typename R>
+using enable_if_binary_t = std::enable_if_t<is_operand_v<L> and is_operand_v<R> and
+                                            (is_expr_v<L> or is_expr_v<R>)>;
+
+template<typename T>
+auto to_node (const T& t) {
+  if constexpr (std::is_same_v<T,Field>) {
+    return FieldLeaf{t};
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    return ScalarLeaf{static_cast<Real>(t)};
+  } else {
+    return t;
+  }
+}
+
+template<typename Op, typename L, typename R>
+auto make_binary (const L& l, const R& r) {
+  using LN = decltype(to_node(l));
+  using RN = decltype(to_node(r));
+  return BinaryNode<Op,LN,RN>{to_node(l),to_node(r)};
+}
+
+} // namespace expr
+
+template<typename L, typename R, typename = expr::enable_if_binary_t<L,R>>
+auto operator+ (const L& l, const R& r) { return expr::make_binary<expr::Plus>(l,r); }
+
+template<typename L, typename R, typename = expr::enable_if_binary_t<L,R>>
+auto operator- (const L& l, const R& r) { return expr::make_binary<expr::Minus>(l,r); }
+
+template<typename L, typename R, typename = expr::enable_if_binary_t<L,R>>
+auto operator* (const L& l, const R& r) { return expr::make_binary<expr::Times>(l,r); }
+
+template<typename L, typename R, typename = expr::enable_if_binary_t<L,R>>
+auto operator/ (const L& l, const R& r) { return expr::make_binary<expr::Over>(l,r); }
+
+template<typename L, typename R, typename = expr::enable_if_binary_t<L,R>>
+auto max (const L& l, const R& r) { return expr::make_binary<expr::Max>(l,r); }
+
+template<typename L, typename R, typename = expr::enable_if_binary_t<L,R>>
+auto min (const L& l, const R& r) { return expr::make_binary<expr::Min>(l,r); }
+
+template<typename E, typename = std::enable_if_t<expr::is_expr_v<E>>>
+auto operator- (const E& e) {
+  using N = decltype(expr::to_node(e));
+  return expr::NegateNode<N>{expr::to_node(e)};
+}
+
+// Make the operators visible to ADL on expression nodes as well
+namespace expr {
+using scream::operator+;
+using scream::operator-;
+using scream::operator*;
+using scream::operator/;
+using scream::max;
+using scream::min;
+} // namespace expr
+
+namespace details {
+
+template<int N, HostOrDevice HD, bool use_mask, typename EvalT>
+struct AssignExprHelper {
+  using exec_space = typename Field::get_device<HD>::execution_space;
+  using lhs_view_t  = Field::get_strided_view_type<expr::data_nd_t<Real,N>,HD>;
+  using mask_view_t = Field::get_strided_view_type<expr::data_nd_t<const int,N>,HD>;
+
+  template<int M>
+  using MDRange = Kokkos::MDRangePolicy<
+                    exec_space,
+                    Kokkos::Rank<M,Kokkos::Iterate::Right,Kokkos::Iterate::Right>
+                  >;
+
+  void run (const std::vector<int>& d) const {
+    if constexpr (N==0) {
+      Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0,1),*this);
+    } else if constexpr (N==1) {
+      Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0,d[0]),*this);
+    } else if constexpr (N==2) {
+      Kokkos::parallel_for(MDRange<2>({0,0},{d[0],d[1]}),*this);
+    } else if constexpr (N==3) {
+      Kokkos::parallel_for(MDRange<3>({0,0,0},{d[0],d[1],d[2]}),*this);
+    } else if constexpr (N==4) {
+      Kokkos::parallel_for(MDRange<4>({0,0,0,0},{d[0],d[1],d[2],d[3]}),*this);
+    } else if constexpr (N==5) {
+      Kokkos::parallel_for(MDRange<5>({0,0,0,0,0},{d[0],d[1],d[2],d[3],d[4]}),*this);
+    } else {
+      Kokkos::parallel_for(MDRange<6>({0,0,0,0,0,0},{d[0],d[1],d[2],d[3],d[4],d[5]}),*this);
+    }
+  }
+
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const Idx... i) const {
+    if constexpr (N==0) {
+      apply();
+    } else {
+      apply(i...);
+    }
+  }
+
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  void apply (const Idx... i) const {
+    if constexpr (use_mask) {
+      if (mask(i...)==0) return;
+    }
+    if (rhs.is_filled(i...)) return;
+    lhs(i...) = rhs(i...);
+  }
+
+  lhs_view_t  lhs;
+  mask_view_t mask;
+  EvalT       rhs;
+};
+
+template<int N, HostOrDevice HD, bool use_mask, typename E>
+void assign_impl (const Field& y, const E& e, const Field& mask)
+{
+  using eval_t = typename E::template Eval<N,HD>;
+  AssignExprHelper<N,HD,use_mask,eval_t> helper;
+  helper.lhs = y.get_strided_view<expr::data_nd_t<Real,N>,HD>();
+  if constexpr (use_mask) {
+    helper.mask = mask.get_strided_view<expr::data_nd_t<const int,N>,HD>();
+  }
+  helper.rhs = e.template get_eval<N,HD>();
+  helper.run(y.get_header().get_identifier().get_layout().dims());
+}
+
+template<HostOrDevice HD, bool use_mask, typename E>
+void assign (const Field& y, const E& e, const Field& mask)
+{
+  EKAT_REQUIRE_MSG (not y.is_read_only(),
+      "Error! Cannot assign expression to field, as it is read-only.\n"
+      " - field name: " + y.name() + "\n");
+  EKAT_REQUIRE_MSG (y.is_allocated(),
+      "Error! Cannot assign expression to field, since it is not allocated.\n"
+      " - field name: " + y.name() + "\n");
+  EKAT_REQUIRE_MSG (y.data_type()==get_data_type<Real>(),
+      "Error! Field expressions are only supported for Real-valued fields.\n"
+      " - field name: " + y.name() + "\n"
+      " - data type : " + e2str(y.data_type()) + "\n");
+
+  const auto& layout = y.get_header().get_identifier().get_layout();
+  std::vector<Field> fields;
+  e.get_fields(fields);
+  for (const auto& f : fields) {
+    EKAT_REQUIRE_MSG (f.is_allocated(),
+        "Error! Field expression operand is not allocated.\n"
+        " - field name: " + f.name() + "\n");
+    EKAT_REQUIRE_MSG (f.data_type()==get_data_type<Real>(),
+        "Error! Field expressions are only supported for Real-valued fields.\n"
+        " - field name: " + f.name() + "\n"
+        " - data type : " + e2str(f.data_type()) + "\n");
+    EKAT_REQUIRE_MSG (f.get_header().get_identifier().get_layout()==layout,
+        "Error! Incompatible layouts in field expression.\n"
+        " - lhs name  : " + y.name() + "\n"
+        " - lhs layout: " + layout.to_string() + "\n"
+        " - rhs name  : " + f.name() + "\n"
+        " - rhs layout: " + f.get_header().get_identifier().get_layout().to_string() + "\n");
+  }
+  if constexpr (use_mask) {
+    EKAT_REQUIRE_MSG (mask.data_type()==DataType::IntType and
+                      mask.get_header().get_identifier().get_layout()==layout,
+        "Error! Mask for field expression must be an IntType field with the same layout as the lhs.\n"
+        " - lhs name : " + y.name() + "\n"
+        " - mask name: " + mask.name() + "\n");
+  }
+
+  switch (layout.rank()) {
+    case 0: assign_impl<0,HD,use_mask>(y,e,mask); break;
+    case 1: assign_impl<1,HD,use_mask>(y,e,mask); break;
+    case 2: assign_impl<2,HD,use_mask>(y,e,mask); break;
+    case 3: assign_impl<3,HD,use_mask>(y,e,mask); break;
+    case 4: assign_impl<4,HD,use_mask>(y,e,mask); break;
+    case 5: assign_impl<5,HD,use_mask>(y,e,mask); break;
+    case 6: assign_impl<6,HD,use_mask>(y,e,mask); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Rank not supported in field expression.\n"
+          " - lhs name: " + y.name() + "\n");
+  }
+  Kokkos::fence();
+}
+
+} // namespace details
+
+// Evaluate the expression e and store it in y, with a single kernel
+template<HostOrDevice HD = Device, typename E>
+void assign (const Field& y, const E& e)
+{
+  static_assert (expr::is_expr_v<E>, "Error! Invalid field expression type.\n");
+  details::assign<HD,false>(y,expr::to_node(e),Field());
+}
+
+// Same as above, but only where mask is nonzero
+template<HostOrDevice HD = Device, typename E>
+void assign (const Field& y, const E& e, const Field& mask)
+{
+  static_assert (expr::is_expr_v<E>, "Error! Invalid field expression type.\n");
+  details::assign<HD,true>(y,expr::to_node(e),mask);
+}
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_EXPRESSION_HPP
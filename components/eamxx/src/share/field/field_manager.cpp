@@ -25,6 +25,7 @@ FieldManager (const std::shared_ptr<const GridsManager>& gm,
     m_fields[gname] = std::map<ci_string,std::shared_ptr<Field>>();
     m_field_groups[gname] = std::map<ci_string, std::shared_ptr<FieldGroup>>();
     m_group_requests[gname] = std::map<std::string, std::set<GroupRequest>>();
+    m_memory_plans[gname] = FieldMemoryPlanner();
   }
 
   if (m_repo_state==RepoState::Closed) {
@@ -727,6 +728,9 @@ void FieldManager::registration_ends ()
   }
 
   for (auto grid_name : m_grids_mgr->get_grid_names()) {
+    // Allocate transient fields first, since they all share a single arena
+    allocate_transient_fields(grid_name);
+
     for (auto& it : m_fields.at(grid_name)) {
       if (it.second->is_allocated()) {
         // If the field has been already allocated, then it was in a bunlded group, so skip it.
@@ -753,10 +757,79 @@ void FieldManager::registration_ends ()
   m_repo_state = RepoState::Closed;
 }
 
+void FieldManager::
+set_field_lifetimes (const std::string& grid_name,
+                     const std::map<std::string,FieldLifetime>& lifetimes)
+{
+  EKAT_REQUIRE_MSG (m_repo_state!=RepoState::Closed,
+      "Error! Field lifetimes must be set before calling 'registration_ends()'.\n");
+  EKAT_REQUIRE_MSG(m_grids_mgr->has_grid(grid_name),
+    "Error! Attempting to set field lifetimes on grid not in the FM's grids manager:\n"
+    "  - Grid name: " + grid_name + "\n"
+    "  - Grids stored by FM: " + m_grids_mgr->print_available_grids() + "\n");
+
+  m_field_lifetimes[grid_name] = lifetimes;
+}
+
+const FieldMemoryPlanner& FieldManager::
+get_memory_plan (const std::string& grid_name) const
+{
+  EKAT_REQUIRE_MSG(m_grids_mgr->has_grid(grid_name),
+      "Error! This field manager does not contain data on grid \""+grid_name+"\"\n");
+  return m_memory_plans.at(grid_name);
+}
+
+void FieldManager::allocate_transient_fields (const std::string& grid_name)
+{
+  auto& plan = m_memory_plans[grid_name];
+  if (m_field_lifetimes.count(grid_name)==1) {
+    for (const auto& it : m_field_lifetimes.at(grid_name)) {
+      const auto& fname = it.first;
+      if (not has_field(fname,grid_name)) {
+        continue;
+      }
+
+      // Group members are handled in bulk by their customers (and may be subfields of
+      // a bundled field), so never alias them
+      bool in_group = false;
+      for (const auto& git : m_field_group_info) {
+        in_group |= ekat::contains(git.second->m_fields_names,fname);
+      }
+      auto& f = *m_fields.at(grid_name).at(fname);
+      if (in_group or f.is_allocated()) {
+        continue;
+      }
+
+      const auto& fid = f.get_header().get_identifier();
+      auto& ap = f.get_header().get_alloc_properties();
+      ap.commit(fid.get_layout());
+      plan.add_field(fname,ap.get_alloc_size(),it.second);
+    }
+  }
+  plan.plan();
+
+  if (plan.num_fields()==0) {
+    return;
+  }
+
+  Field::view_dev_t<char*> arena("transient_fields_" + grid_name,plan.arena_size());
+  for (const auto& it : m_field_lifetimes.at(grid_name)) {
+    if (plan.has_field(it.first)) {
+      m_fields.at(grid_name).at(it.first)->allocate_view(arena,plan.get_offset(it.first));
+    }
+  }
+}
+
 void FieldManager::clean_up() {
   // Clean field map
   m_fields.clear();
 
+  // Clean memory plans
+  m_field_lifetimes.clear();
+  for (auto& it : m_memory_plans) {
+    it.second = FieldMemoryPlanner();
+  }
+
   // Clean group info
   m_field_group_info.clear();
 
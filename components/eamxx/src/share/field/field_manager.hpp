@@ -6,6 +6,7 @@
 #include "share/grid/library_grids_manager.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
+#include "share/field/field_memory_planner.hpp"
 #include "share/field/field_request.hpp"
 #include "share/util/eamxx_utils.hpp"
 #include "share/core/eamxx_types.hpp"
@@ -58,6 +59,20 @@ public:
   void clean_up ();
   void clean_up (const std::string& grid_name);
 
+  // Declare the lifetime (within an atm time step) of some of the fields on the given grid.
+  // At registration_ends, these fields are allocated in a single arena, where fields whose
+  // lifetimes do not overlap can share memory (see FieldMemoryPlanner). Fields that are part
+  // of a group are always allocated individually.
+  // NOTE: the data of these fields is not preserved outside of their lifetime, so this
+  //       must not include fields that are needed across time steps (or by IO).
+  // NOTE: must be called before registration_ends
+  void set_field_lifetimes (const std::string& grid_name,
+                            const std::map<std::string,FieldLifetime>& lifetimes);
+
+  // The memory plan of the fields allocated in the transient arena of the given grid.
+  // If set_field_lifetimes was not called for this grid, the plan contains no fields.
+  const FieldMemoryPlanner& get_memory_plan (const std::string& grid_name) const;
+
   // Adds an externally-constructed field to the FieldManager. Allows the FM
   // to make the field available as if it had been built with the usual
   // registration procedures.
@@ -163,6 +178,8 @@ protected:
 
   void pre_process_monolithic_group_requests ();
 
+  void allocate_transient_fields (const std::string& grid_name);
+
   // The state of the repository
   RepoState m_repo_state;
 
@@ -189,6 +206,10 @@ protected:
   // we 'skip' them, hoping that some other request will contain the right specs.
   // If no complete request is given for that field, we need to error out
   std::list<std::pair<std::string,std::string>> m_incomplete_requests;
+
+  // Lifetimes of the transient fields on each grid, and the memory plan used to allocate them
+  std::map<std::string,std::map<std::string,FieldLifetime>> m_field_lifetimes;
+  std::map<std::string,FieldMemoryPlanner>                  m_memory_plans;
 };
 
 } // namespace scream
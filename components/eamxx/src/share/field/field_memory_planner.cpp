@@ -0,0 +1,114 @@
+#include "share/field/field_memory_planner.hpp"
+
+#include <ekat_assert.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace scream
+{
+
+void FieldMemoryPlanner::
+add_field (const std::string& name, const long long size, const FieldLifetime& lifetime)
+{
+  EKAT_REQUIRE_MSG (not m_planned,
+      "Error! Cannot add fields to the memory planner after plan() was called.\n"
+      "  - field name: " + name + "\n");
+  EKAT_REQUIRE_MSG (not has_field(name),
+      "Error! Field already added to the memory planner.\n"
+      "  - field name: " + name + "\n");
+  EKAT_REQUIRE_MSG (size>0,
+      "Error! Invalid field size in the memory planner.\n"
+      "  - field name: " + name + "\n"
+      "  - field size: " + std::to_string(size) + "\n");
+  EKAT_REQUIRE_MSG (lifetime.first<=lifetime.last,
+      "Error! Invalid field lifetime in the memory planner.\n"
+      "  - field name: " + name + "\n"
+      "  - lifetime: [" + std::to_string(lifetime.first) + "," + std::to_string(lifetime.last) + "]\n");
+
+  auto& e = m_fields[name];
+  e.size = size;
+  e.lifetime = lifetime;
+}
+
+void FieldMemoryPlanner::plan ()
+{
+  EKAT_REQUIRE_MSG (not m_planned,
+      "Error! FieldMemoryPlanner::plan() can only be called once.\n");
+
+  auto align = [](const long long n) {
+    return ((n + alignment - 1) / alignment) * alignment;
+  };
+
+  // Place the largest fields first. Break ties by name, so that the plan
+  // is the same on all ranks (which eases debugging).
+  std::vector<std::map<std::string,Entry>::iterator> order;
+  for (auto it=m_fields.begin(); it!=m_fields.end(); ++it) {
+    order.push_back(it);
+  }
+  std::stable_sort(order.begin(),order.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs->second.size>rhs->second.size;
+                   });
+
+  std::vector<const Entry*> placed;
+  for (auto& it : order) {
+    auto& e = it->second;
+
+    // The fields already placed that are alive at the same time as this one, by offset
+    std::vector<const Entry*> conflicts;
+    for (auto p : placed) {
+      if (p->lifetime.overlaps(e.lifetime)) {
+        conflicts.push_back(p);
+      }
+    }
+    std::sort(conflicts.begin(),conflicts.end(),
+              [](const Entry* lhs, const Entry* rhs) {
+                return lhs->offset<rhs->offset;
+              });
+
+    // Find the first gap that is large enough
+    long long offset = 0;
+    for (auto p : conflicts) {
+      if (offset+e.size<=p->offset) {
+        break;
+      }
+      offset = std::max(offset,align(p->offset+p->size));
+    }
+
+    e.offset = offset;
+    m_arena_size = std::max(m_arena_size,offset+e.size);
+    placed.push_back(&e);
+  }
+
+  m_planned = true;
+}
+
+long long FieldMemoryPlanner::get_offset (const std::string& name) const
+{
+  EKAT_REQUIRE_MSG (m_planned,
+      "Error! Cannot query field offsets before calling plan().\n");
+  auto it = m_fields.find(name);
+  EKAT_REQUIRE_MSG (it!=m_fields.end(),
+      "Error! Field not found in the memory planner.\n"
+      "  - field name: " + name + "\n");
+  return it->second.offset;
+}
+
+long long FieldMemoryPlanner::arena_size () const
+{
+  EKAT_REQUIRE_MSG (m_planned,
+      "Error! Cannot query the arena size before calling plan().\n");
+  return m_arena_size;
+}
+
+long long FieldMemoryPlanner::total_size () const
+{
+  long long size = 0;
+  for (const auto& it : m_fields) {
+    size += it.second.size;
+  }
+  return size;
+}
+
+} // namespace scream
@@ -0,0 +1,73 @@
+#ifndef SCREAM_FIELD_MEMORY_PLANNER_HPP
+#define SCREAM_FIELD_MEMORY_PLANNER_HPP
+
+#include <map>
+#include <string>
+
+namespace scream
+{
+
+// The interval of atm processes (in execution order) during which a field
+// holds live data within an atm time step: from its first provider to its
+// last customer (both included).
+struct FieldLifetime {
+  int first;
+  int last;
+
+  bool overlaps (const FieldLifetime& rhs) const {
+    return first<=rhs.last && rhs.first<=last;
+  }
+};
+
+/*
+ *  A memory planner for transient fields
+ *
+ *  Transient fields are fields that are computed and consumed within an
+ *  atm time step (e.g., tendencies, or inputs of a diagnostic). Two such
+ *  fields can share the same memory if their lifetimes do not overlap.
+ *  Much like a register allocator, the planner packs all the transient
+ *  fields in a single arena: fields are placed from the largest to the
+ *  smallest, each one at the lowest offset that does not collide with
+ *  any field already placed whose lifetime overlaps with its own.
+ *
+ *  All sizes and offsets are in bytes.
+ */
+
+class FieldMemoryPlanner {
+public:
+  // Offsets within the arena are multiples of this many bytes
+  static constexpr long long alignment = 128;
+
+  void add_field (const std::string& name, const long long size, const FieldLifetime& lifetime);
+
+  // Compute the offsets of all fields. Can only be called once.
+  void plan ();
+
+  bool planned () const { return m_planned; }
+
+  int num_fields () const { return m_fields.size(); }
+  bool has_field (const std::string& name) const { return m_fields.find(name)!=m_fields.end(); }
+
+  long long get_offset (const std::string& name) const;
+
+  // Memory needed by the fields with and without aliasing
+  long long arena_size () const;
+  long long total_size () const;
+
+protected:
+
+  struct Entry {
+    long long     size;
+    FieldLifetime lifetime;
+    long long     offset = -1;
+  };
+
+  std::map<std::string,Entry> m_fields;
+
+  long long m_arena_size = 0;
+  bool      m_planned    = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_MEMORY_PLANNER_HPP
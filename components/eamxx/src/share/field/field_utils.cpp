@@ -385,6 +385,117 @@ void transpose (const Field& src, Field& tgt)
   }
 }
 
+namespace {
+constexpr int HASH_MAX_RANK = 5;
+
+// What the hash kernel needs to know about a field
+struct HashFieldInfo {
+  const Real* data;
+  int rank;
+  int dims[HASH_MAX_RANK];
+  int strides[HASH_MAX_RANK];
+};
+
+template<typename ViewT>
+void set_hash_info (const ViewT& v, const FieldLayout& lo, HashFieldInfo& info) {
+  info.data = v.data();
+  info.rank = lo.rank();
+  for (int i=0; i<info.rank; ++i) {
+    info.dims[i] = lo.dim(i);
+    info.strides[i] = v.stride(i);
+  }
+}
+} // anonymous namespace
+
+std::vector<bfbhash::HashType> hash_fields (const std::vector<Field>& fields)
+{
+  using HashType   = bfbhash::HashType;
+  using KT         = KokkosTypes<DefaultDevice>;
+  using TeamPolicy = Kokkos::TeamPolicy<KT::ExeSpace>;
+  using TeamMember = typename TeamPolicy::member_type;
+
+  // Each team hashes (at most) this many entries of a single field
+  constexpr int chunk_size = 4096;
+
+  const int nfields = fields.size();
+  std::vector<HashType> hashes(nfields,0);
+
+  // Gather fields info, and split each field in chunks
+  std::vector<int> team_field;
+  KT::view_1d<HashFieldInfo> info_d("hash_fields info",nfields);
+  auto info_h = Kokkos::create_mirror_view(info_d);
+  for (int i=0; i<nfields; ++i) {
+    const auto& f = fields[i];
+    const auto& lo = f.get_header().get_identifier().get_layout();
+    auto& info = info_h(i);
+    switch (lo.rank()) {
+      case 1: set_hash_info(f.get_view<const Real*    >(),lo,info); break;
+      case 2: set_hash_info(f.get_view<const Real**   >(),lo,info); break;
+      case 3: set_hash_info(f.get_view<const Real***  >(),lo,info); break;
+      case 4: set_hash_info(f.get_view<const Real**** >(),lo,info); break;
+      case 5: set_hash_info(f.get_view<const Real*****>(),lo,info); break;
+      default: continue;
+    }
+    const int nchunks = (lo.size() + chunk_size - 1) / chunk_size;
+    team_field.insert(team_field.end(),nchunks,i);
+  }
+  const int nteams = team_field.size();
+  if (nteams==0) {
+    return hashes;
+  }
+  Kokkos::deep_copy(info_d,info_h);
+
+  // Map each team to its field and chunk
+  KT::view_1d<int> team_field_d("hash_fields team field",nteams);
+  KT::view_1d<int> team_chunk_d("hash_fields team chunk",nteams);
+  auto team_field_h = Kokkos::create_mirror_view(team_field_d);
+  auto team_chunk_h = Kokkos::create_mirror_view(team_chunk_d);
+  for (int t=0; t<nteams; ++t) {
+    team_field_h(t) = team_field[t];
+    team_chunk_h(t) = t>0 and team_field[t]==team_field[t-1] ? team_chunk_h(t-1)+1 : 0;
+  }
+  Kokkos::deep_copy(team_field_d,team_field_h);
+  Kokkos::deep_copy(team_chunk_d,team_chunk_h);
+
+  // Hash all chunks of all fields in one kernel
+  KT::view_1d<HashType> team_hash_d("hash_fields team hash",nteams);
+  auto policy = TeamPolicy(nteams,Kokkos::AUTO());
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const TeamMember& team) {
+    const int t = team.league_rank();
+    const auto& info = info_d(team_field_d(t));
+    int size = 1;
+    for (int i=0; i<info.rank; ++i) {
+      size *= info.dims[i];
+    }
+    const int beg = team_chunk_d(t)*chunk_size;
+    const int end = beg+chunk_size<size ? beg+chunk_size : size;
+
+    HashType accum = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,beg,end),
+                            [&](const int idx, HashType& accum) {
+      // Unflatten idx, and compute the offset in the (possibly padded) view
+      int offset = 0;
+      int rem = idx;
+      for (int i=info.rank-1; i>=0; --i) {
+        offset += (rem % info.dims[i])*info.strides[i];
+        rem /= info.dims[i];
+      }
+      bfbhash::hash(info.data[offset], accum);
+    }, bfbhash::HashReducer<>(accum));
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      team_hash_d(t) = accum;
+    });
+  });
+  auto team_hash_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),team_hash_d);
+
+  // Combine the chunks hashes. Since bfbhash::hash is associative and
+  // commutative, this is the same as hashing the whole field at once.
+  for (int t=0; t<nteams; ++t) {
+    bfbhash::hash(team_hash_h(t),hashes[team_field_h(t)]);
+  }
+  return hashes;
+}
+
 Field transpose (const Field& src, std::string src_T_name)
 {
   if (src_T_name=="")
@@ -2,6 +2,7 @@
 #define SCREAM_FIELD_UTILS_HPP
 
 #include "share/field/field_utils_impl.hpp"
+#include "share/util/eamxx_bfbhash.hpp"
 
 namespace scream {
 
@@ -372,6 +373,12 @@ void compute_mask (const Field& x, const ST value, Field& mask)
 void transpose (const Field& src, Field& tgt);
 Field transpose (const Field& src, std::string src_T_name = "");
 
+// Compute the (local) bfb hash of each of the input fields, using a single
+// kernel launch for all of them. The i-th hash is the same value obtained by
+// hashing all the entries of the i-th field with bfbhash::hash.
+// NOTE: only Real fields of rank 1 to 5 are hashed; other fields get hash 0.
+std::vector<bfbhash::HashType> hash_fields (const std::vector<Field>& fields);
+
 } // namespace scream
 
 #endif // SCREAM_FIELD_UTILS_HPP
@@ -4,6 +4,7 @@
 #include "share/field/field.hpp"
 #include "share/field/field_layout.hpp"
 #include "share/grid/grid_utils.hpp"
+#include "share/grid/gid2lid_index.hpp"
 
 #include <ekat_comm.hpp>
 
@@ -269,6 +270,19 @@ public:
 
   const std::map<gid_type, int> &get_gid2lid_map() const;
 
+  // Flat gid->lid lookup table, usable on host (HD=Host) or inside device kernels (HD=Device).
+  // Prefer this over get_gid2lid_map for large lists of gids. Lazily built at the first call.
+  template<HostOrDevice HD = Device>
+  using gid2lid_index_type = Gid2LidIndex<Field::get_device<HD>>;
+
+  template<HostOrDevice HD = Device>
+  const gid2lid_index_type<HD>& get_gid2lid_index() const;
+
+  // Batched lookup: lids(i) is the local id of gids(i) on this rank (or -1 if not found)
+  template<HostOrDevice HD = Device>
+  void gids_to_lids (const typename gid2lid_index_type<HD>::template view_1d<const gid_type>& gids,
+                     const typename gid2lid_index_type<HD>::template view_1d<int>& lids) const;
+
 protected:
   void copy_data(const AbstractGrid &src, const bool shallow = true);
 
@@ -322,6 +336,8 @@ protected:
 
   // Mutable, for lazy calculation
   mutable std::map<gid_type, int> m_gid2lid;
+  mutable gid2lid_index_type<Device> m_gid2lid_index;
+  mutable gid2lid_index_type<Host>   m_gid2lid_index_h;
 
   // For thread safety in modifying mutable items (just in case someone ever runs this code in
   // threaded regions)
@@ -331,6 +347,49 @@ protected:
   ekat::Comm m_comm;
 };
 
+// ================= IMPLEMENTATION ================== //
+
+template<HostOrDevice HD>
+auto AbstractGrid::get_gid2lid_index () const
+ -> const gid2lid_index_type<HD>&
+{
+  std::lock_guard<std::mutex> lock(m_mutex); // Lock the mutex
+
+  if (not m_gid2lid_index_h.is_built()) {
+    auto gids_h = get_dofs_gids().get_view<const gid_type*, Host>();
+    m_gid2lid_index_h = gid2lid_index_type<Host>(gids_h.data(),get_num_local_dofs());
+#ifdef EAMXX_ENABLE_GPU
+    m_gid2lid_index = gid2lid_index_type<Device>(gids_h.data(),get_num_local_dofs());
+#else
+    m_gid2lid_index = m_gid2lid_index_h;
+#endif
+  }
+  if constexpr (HD==Host) {
+    return m_gid2lid_index_h;
+  } else {
+    return m_gid2lid_index;
+  }
+}
+
+template<HostOrDevice HD>
+void AbstractGrid::
+gids_to_lids (const typename gid2lid_index_type<HD>::template view_1d<const gid_type>& gids,
+              const typename gid2lid_index_type<HD>::template view_1d<int>& lids) const
+{
+  EKAT_REQUIRE_MSG (lids.size()==gids.size(),
+      "Error! Input gids and output lids views have different sizes.\n"
+      " - grid name: " + m_name + "\n"
+      " - gids size: " + std::to_string(gids.size()) + "\n"
+      " - lids size: " + std::to_string(lids.size()) + "\n");
+
+  using exec_space = typename Field::get_device<HD>::execution_space;
+  const auto index = get_gid2lid_index<HD>();
+  Kokkos::parallel_for("gids_to_lids",Kokkos::RangePolicy<exec_space>(0,gids.size()),
+                       KOKKOS_LAMBDA(const int i) {
+    lids(i) = index.lid(gids(i));
+  });
+}
+
 } // namespace scream
 
 #endif // SCREAM_ABSTRACT_GRID_HPP
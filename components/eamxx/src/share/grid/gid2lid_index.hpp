@@ -0,0 +1,98 @@
+#ifndef SCREAM_GID2LID_INDEX_HPP
+#define SCREAM_GID2LID_INDEX_HPP
+
+#include "share/core/eamxx_types.hpp"
+
+#include <ekat_kokkos_types.hpp>
+#include <ekat_assert.hpp>
+
+#include <limits>
+
+namespace scream
+{
+
+/*
+ * A flat gid->lid lookup table, usable inside kernels on the device it was built for.
+ *
+ * The gids are stored in an open-addressed hash table (with linear probing), whose
+ * capacity is the smallest power of 2 that is at least twice the number of gids.
+ * Building the table is linear in the number of gids, and each lookup is expected
+ * to touch O(1) contiguous entries.
+ *
+ * If a gid appears multiple times in the input list, the largest lid is stored.
+ * Gids not found in the table are mapped to lid=-1.
+ */
+
+template<typename DeviceT>
+struct Gid2LidIndex
+{
+  using gid_type = int;
+  using KT = KokkosTypes<DeviceT>;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+
+  // Marks an empty slot in the table
+  static constexpr gid_type empty_slot = std::numeric_limits<gid_type>::min();
+
+  Gid2LidIndex () = default;
+
+  // Build on host from the list of gids, then copy the table to DeviceT
+  Gid2LidIndex (const gid_type* gids, const int num_gids)
+  {
+    int capacity = 1;
+    while (capacity < 2*num_gids) {
+      capacity *= 2;
+    }
+    m_mask = capacity - 1;
+
+    typename view_1d<gid_type>::HostMirror keys_h ("gid2lid_keys",capacity);
+    typename view_1d<int>::HostMirror      lids_h ("gid2lid_lids",capacity);
+    Kokkos::deep_copy(keys_h,empty_slot);
+    for (int lid=0; lid<num_gids; ++lid) {
+      const auto gid = gids[lid];
+      EKAT_REQUIRE_MSG (gid!=empty_slot,
+          "Error! Invalid gid passed to Gid2LidIndex.\n"
+          " - lid: " + std::to_string(lid) + "\n");
+      auto slot = find_slot(keys_h,gid);
+      keys_h(slot) = gid;
+      lids_h(slot) = lid;
+    }
+    m_keys = Kokkos::create_mirror_view_and_copy(typename DeviceT::memory_space(),keys_h);
+    m_lids = Kokkos::create_mirror_view_and_copy(typename DeviceT::memory_space(),lids_h);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool is_built () const { return m_mask>=0; }
+
+  // Returns the lid of the input gid, or -1 if gid is not in the table
+  KOKKOS_INLINE_FUNCTION
+  int lid (const gid_type gid) const {
+    const auto slot = find_slot(m_keys,gid);
+    return m_keys(slot)==gid ? m_lids(slot) : -1;
+  }
+
+#ifndef KOKKOS_ENABLE_CUDA
+private:
+#endif
+
+  // Returns the slot storing gid, or the first empty slot in its probing sequence
+  template<typename KeysView>
+  KOKKOS_INLINE_FUNCTION
+  int find_slot (const KeysView& keys, const gid_type gid) const {
+    auto h = static_cast<unsigned>(gid)*2654435761u;
+    int slot = (h ^ (h>>16)) & m_mask;
+    while (keys(slot)!=gid && keys(slot)!=empty_slot) {
+      slot = (slot+1) & m_mask;
+    }
+    return slot;
+  }
+
+  view_1d<const gid_type>   m_keys;
+  view_1d<const int>        m_lids;
+  int                       m_mask = -1;
+};
+
+} // namespace scream
+
+#endif // SCREAM_GID2LID_INDEX_HPP
@@ -49,7 +49,7 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
   // for (int i=0; i<num_ov_gids; ++i) {
   //   gid2idx[ov_gids[i]].push_back(i);
   // }
-  auto ov_gid2lid = overlapped->get_gid2lid_map();
+  const auto& ov_gid2lid = overlapped->get_gid2lid_index<Host>();
 
   // Let each rank bcast its src gids, so that other procs can
   // check against their dst grid
@@ -70,9 +70,9 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
 
     // Checks if any of this pid's gids in the dst gids list
     for (int i=0; i<num_gids_pid; ++i) {
-      auto it = ov_gid2lid.find(data[i]);
-      if (it!=ov_gid2lid.end()) {
-        pid2lids[pid].push_back(it->second);
+      const int lid = ov_gid2lid.lid(data[i]);
+      if (lid!=-1) {
+        pid2lids[pid].push_back(lid);
         ++num_imports;
       }
     }
@@ -95,7 +95,7 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
 
   // ------------------ Create export structures ----------------------- //
 
-  auto gid2lid = unique->get_gid2lid_map();
+  const auto& gid2lid = unique->get_gid2lid_index<Host>();
 
   // Let each rank bcast its src gids, so that other procs can
   // check against their dst grid
@@ -120,9 +120,9 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
 
     // Checks if any of the src lids is in the list of needs of this pid
     for (int i=0; i<num_gids_pid; ++i) {
-      auto it = gid2lid.find(data[i]);
-      if (it!=gid2lid.end()) {
-        pid2lids[pid].push_back(it->second);
+      const int lid = gid2lid.lid(data[i]);
+      if (lid!=-1) {
+        pid2lids[pid].push_back(lid);
         ++num_exports;
       }
     }
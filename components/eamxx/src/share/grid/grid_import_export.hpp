@@ -6,6 +6,7 @@
 #include "share/util/eamxx_utils.hpp"  // For check_mpi_call
 
 #include <ekat_comm.hpp>
+#include <ekat_assert.hpp>
 
 #include <mpi.h> // We do some direct MPI calls
 #include <memory>
@@ -197,11 +198,14 @@ scatter (const MPI_Datatype mpi_data_t,
 
   // 3. Pack and send the data.
   std::map<int,std::vector<T>> send_pid2data;
-  const auto& gid2lid = m_unique->get_gid2lid_map();
+  const auto& gid2lid = m_unique->get_gid2lid_index<Host>();
   for (const auto& [pid,gids] : send_pid2gids) {
     auto& data = send_pid2data[pid];
     for (auto g : gids) {
-      auto lid = gid2lid.at(g);
+      auto lid = gid2lid.lid(g);
+      EKAT_REQUIRE_MSG (lid!=-1,
+          "Error! GridImportExport::scatter: gid not found in the unique grid.\n"
+          " - gid: " + std::to_string(g) + "\n");
       data.insert(data.end(),src.at(lid).begin(),src.at(lid).end());
     }
   }
@@ -232,13 +236,16 @@ scatter (const MPI_Datatype mpi_data_t,
   recv_req.clear();
 
   // 4. Unpack received data in dst map
-  const auto& recv_gid2lid = m_overlapped->get_gid2lid_map();
+  const auto& recv_gid2lid = m_overlapped->get_gid2lid_index<Host>();
   for (const auto& [pid,data] : recv_pid2data) {
     const auto& count = recv_pid2count[pid];
     const auto& gids  = recv_pid2gids[pid];
     const int num_gids = count.size();
     for (int i=0, pos=0; i<num_gids; ++i) {
-      auto lid = recv_gid2lid.at(gids[i]);
+      auto lid = recv_gid2lid.lid(gids[i]);
+      EKAT_REQUIRE_MSG (lid!=-1,
+          "Error! GridImportExport::scatter: gid not found in the overlapped grid.\n"
+          " - gid: " + std::to_string(gids[i]) + "\n");
       auto curr_sz = dst[lid].size();
       dst[lid].resize(curr_sz+count[i]);
       for (int k=0; k<count[i]; ++k, ++pos) {
@@ -325,11 +332,14 @@ gather (const MPI_Datatype mpi_data_t,
 
   // 3. Pack and send the data.
   std::map<int,std::vector<T>> send_pid2data;
-  const auto& ov_gid2lid = m_overlapped->get_gid2lid_map();
+  const auto& ov_gid2lid = m_overlapped->get_gid2lid_index<Host>();
   for (const auto& [pid,gids] : send_pid2gids) {
     auto& data = send_pid2data[pid];
     for (auto g : gids) {
-      auto lid = ov_gid2lid.at(g);
+      auto lid = ov_gid2lid.lid(g);
+      EKAT_REQUIRE_MSG (lid!=-1,
+          "Error! GridImportExport::gather: gid not found in the overlapped grid.\n"
+          " - gid: " + std::to_string(g) + "\n");
       data.insert(data.end(),src.at(lid).begin(),src.at(lid).end());
     }
   }
@@ -360,13 +370,16 @@ gather (const MPI_Datatype mpi_data_t,
   recv_req.clear();
 
   // 4. Unpack received data in dst map
-  const auto& recv_gid2lid = m_unique->get_gid2lid_map();
+  const auto& recv_gid2lid = m_unique->get_gid2lid_index<Host>();
   for (const auto& [pid,data] : recv_pid2data) {
     const auto& count = recv_pid2count[pid];
     const auto& gids  = recv_pid2gids[pid];
     const int num_gids = count.size();
     for (int i=0, pos=0; i<num_gids; ++i) {
-      auto lid = recv_gid2lid.at(gids[i]);
+      auto lid = recv_gid2lid.lid(gids[i]);
+      EKAT_REQUIRE_MSG (lid!=-1,
+          "Error! GridImportExport::gather: gid not found in the unique grid.\n"
+          " - gid: " + std::to_string(gids[i]) + "\n");
       auto curr_sz = dst[lid].size();
       dst[lid].resize(curr_sz+count[i]);
       for (int k=0; k<count[i]; ++k, ++pos) {
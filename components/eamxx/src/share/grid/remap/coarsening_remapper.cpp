@@ -165,44 +165,53 @@ void CoarseningRemapper::remap_fwd_impl ()
     return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
   };
 
-  // First, perform the local mat-vec. Recall that in these y=Ax products,
+  // For each group of fields, perform the local mat-vec, then pack and fire off
+  // the sends for that group right away, so that its communication overlaps with
+  // the local mat-vec of the following groups. Recall that in these y=Ax products,
   // x is the src field, and y is the overlapped tgt field.
-  for (int i=0; i<m_num_fields; ++i) {
-    if (m_needs_remap[i]==0) {
-      // No need to do a mat-vec here. Just deep copy and move on
-      m_tgt_fields[i].deep_copy(m_src_fields[i]);
-      continue;
-    }
+  const int num_groups = m_group_f_beg.size()-1;
+  for (int g=0; g<num_groups; ++g) {
+    for (int i=m_group_f_beg[g]; i<m_group_f_beg[g+1]; ++i) {
+      if (m_needs_remap[i]==0) {
+        // No need to do a mat-vec here. Just deep copy and move on
+        m_tgt_fields[i].deep_copy(m_src_fields[i]);
+        continue;
+      }
 
-    const auto& f_src = m_src_fields[i];
-    const auto& f_ov  = m_ov_fields[i];
+      const auto& f_src = m_src_fields[i];
+      const auto& f_ov  = m_ov_fields[i];
 
-    const bool masked = m_track_mask and f_src.get_header().has_extra_data("mask_field");
-    if (masked) {
-      // Pass the mask to the local_mat_vec routine
-      const auto& mask = f_src.get_header().get_extra_data<Field>("mask_field");
+      const bool masked = m_track_mask and f_src.get_header().has_extra_data("mask_field");
+      if (masked) {
+        // Pass the mask to the local_mat_vec routine
+        const auto& mask = f_src.get_header().get_extra_data<Field>("mask_field");
 
-      // If possible, dispatch kernel with SCREAM_PACK_SIZE
-      if (can_pack_field(f_src) and can_pack_field(f_ov) and can_pack_field(mask)) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov,mask);
-      } else {
-        local_mat_vec<1>(f_src,f_ov,mask);
-      }
-    } else {
-      // If possible, dispatch kernel with SCREAM_PACK_SIZE
-      if (can_pack_field(f_src) and can_pack_field(f_ov)) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov);
+        // If possible, dispatch kernel with SCREAM_PACK_SIZE
+        if (can_pack_field(f_src) and can_pack_field(f_ov) and can_pack_field(mask)) {
+          local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov,mask);
+        } else {
+          local_mat_vec<1>(f_src,f_ov,mask);
+        }
       } else {
-        local_mat_vec<1>(f_src,f_ov);
+        // If possible, dispatch kernel with SCREAM_PACK_SIZE
+        if (can_pack_field(f_src) and can_pack_field(f_ov)) {
+          local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov);
+        } else {
+          local_mat_vec<1>(f_src,f_ov);
+        }
       }
     }
-  }
 
-  // Pack, then fire off the sends
-  pack_and_send ();
+    // Pack, then fire off the sends for this group
+    pack_and_send (g);
+  }
 
-  // Wait for all data to be received, then unpack
-  recv_and_unpack ();
+  // Wait for the data of each group to be received, then unpack it. Groups
+  // are processed in the same order they were sent, so that we can start
+  // unpacking the first groups while the last ones are still in flight.
+  for (int g=0; g<num_groups; ++g) {
+    recv_and_unpack (g);
+  }
 
   // Wait for all sends to be completed
   if (not m_send_req.empty()) {
@@ -565,7 +574,7 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
   }
 }
 
-void CoarseningRemapper::pack_and_send ()
+void CoarseningRemapper::pack (const int ifield)
 {
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
@@ -576,134 +585,157 @@ void CoarseningRemapper::pack_and_send ()
   const auto lids_pids = m_send_lids_pids;
   const auto buf = m_send_buffer;
 
-  for (int ifield=0; ifield<m_num_fields; ++ifield) {
-    if (m_needs_remap[ifield]==0)
-      continue; // Not a field to coarsen
+  const auto& f  = m_ov_fields[ifield];
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  const auto f_pid_offsets = ekat::subview(m_send_f_pid_offsets,ifield);
 
-    const auto& f  = m_ov_fields[ifield];
-    const auto& fl = f.get_header().get_identifier().get_layout();
-    const auto f_pid_offsets = ekat::subview(m_send_f_pid_offsets,ifield);
-
-    switch (fl.rank()) {
-      case 1:
-      {
-        // Unlike get_view, get_strided_view returns a LayoutStride view,
-        // therefore allowing the 1d field to be a subfield of a 2d field
-        // along the 2nd dimension.
-        auto v = f.get_strided_view<const Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_send_gids),
-                             KOKKOS_LAMBDA(const int& i){
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
-
-          buf (offset + lidpos) = v(lid);
-        });
-      } break;
-      case 2:
-      {
-        auto v = f.get_view<const Real**>();
-        const int dim1 = fl.dim(1);
-        auto policy = TPF::get_default_team_policy(num_send_gids,dim1);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
+  switch (fl.rank()) {
+    case 1:
+    {
+      // Unlike get_view, get_strided_view returns a LayoutStride view,
+      // therefore allowing the 1d field to be a subfield of a 2d field
+      // along the 2nd dimension.
+      auto v = f.get_strided_view<const Real*>();
+      Kokkos::parallel_for(RangePolicy(0,num_send_gids),
+                           KOKKOS_LAMBDA(const int& i){
+        const int lid = lids_pids(i,0);
+        const int pid = lids_pids(i,1);
+        const int lidpos = i - pid_lid_start(pid);
+        const int offset = f_pid_offsets(pid);
+
+        buf (offset + lidpos) = v(lid);
+      });
+    } break;
+    case 2:
+    {
+      auto v = f.get_view<const Real**>();
+      const int dim1 = fl.dim(1);
+      auto policy = TPF::get_default_team_policy(num_send_gids,dim1);
+      Kokkos::parallel_for(policy,
+                           KOKKOS_LAMBDA(const MemberType& team){
+        const int i = team.league_rank();
+        const int lid = lids_pids(i,0);
+        const int pid = lids_pids(i,1);
+        const int lidpos = i - pid_lid_start(pid);
+        const int offset = f_pid_offsets(pid);
 
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1),
-                               [&](const int idim) {
-            buf(offset + lidpos*dim1 + idim) = v(lid,idim);
-          });
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1),
+                             [&](const int idim) {
+          buf(offset + lidpos*dim1 + idim) = v(lid,idim);
         });
-      } break;
-      case 3:
-      {
-        auto v = f.get_view<const Real***>();
-        const int dim1 = fl.dim(1);
-        const int dim2 = fl.dim(2);
-        auto policy = TPF::get_default_team_policy(num_send_gids,dim1*dim2);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
+      });
+    } break;
+    case 3:
+    {
+      auto v = f.get_view<const Real***>();
+      const int dim1 = fl.dim(1);
+      const int dim2 = fl.dim(2);
+      auto policy = TPF::get_default_team_policy(num_send_gids,dim1*dim2);
+      Kokkos::parallel_for(policy,
+                           KOKKOS_LAMBDA(const MemberType& team){
+        const int i = team.league_rank();
+        const int lid = lids_pids(i,0);
+        const int pid = lids_pids(i,1);
+        const int lidpos = i - pid_lid_start(pid);
+        const int offset = f_pid_offsets(pid);
 
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1*dim2),
-                               [&](const int idx) {
-            const int idim = idx / dim2;
-            const int ilev = idx % dim2;
-            buf(offset + lidpos*dim1*dim2 + idim*dim2 + ilev) = v(lid,idim,ilev);
-          });
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1*dim2),
+                             [&](const int idx) {
+          const int idim = idx / dim2;
+          const int ilev = idx % dim2;
+          buf(offset + lidpos*dim1*dim2 + idim*dim2 + ilev) = v(lid,idim,ilev);
         });
-      } break;
-      case 4:
-      {
-        auto v = f.get_view<const Real****>();
-        const int dim1 = fl.dim(1);
-        const int dim2 = fl.dim(2);
-        const int dim3 = fl.dim(3);
-        auto policy = TPF::get_default_team_policy(num_send_gids,dim1*dim2*dim3);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
+      });
+    } break;
+    case 4:
+    {
+      auto v = f.get_view<const Real****>();
+      const int dim1 = fl.dim(1);
+      const int dim2 = fl.dim(2);
+      const int dim3 = fl.dim(3);
+      auto policy = TPF::get_default_team_policy(num_send_gids,dim1*dim2*dim3);
+      Kokkos::parallel_for(policy,
+                           KOKKOS_LAMBDA(const MemberType& team){
+        const int i = team.league_rank();
+        const int lid = lids_pids(i,0);
+        const int pid = lids_pids(i,1);
+        const int lidpos = i - pid_lid_start(pid);
+        const int offset = f_pid_offsets(pid);
 
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1*dim2*dim3),
-                               [&](const int idx) {
-            const int idim = (idx / dim3) / dim2;
-            const int jdim = (idx / dim3) % dim2;
-            const int ilev =  idx % dim3;
-            buf(offset + lidpos*dim1*dim2*dim3 + idim*dim2*dim3 + jdim*dim3 + ilev) = v(lid,idim,jdim,ilev);
-          });
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1*dim2*dim3),
+                             [&](const int idx) {
+          const int idim = (idx / dim3) / dim2;
+          const int jdim = (idx / dim3) % dim2;
+          const int ilev =  idx % dim3;
+          buf(offset + lidpos*dim1*dim2*dim3 + idim*dim2*dim3 + jdim*dim3 + ilev) = v(lid,idim,jdim,ilev);
         });
-      } break;
+      });
+    } break;
 
-      default:
-        EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::pack.\n"
-            "  - MPI rank  : " + std::to_string(m_comm.rank()) + "\n"
-            "  - field name: " + f.name() + "\n"
-            "  - field rank: " + std::to_string(fl.rank()) + "\n");
+    default:
+      EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::pack.\n"
+          "  - MPI rank  : " + std::to_string(m_comm.rank()) + "\n"
+          "  - field name: " + f.name() + "\n"
+          "  - field rank: " + std::to_string(fl.rank()) + "\n");
+  }
+}
+
+void CoarseningRemapper::pack_and_send (const int igroup)
+{
+  for (int i=m_group_f_beg[igroup]; i<m_group_f_beg[igroup+1]; ++i) {
+    if (m_needs_remap[i]!=0) {
+      pack(i);
     }
   }
 
   // Ensure all threads are done packing before firing off the sends
   Kokkos::fence();
 
-  // If MPI does not use dev pointers, we need to deep copy from dev to host
+  // If MPI does not use dev pointers, we need to deep copy from dev to host.
+  // Only copy the portion of the buffer that stores this group.
   if (not MpiOnDev) {
-    Kokkos::deep_copy (m_mpi_send_buffer,m_send_buffer);
+    const auto range = Kokkos::make_pair(m_send_g_offsets[igroup],m_send_g_offsets[igroup+1]);
+    Kokkos::deep_copy (Kokkos::subview(m_mpi_send_buffer,range),
+                       Kokkos::subview(m_send_buffer,range));
   }
 
-  if (not m_send_req.empty()) {
-    int ierr = MPI_Startall(m_send_req.size(),m_send_req.data());
+  const int req_beg = m_send_req_g_beg[igroup];
+  const int num_req = m_send_req_g_beg[igroup+1] - req_beg;
+  if (num_req>0) {
+    int ierr = MPI_Startall(num_req,m_send_req.data()+req_beg);
     EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
         "Error! Something whent wrong while starting persistent send requests.\n"
         "  - send rank: " + std::to_string(m_comm.rank()) + "\n");
   }
 }
 
-void CoarseningRemapper::recv_and_unpack ()
+void CoarseningRemapper::recv_and_unpack (const int igroup)
 {
-  if (not m_recv_req.empty()) {
-    int ierr = MPI_Waitall(m_recv_req.size(),m_recv_req.data(), MPI_STATUSES_IGNORE);
+  const int req_beg = m_recv_req_g_beg[igroup];
+  const int num_req = m_recv_req_g_beg[igroup+1] - req_beg;
+  if (num_req>0) {
+    int ierr = MPI_Waitall(num_req,m_recv_req.data()+req_beg, MPI_STATUSES_IGNORE);
     EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
         "Error! Something whent wrong while waiting on persistent recv requests.\n"
         "  - recv rank: " + std::to_string(m_comm.rank()) + "\n");
   }
-  // If MPI does not use dev pointers, we need to deep copy from host to dev
+  // If MPI does not use dev pointers, we need to deep copy from host to dev.
+  // Only copy the portion of the buffer that stores this group.
   if (not MpiOnDev) {
-    Kokkos::deep_copy (m_recv_buffer,m_mpi_recv_buffer);
+    const auto range = Kokkos::make_pair(m_recv_g_offsets[igroup],m_recv_g_offsets[igroup+1]);
+    Kokkos::deep_copy (Kokkos::subview(m_recv_buffer,range),
+                       Kokkos::subview(m_mpi_recv_buffer,range));
   }
 
+  for (int i=m_group_f_beg[igroup]; i<m_group_f_beg[igroup+1]; ++i) {
+    if (m_needs_remap[i]!=0) {
+      unpack(i);
+    }
+  }
+}
+
+void CoarseningRemapper::unpack (const int ifield)
+{
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
   using TPF         = ekat::TeamPolicyFactory<DefaultDevice::execution_space>;
@@ -714,114 +746,110 @@ void CoarseningRemapper::recv_and_unpack ()
   const auto recv_lids_beg = m_recv_lids_beg;
   const auto recv_lids_end = m_recv_lids_end;
   const auto recv_lids_pidpos = m_recv_lids_pidpos;
-  for (int ifield=0; ifield<m_num_fields; ++ifield) {
-    if (m_needs_remap[ifield]==0)
-      continue; // Not a field to coarsen
 
-          auto& f  = m_tgt_fields[ifield];
-    const auto& fl = f.get_header().get_identifier().get_layout();
-    const auto f_pid_offsets = ekat::subview(m_recv_f_pid_offsets,ifield);
-
-    f.deep_copy(0);
-    switch (fl.rank()) {
-      case 1:
-      {
-        // Unlike get_view, get_strided_view returns a LayoutStride view,
-        // therefore allowing the 1d field to be a subfield of a 2d field
-        // along the 2nd dimension.
-        auto v = f.get_strided_view<Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_tgt_dofs),
-                             KOKKOS_LAMBDA(const int& lid){
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos;
-            v(lid) += buf (offset);
-          }
-        });
-      } break;
-      case 2:
-      {
-        auto v = f.get_view<Real**>();
-        const int dim1 = fl.dim(1);
-        auto policy = TPF::get_default_team_policy(num_tgt_dofs,dim1);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int lid = team.league_rank();
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid)+lidpos*dim1;
-            Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1),
-                                 [&](const int idim) {
-              v(lid,idim) += buf (offset + idim);
-            });
-          }
-        });
-      } break;
-      case 3:
-      {
-        auto v = f.get_view<Real***>();
-        const int dim1 = fl.dim(1);
-        const int dim2 = fl.dims().back();
-        auto policy = TPF::get_default_team_policy(num_tgt_dofs,dim2*dim1);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int lid = team.league_rank();
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos*dim1*dim2;
-
-            Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim2*dim1),
-                                 [&](const int idx) {
-              const int idim = idx / dim2;
-              const int ilev = idx % dim2;
-              v(lid,idim,ilev) += buf (offset + idim*dim2 + ilev);
-            });
-          }
-        });
-      } break;
-
-      case 4:
-      {
-        auto v = f.get_view<Real****>();
-        const int dim1 = fl.dim(1);
-        const int dim2 = fl.dim(2);
-        const int dim3 = fl.dim(3);
-        auto policy = TPF::get_default_team_policy(num_tgt_dofs,dim1*dim2*dim3);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int lid = team.league_rank();
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos*dim1*dim2*dim3;
+        auto& f  = m_tgt_fields[ifield];
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  const auto f_pid_offsets = ekat::subview(m_recv_f_pid_offsets,ifield);
 
-            Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1*dim2*dim3),
-                                 [&](const int idx) {
-              const int idim = (idx / dim3) / dim2;
-              const int jdim = (idx / dim3) % dim2;
-              const int ilev =  idx % dim3;
-              v(lid,idim,jdim,ilev) += buf (offset + idim*dim2*dim3 + jdim*dim3 + ilev);
-            });
-          }
-        });
-      } break;
+  f.deep_copy(0);
+  switch (fl.rank()) {
+    case 1:
+    {
+      // Unlike get_view, get_strided_view returns a LayoutStride view,
+      // therefore allowing the 1d field to be a subfield of a 2d field
+      // along the 2nd dimension.
+      auto v = f.get_strided_view<Real*>();
+      Kokkos::parallel_for(RangePolicy(0,num_tgt_dofs),
+                           KOKKOS_LAMBDA(const int& lid){
+        const int recv_beg = recv_lids_beg(lid);
+        const int recv_end = recv_lids_end(lid);
+        for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
+          const int pid = recv_lids_pidpos(irecv,0);
+          const int lidpos = recv_lids_pidpos(irecv,1);
+          const int offset = f_pid_offsets(pid) + lidpos;
+          v(lid) += buf (offset);
+        }
+      });
+    } break;
+    case 2:
+    {
+      auto v = f.get_view<Real**>();
+      const int dim1 = fl.dim(1);
+      auto policy = TPF::get_default_team_policy(num_tgt_dofs,dim1);
+      Kokkos::parallel_for(policy,
+                           KOKKOS_LAMBDA(const MemberType& team){
+        const int lid = team.league_rank();
+        const int recv_beg = recv_lids_beg(lid);
+        const int recv_end = recv_lids_end(lid);
+        for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
+          const int pid = recv_lids_pidpos(irecv,0);
+          const int lidpos = recv_lids_pidpos(irecv,1);
+          const int offset = f_pid_offsets(pid)+lidpos*dim1;
+          Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1),
+                               [&](const int idim) {
+            v(lid,idim) += buf (offset + idim);
+          });
+        }
+      });
+    } break;
+    case 3:
+    {
+      auto v = f.get_view<Real***>();
+      const int dim1 = fl.dim(1);
+      const int dim2 = fl.dims().back();
+      auto policy = TPF::get_default_team_policy(num_tgt_dofs,dim2*dim1);
+      Kokkos::parallel_for(policy,
+                           KOKKOS_LAMBDA(const MemberType& team){
+        const int lid = team.league_rank();
+        const int recv_beg = recv_lids_beg(lid);
+        const int recv_end = recv_lids_end(lid);
+        for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
+          const int pid = recv_lids_pidpos(irecv,0);
+          const int lidpos = recv_lids_pidpos(irecv,1);
+          const int offset = f_pid_offsets(pid) + lidpos*dim1*dim2;
+
+          Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim2*dim1),
+                               [&](const int idx) {
+            const int idim = idx / dim2;
+            const int ilev = idx % dim2;
+            v(lid,idim,ilev) += buf (offset + idim*dim2 + ilev);
+          });
+        }
+      });
+    } break;
 
-      default:
-        EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::pack.\n"
-            "  - MPI rank  : " + std::to_string(m_comm.rank()) + "\n"
-            "  - field rank: " + std::to_string(fl.rank()) + "\n");
-    }
+    case 4:
+    {
+      auto v = f.get_view<Real****>();
+      const int dim1 = fl.dim(1);
+      const int dim2 = fl.dim(2);
+      const int dim3 = fl.dim(3);
+      auto policy = TPF::get_default_team_policy(num_tgt_dofs,dim1*dim2*dim3);
+      Kokkos::parallel_for(policy,
+                           KOKKOS_LAMBDA(const MemberType& team){
+        const int lid = team.league_rank();
+        const int recv_beg = recv_lids_beg(lid);
+        const int recv_end = recv_lids_end(lid);
+        for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
+          const int pid = recv_lids_pidpos(irecv,0);
+          const int lidpos = recv_lids_pidpos(irecv,1);
+          const int offset = f_pid_offsets(pid) + lidpos*dim1*dim2*dim3;
+
+          Kokkos::parallel_for(Kokkos::TeamVectorRange(team,dim1*dim2*dim3),
+                               [&](const int idx) {
+            const int idim = (idx / dim3) / dim2;
+            const int jdim = (idx / dim3) % dim2;
+            const int ilev =  idx % dim3;
+            v(lid,idim,jdim,ilev) += buf (offset + idim*dim2*dim3 + jdim*dim3 + ilev);
+          });
+        }
+      });
+    } break;
+
+    default:
+      EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::unpack.\n"
+          "  - MPI rank  : " + std::to_string(m_comm.rank()) + "\n"
+          "  - field rank: " + std::to_string(fl.rank()) + "\n");
   }
 }
 
@@ -926,11 +954,10 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   const auto mpi_comm  = m_comm.mpi_comm();
   const auto mpi_real  = ekat::get_mpi_type<Real>();
 
-  const int last_rank = m_comm.size()-1;
-
   // Pre-compute the amount of data stored in each field on each dof
   std::vector<int> field_col_size (m_num_fields);
   int sum_fields_col_sizes = 0;
+  int num_remapped_fields = 0;
   for (int i=0; i<m_num_fields; ++i) {
     if (m_needs_remap[i]==0)
       continue;
@@ -939,6 +966,7 @@ void CoarseningRemapper::setup_mpi_data_structures ()
     const auto& fl = f.get_header().get_identifier().get_layout();
     field_col_size[i] = fl.clone().strip_dim(COL).size();
     sum_fields_col_sizes += field_col_size[i];
+    ++num_remapped_fields;
   }
 
   // --------------------------------------------------------- //
@@ -974,48 +1002,71 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   Kokkos::deep_copy(m_send_lids_pids,send_lids_pids_h);
   Kokkos::deep_copy(m_send_pid_lids_start,send_pid_lids_start_h);
 
-  // 3. Compute offsets in send buffer for each pid/field pair
-  m_send_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
-  auto send_f_pid_offsets_h = Kokkos::create_mirror_view(m_send_f_pid_offsets);
-  std::vector<int> send_pid_offsets(m_comm.size());
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    send_pid_offsets[pid] = pos;
-    for (int i=0; i<m_num_fields; ++i) {
-      if (m_needs_remap[i]==0)
-        continue;
-
-      send_f_pid_offsets_h(i,pid) = pos;
-      pos += field_col_size[i]*pid2lids_send[pid].size();
+  // 3. Split the fields in groups of contiguous fields, with roughly the same amount
+  //    of data, then compute offsets in send buffer for each field/pid pair.
+  //    NOTE: data is stored group-major, then pid-major, so that each group can be
+  //          packed and sent independently of the others, with one message per pid.
+  const int num_groups = std::max(1,std::min(s_max_num_groups,num_remapped_fields));
+  m_group_f_beg.assign(num_groups+1,m_num_fields);
+  m_group_f_beg[0] = 0;
+  for (int i=0,g=0,accum=0; i<m_num_fields; ++i) {
+    // Start a new group once the current one holds its share of the data
+    if (g+1<num_groups and accum*num_groups>=(g+1)*sum_fields_col_sizes) {
+      m_group_f_beg[++g] = i;
     }
+    accum += field_col_size[i];
+  }
 
-    // At the end, pos must match the total amount of data in the overlapped fields
-    if (pid==last_rank) {
-      EKAT_REQUIRE_MSG (pos==num_ov_gids*sum_fields_col_sizes,
-          "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
+  const int nranks = m_comm.size();
+  m_send_f_pid_offsets = view_2d<int>("",m_num_fields,nranks);
+  auto send_f_pid_offsets_h = Kokkos::create_mirror_view(m_send_f_pid_offsets);
+  m_send_g_offsets.resize(num_groups+1);
+  std::vector<int> send_g_pid_offsets(num_groups*(nranks+1));
+  for (int g=0,pos=0; g<num_groups; ++g) {
+    m_send_g_offsets[g] = pos;
+    for (int pid=0; pid<nranks; ++pid) {
+      send_g_pid_offsets[g*(nranks+1)+pid] = pos;
+      for (int i=m_group_f_beg[g]; i<m_group_f_beg[g+1]; ++i) {
+        if (m_needs_remap[i]!=0) {
+          send_f_pid_offsets_h(i,pid) = pos;
+          pos += field_col_size[i]*pid2lids_send[pid].size();
+        }
+      }
     }
+    send_g_pid_offsets[g*(nranks+1)+nranks] = pos;
+    m_send_g_offsets[g+1] = pos;
   }
+  // At the end, pos must match the total amount of data in the overlapped fields
+  EKAT_REQUIRE_MSG (m_send_g_offsets.back()==num_ov_gids*sum_fields_col_sizes,
+      "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
   Kokkos::deep_copy (m_send_f_pid_offsets,send_f_pid_offsets_h);
 
   // 4. Allocate send buffers
   m_send_buffer = view_1d<Real>("",sum_fields_col_sizes*num_ov_gids);
   m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
 
-  // 5. Setup send requests
-  m_send_req.reserve(num_send_pids);
-  for (const auto& it : pid2lids_send) {
-    const int n = it.second.size()*sum_fields_col_sizes;
-    if (n==0) {
-      continue;
-    }
+  // 5. Setup send requests, one per group/pid pair, using the group index as tag.
+  //    Requests are sorted by group, so we can start them one group at a time.
+  m_send_req.reserve(num_send_pids*num_groups);
+  m_send_req_g_beg.resize(num_groups+1);
+  for (int g=0; g<num_groups; ++g) {
+    m_send_req_g_beg[g] = m_send_req.size();
+    for (int pid=0; pid<nranks; ++pid) {
+      const int beg = send_g_pid_offsets[g*(nranks+1)+pid];
+      const int n = send_g_pid_offsets[g*(nranks+1)+pid+1] - beg;
+      if (n==0) {
+        continue;
+      }
 
-    const int pid = it.first;
-    const auto send_ptr = m_mpi_send_buffer.data() + send_pid_offsets[pid];
+      const auto send_ptr = m_mpi_send_buffer.data() + beg;
 
-    m_send_req.emplace_back();
-    auto& req = m_send_req.back();
-    MPI_Send_init (send_ptr, n, mpi_real, pid,
-                   0, mpi_comm, &req);
+      m_send_req.emplace_back();
+      auto& req = m_send_req.back();
+      MPI_Send_init (send_ptr, n, mpi_real, pid,
+                     g, mpi_comm, &req);
+    }
   }
+  m_send_req_g_beg[num_groups] = m_send_req.size();
 
   // --------------------------------------------------------- //
   //                   Setup RECV structures                   //
@@ -1030,11 +1081,11 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   // 2. Convert the gids to lids, and arrange them by lid
   std::vector<std::vector<int>> lid2pids_recv(num_tgt_dofs);
   int num_total_recv_gids = 0;
-  auto tgt_gid2lid = m_tgt_grid->get_gid2lid_map();
+  const auto& tgt_gid2lid = m_tgt_grid->get_gid2lid_index<Host>();
   for (const auto& it : pid2gids_recv) {
     const int pid = it.first;
     for (auto gid : it.second) {
-      const int lid = tgt_gid2lid[gid];
+      const int lid = tgt_gid2lid.lid(gid);
       lid2pids_recv[lid].push_back(pid);
     }
     num_total_recv_gids += it.second.size();
@@ -1074,49 +1125,56 @@ void CoarseningRemapper::setup_mpi_data_structures ()
     pos += pid2gids_recv[pid].size();
   }
 
-  // 4. Compute offsets in recv buffer for each pid/field pair
-  m_recv_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
+  // 4. Compute offsets in recv buffer for each field/pid pair (group-major, as for sends)
+  m_recv_f_pid_offsets = view_2d<int>("",m_num_fields,nranks);
   auto recv_f_pid_offsets_h = Kokkos::create_mirror_view(m_recv_f_pid_offsets);
-  std::vector<int> recv_pid_offsets(m_comm.size());
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    recv_pid_offsets[pid] = pos;
-    const int num_recv_gids = recv_pid_start[pid+1] - recv_pid_start[pid];
-    for (int i=0; i<m_num_fields; ++i) {
-      if (m_needs_remap[i]==0)
-        continue;
-
-      recv_f_pid_offsets_h(i,pid) = pos;
-      pos += field_col_size[i]*num_recv_gids;
-    }
-
-    // // At the end, pos must match the total amount of data received
-    if (pid==last_rank) {
-      EKAT_REQUIRE_MSG (pos==num_total_recv_gids*sum_fields_col_sizes,
-          "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
+  m_recv_g_offsets.resize(num_groups+1);
+  std::vector<int> recv_g_pid_offsets(num_groups*(nranks+1));
+  for (int g=0,pos=0; g<num_groups; ++g) {
+    m_recv_g_offsets[g] = pos;
+    for (int pid=0; pid<nranks; ++pid) {
+      const int num_recv_gids = recv_pid_start[pid+1] - recv_pid_start[pid];
+      recv_g_pid_offsets[g*(nranks+1)+pid] = pos;
+      for (int i=m_group_f_beg[g]; i<m_group_f_beg[g+1]; ++i) {
+        if (m_needs_remap[i]!=0) {
+          recv_f_pid_offsets_h(i,pid) = pos;
+          pos += field_col_size[i]*num_recv_gids;
+        }
+      }
     }
+    recv_g_pid_offsets[g*(nranks+1)+nranks] = pos;
+    m_recv_g_offsets[g+1] = pos;
   }
+  // At the end, pos must match the total amount of data received
+  EKAT_REQUIRE_MSG (m_recv_g_offsets.back()==num_total_recv_gids*sum_fields_col_sizes,
+      "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
   Kokkos::deep_copy (m_recv_f_pid_offsets,recv_f_pid_offsets_h);
 
   // 5. Allocate recv buffers
   m_recv_buffer = view_1d<Real>("",sum_fields_col_sizes*num_total_recv_gids);
   m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
 
-  // 6. Setup recv requests
-  m_recv_req.reserve(num_recv_pids);
-  for (int pid=0; pid<m_comm.size(); ++pid) {
-    const int num_recv_gids = recv_pid_start[pid+1] - recv_pid_start[pid];
-    const int n = num_recv_gids*sum_fields_col_sizes;
-    if (n==0) {
-      continue;
-    }
+  // 6. Setup recv requests, one per group/pid pair, sorted by group (see sends)
+  m_recv_req.reserve(num_recv_pids*num_groups);
+  m_recv_req_g_beg.resize(num_groups+1);
+  for (int g=0; g<num_groups; ++g) {
+    m_recv_req_g_beg[g] = m_recv_req.size();
+    for (int pid=0; pid<nranks; ++pid) {
+      const int beg = recv_g_pid_offsets[g*(nranks+1)+pid];
+      const int n = recv_g_pid_offsets[g*(nranks+1)+pid+1] - beg;
+      if (n==0) {
+        continue;
+      }
 
-    const auto recv_ptr = m_mpi_recv_buffer.data() + recv_pid_offsets[pid];
+      const auto recv_ptr = m_mpi_recv_buffer.data() + beg;
 
-    m_recv_req.emplace_back();
-    auto& req = m_recv_req.back();
-    MPI_Recv_init (recv_ptr, n, mpi_real, pid,
-                   0, mpi_comm, &req);
+      m_recv_req.emplace_back();
+      auto& req = m_recv_req.back();
+      MPI_Recv_init (recv_ptr, n, mpi_real, pid,
+                     g, mpi_comm, &req);
+    }
   }
+  m_recv_req_g_beg[num_groups] = m_recv_req.size();
 }
 
 void CoarseningRemapper::clean_up ()
@@ -1133,6 +1191,11 @@ void CoarseningRemapper::clean_up ()
   m_recv_lids_pidpos    = view_2d<int>();
   m_recv_lids_beg       = view_1d<int>();
   m_recv_lids_end       = view_1d<int>();
+  m_group_f_beg.clear();
+  m_send_g_offsets.clear();
+  m_recv_g_offsets.clear();
+  m_send_req_g_beg.clear();
+  m_recv_req_g_beg.clear();
   m_send_req.clear();
   m_recv_req.clear();
 
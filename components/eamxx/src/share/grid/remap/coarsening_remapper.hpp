@@ -36,6 +36,12 @@ namespace scream
  * The setup as well as the runtime operations use classic send/recv
  * MPI calls, where data is packed in a buffer and sent to the recv rank,
  * where it is then unpacked and accumulated into the result.
+ * At runtime, we use persistent requests. Fields are split in (at most)
+ * s_max_num_groups groups of contiguous fields, with one message per group/pid
+ * pair, so that the number of messages does not grow with the number of fields.
+ * The two stages above are pipelined group by group: the sends for a group
+ * are started as soon as the local mat-vecs of its fields are done, so that its
+ * communication overlaps with the local mat-vecs of the following groups.
  */
 
 class CoarseningRemapper : public HorizInterpRemapperBase
@@ -77,8 +83,10 @@ public:
   void local_mat_vec (const Field& f_src, const Field& f_tgt, const Field& mask) const;
   template<int N>
   void rescale_masked_fields (const Field& f_tgt, const Field& f_mask) const;
-  void pack_and_send ();
-  void recv_and_unpack ();
+  void pack (const int ifield);
+  void unpack (const int ifield);
+  void pack_and_send (const int igroup);
+  void recv_and_unpack (const int igroup);
   // Overload, not hide
   using HorizInterpRemapperBase::local_mat_vec;
 
@@ -86,6 +94,9 @@ protected:
 
   static constexpr bool MpiOnDev = SCREAM_MPI_ON_DEVICE;
 
+  // Max number of field groups pipelined in remap_fwd_impl
+  static constexpr int s_max_num_groups = 4;
+
   // If MpiOnDev=true, we can pass device pointers to MPI. Otherwise, we need host mirrors.
   template<typename T>
   using mpi_view_1d = typename std::conditional<
@@ -108,12 +119,23 @@ protected:
   mpi_view_1d<Real>     m_mpi_send_buffer;
   mpi_view_1d<Real>     m_mpi_recv_buffer;
 
+  // Beginning of each group of fields (with an extra entry at the end).
+  // The fields of group g are those in the range [group_f_beg[g],group_f_beg[g+1]).
+  std::vector<int>      m_group_f_beg;
+
   // Offset of each field on each PID in send/recv buffers.
   // E.g., offset(3,2)=10 means the offset of data from field 3
   //       to be sent to PID 2 is 10.
+  // NOTE: data is stored group-major, then pid-major, so all the data of a group
+  //       to be sent to (or received from) a given PID is contiguous.
   view_2d<int>          m_send_f_pid_offsets;
   view_2d<int>          m_recv_f_pid_offsets;
 
+  // Offset of each group in the send/recv buffers (with an extra entry at the end).
+  // Used to copy only a single group's data between host and device buffers.
+  std::vector<int>      m_send_g_offsets;
+  std::vector<int>      m_recv_g_offsets;
+
   // Reorder the lids so that all lids to send to PID n
   // come before those for PID N+1. The meaning is
   //   lids_pids(i,0) = ith lid to send to PID=lids_pids(i,1)
@@ -142,9 +164,12 @@ protected:
   view_1d<int>          m_recv_lids_beg;
   view_1d<int>          m_recv_lids_end;
 
-  // Send/recv requests
+  // Send/recv requests, sorted by group. The requests for group g are
+  // those in the range [req_g_beg[g],req_g_beg[g+1]).
   std::vector<MPI_Request>  m_recv_req;
   std::vector<MPI_Request>  m_send_req;
+  std::vector<int>          m_recv_req_g_beg;
+  std::vector<int>          m_send_req_g_beg;
 };
 
 } // namespace scream
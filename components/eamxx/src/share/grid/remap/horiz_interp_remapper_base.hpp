@@ -71,6 +71,7 @@ public:
   // Keep track of this, since we need to tell the remap data repo
   // we are releasing the data for our map file.
   std::string     m_map_file;
+  std::string     m_remapper_data_key;
 
   InterpType      m_type;
 
@@ -80,6 +81,7 @@ public:
   // NOTE: use int and NOT bool, as vector<bool> is evil
   std::vector<int>    m_needs_remap;
 
+  // Remap data shared by all remappers, indexed by HorizRemapperData::cache_key
   static std::map<std::string,HorizRemapperData> s_remapper_data;
 };
 
@@ -4,12 +4,31 @@
 #include "share/grid/grid_import_export.hpp"
 #include "share/io/eamxx_scorpio_interface.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
 #include <numeric>
 
 namespace scream {
 
 // --------------- HorizRemapperData ---------------- //
 
+std::string HorizRemapperData::s_partitioned_maps_dir = "";
+int         HorizRemapperData::s_num_partitioned_loads = 0;
+
+std::string HorizRemapperData::
+cache_key (const std::string& map_file,
+           const std::shared_ptr<const AbstractGrid>& fine_grid,
+           const ekat::Comm& comm,
+           const InterpType type)
+{
+  return map_file + "|" + fine_grid->name()
+                  + "|" + std::to_string(fine_grid->get_num_global_dofs())
+                  + "|" + std::to_string(comm.size())
+                  + "|" + (type==InterpType::Refine ? "refine" : "coarsen");
+}
+
 void HorizRemapperData::
 build (const std::string& map_file,
        const std::shared_ptr<const AbstractGrid>& fine_grid_in,
@@ -20,8 +39,16 @@ build (const std::string& map_file,
   fine_grid = fine_grid_in;
   type = type_in;
 
-  // Gather sparse matrix triplets needed by this rank
-  auto my_triplets = get_my_triplets (map_file);
+  // Gather sparse matrix triplets needed by this rank. If possible, load them
+  // from a pre-partitioned file, skipping the read/redistribution of the map.
+  std::vector<Triplet> my_triplets;
+  const bool use_partitioned = s_partitioned_maps_dir!="";
+  if (not use_partitioned or not read_partitioned_triplets(map_file,my_triplets)) {
+    my_triplets = get_my_triplets (map_file);
+    if (use_partitioned) {
+      write_partitioned_triplets(map_file,my_triplets);
+    }
+  }
 
   // Create coarse/ov_coarse grids
   create_coarse_grids (my_triplets);
@@ -45,6 +72,8 @@ get_my_triplets (const std::string& map_file) const
   scorpio::change_var_dtype(map_file,"col","int");
 
   // Decompose n_s dim linearly across ranks
+  // NOTE: do not use the node read cache here: the triplets are split along n_s,
+  //       so a decomposed read is cheaper than staging the whole map on each node.
   scorpio::set_dim_decomp (map_file,"n_s");
   int nlweights = scorpio::get_dimlen_local(map_file,"n_s");
 
@@ -102,10 +131,14 @@ get_my_triplets (const std::string& map_file) const
 
   // Create Triplets to export, sorted by gid
   std::map<int,std::vector<Triplet>> io_triplets;
-  const auto& io_grid_gid2lid = io_grid->get_gid2lid_map();
+  const auto& io_grid_gid2lid = io_grid->get_gid2lid_index<Host>();
   for (int i=0; i<nlweights; ++i) {
     auto gid = gids[i];
-    auto io_lid = io_grid_gid2lid.at(gid);
+    auto io_lid = io_grid_gid2lid.lid(gid);
+    EKAT_REQUIRE_MSG (io_lid>=0,
+        "Error! Triplet gid not found in the io grid.\n"
+        " - map file: " + map_file + "\n"
+        " - gid: " + std::to_string(gid) + "\n");
     io_triplets[io_lid].emplace_back(rows[i], cols[i], S[i]);
   }
 
@@ -142,6 +175,176 @@ get_my_triplets (const std::string& map_file) const
   return my_triplets;
 }
 
+std::string HorizRemapperData::
+get_partitioned_map_file (const std::string& map_file) const
+{
+  namespace fs = std::filesystem;
+  const auto stem = fs::path(map_file).stem().string();
+  const auto type_str = type==InterpType::Refine ? "refine" : "coarsen";
+  const auto fname = stem + "." + fine_grid->name() + "." + type_str
+                   + ".np" + std::to_string(comm.size()) + ".nc";
+  return (fs::path(s_partitioned_maps_dir) / fname).string();
+}
+
+int HorizRemapperData::
+get_fine_gids_hash () const
+{
+  // FNV-1a hash of the sorted gids (the order of the gids does not affect the triplets).
+  // Truncate to a positive int, so we can store it in the file as int.
+  auto gids_h = fine_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  std::vector<gid_type> gids (gids_h.data(),gids_h.data()+gids_h.size());
+  std::sort(gids.begin(),gids.end());
+
+  std::uint64_t h = 14695981039346656037ull;
+  for (auto gid : gids) {
+    h ^= static_cast<std::uint64_t>(gid);
+    h *= 1099511628211ull;
+  }
+  return static_cast<int>(h & 0x7fffffff);
+}
+
+std::string HorizRemapperData::
+get_map_file_fingerprint (const std::string& map_file) const
+{
+  // Only root queries the file system, to avoid hammering it with all ranks
+  namespace fs = std::filesystem;
+  long long size_mtime[2] = {0, 0};
+  if (comm.am_i_root()) {
+    size_mtime[0] = fs::file_size(map_file);
+    size_mtime[1] = fs::last_write_time(map_file).time_since_epoch().count();
+  }
+  MPI_Bcast(size_mtime,2,MPI_LONG_LONG,comm.root_rank(),comm.mpi_comm());
+  return std::to_string(size_mtime[0]) + ":" + std::to_string(size_mtime[1]);
+}
+
+bool HorizRemapperData::
+read_partitioned_triplets (const std::string& map_file,
+                           std::vector<Triplet>& triplets) const
+{
+  const auto filename = get_partitioned_map_file(map_file);
+
+  int exists = comm.am_i_root() ? std::filesystem::exists(filename) : 0;
+  comm.broadcast(&exists,1,comm.root_rank());
+  if (not exists) {
+    return false;
+  }
+
+  const auto fingerprint = get_map_file_fingerprint(map_file);
+  scorpio::register_file(filename,scorpio::FileMode::Read);
+
+  // Check that the file was generated from this map file (and its current content),
+  // for this fine grid and number of ranks
+  const auto type_str = type==InterpType::Refine ? "refine" : "coarsen";
+  const int nranks = comm.size();
+  bool match = scorpio::get_attribute<std::string>(filename,"GLOBAL","map_file")==map_file and
+               scorpio::has_attribute(filename,"GLOBAL","map_file_fingerprint") and
+               scorpio::get_attribute<std::string>(filename,"GLOBAL","map_file_fingerprint")==fingerprint and
+               scorpio::get_attribute<std::string>(filename,"GLOBAL","fine_grid_name")==fine_grid->name() and
+               scorpio::get_attribute<int>(filename,"GLOBAL","fine_grid_ncols")==fine_grid->get_num_global_dofs() and
+               scorpio::get_attribute<std::string>(filename,"GLOBAL","interp_type")==type_str and
+               scorpio::get_dimlen(filename,"n_ranks")==nranks;
+  if (not match) {
+    scorpio::release_file(filename);
+    return false;
+  }
+
+  // Check that the fine grid is partitioned in the same way
+  std::vector<int> rank_nnz(nranks), hashes(nranks);
+  scorpio::read_var(filename,"rank_nnz",rank_nnz.data());
+  scorpio::read_var(filename,"fine_gids_hash",hashes.data());
+  int my_match = hashes[comm.rank()]==get_fine_gids_hash() ? 1 : 0;
+  int all_match;
+  comm.all_reduce(&my_match,&all_match,1,MPI_MIN);
+  if (all_match==0) {
+    scorpio::release_file(filename);
+    return false;
+  }
+
+  // Read this rank's chunk of triplets
+  const int nnz = rank_nnz[comm.rank()];
+  const int offset = std::accumulate(rank_nnz.begin(),rank_nnz.begin()+comm.rank(),0);
+  scorpio::change_var_dtype(filename,"row","int");
+  scorpio::change_var_dtype(filename,"col","int");
+  scorpio::set_dim_decomp(filename,"n_s",offset,nnz);
+
+  // NOTE: add 1 so that we don't pass nullptr to scorpio read routines (see get_my_triplets)
+  std::vector<gid_type> rows(nnz+1), cols(nnz+1);
+  std::vector<Real> S(nnz+1);
+  scorpio::read_var(filename,"row",rows.data());
+  scorpio::read_var(filename,"col",cols.data());
+  scorpio::read_var(filename,"S"  ,S.data());
+  scorpio::release_file(filename);
+
+  triplets.clear();
+  triplets.reserve(nnz);
+  for (int i=0; i<nnz; ++i) {
+    triplets.emplace_back(rows[i],cols[i],S[i]);
+  }
+  ++s_num_partitioned_loads;
+  return true;
+}
+
+void HorizRemapperData::
+write_partitioned_triplets (const std::string& map_file,
+                            const std::vector<Triplet>& triplets) const
+{
+  const auto filename = get_partitioned_map_file(map_file);
+  const auto type_str = type==InterpType::Refine ? "refine" : "coarsen";
+
+  // Each rank stores its triplets contiguously, in rank order
+  const int nranks = comm.size();
+  const int my_nnz = triplets.size();
+  std::vector<int> rank_nnz(nranks), hashes(nranks);
+  rank_nnz[comm.rank()] = my_nnz;
+  hashes[comm.rank()] = get_fine_gids_hash();
+  comm.all_gather(rank_nnz.data(),1);
+  comm.all_gather(hashes.data(),1);
+  const int nnz = std::accumulate(rank_nnz.begin(),rank_nnz.end(),0);
+  const int offset = std::accumulate(rank_nnz.begin(),rank_nnz.begin()+comm.rank(),0);
+
+  // The folder may not exist yet (e.g., first run with this setting)
+  if (comm.am_i_root()) {
+    std::filesystem::create_directories(s_partitioned_maps_dir);
+  }
+  comm.barrier();
+
+  scorpio::register_file(filename,scorpio::FileMode::Write);
+
+  scorpio::define_dim(filename,"n_s",nnz);
+  scorpio::define_dim(filename,"n_ranks",nranks);
+
+  scorpio::define_var(filename,"row",{"n_s"},"int");
+  scorpio::define_var(filename,"col",{"n_s"},"int");
+  scorpio::define_var(filename,"S"  ,{"n_s"},"real");
+  scorpio::define_var(filename,"rank_nnz",{"n_ranks"},"int");
+  scorpio::define_var(filename,"fine_gids_hash",{"n_ranks"},"int");
+
+  scorpio::set_attribute(filename,"GLOBAL","map_file",map_file);
+  scorpio::set_attribute(filename,"GLOBAL","map_file_fingerprint",get_map_file_fingerprint(map_file));
+  scorpio::set_attribute(filename,"GLOBAL","fine_grid_name",fine_grid->name());
+  scorpio::set_attribute(filename,"GLOBAL","fine_grid_ncols",fine_grid->get_num_global_dofs());
+  scorpio::set_attribute<std::string>(filename,"GLOBAL","interp_type",type_str);
+
+  scorpio::set_dim_decomp(filename,"n_s",offset,my_nnz);
+  scorpio::enddef(filename);
+
+  // NOTE: add 1 so that we don't pass nullptr to scorpio write routines
+  std::vector<gid_type> rows(my_nnz+1), cols(my_nnz+1);
+  std::vector<Real> S(my_nnz+1);
+  for (int i=0; i<my_nnz; ++i) {
+    rows[i] = triplets[i].row;
+    cols[i] = triplets[i].col;
+    S[i]    = triplets[i].w;
+  }
+  scorpio::write_var(filename,"row",rows.data());
+  scorpio::write_var(filename,"col",cols.data());
+  scorpio::write_var(filename,"S"  ,S.data());
+  scorpio::write_var(filename,"rank_nnz",rank_nnz.data());
+  scorpio::write_var(filename,"fine_gids_hash",hashes.data());
+
+  scorpio::release_file(filename);
+}
+
 void HorizRemapperData::
 create_coarse_grids (const std::vector<Triplet>& triplets)
 {
@@ -184,23 +387,32 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
   auto col_grid = refine ? ov_coarse_grid : fine_grid;
   const int num_rows = row_grid->get_num_local_dofs();
 
-  const auto& col_gid2lid = col_grid->get_gid2lid_map();
-  const auto& row_gid2lid = row_grid->get_gid2lid_map();
+  const auto& col_gid2lid = col_grid->get_gid2lid_index<Host>();
+  const auto& row_gid2lid = row_grid->get_gid2lid_index<Host>();
 
   // Sort triplets so that row GIDs appear in the same order as
   // in the row grid. If two row GIDs are the same, use same logic
-  // with col
-  auto compare = [&] (const Triplet& lhs, const Triplet& rhs) {
-    auto lhs_lrow = row_gid2lid.at(lhs.row);
-    auto rhs_lrow = row_gid2lid.at(rhs.row);
-    auto lhs_lcol = col_gid2lid.at(lhs.col);
-    auto rhs_lcol = col_gid2lid.at(rhs.col);
-    return lhs_lrow<rhs_lrow or (lhs_lrow==rhs_lrow and lhs_lcol<rhs_lcol);
-  };
-  std::sort(triplets.begin(),triplets.end(),compare);
+  // with col. Convert gids to lids once, rather than at every comparison.
+  const int nnz = triplets.size();
+  std::vector<std::array<int,3>> lrow_lcol_idx(nnz);
+  for (int i=0; i<nnz; ++i) {
+    const int lrow = row_gid2lid.lid(triplets[i].row);
+    const int lcol = col_gid2lid.lid(triplets[i].col);
+    EKAT_REQUIRE_MSG (lrow!=-1 and lcol!=-1,
+        "Error! Triplet row/col gid not found in the row/col grid.\n"
+        "  - row gid: " + std::to_string(triplets[i].row) + "\n"
+        "  - col gid: " + std::to_string(triplets[i].col) + "\n");
+    lrow_lcol_idx[i] = {lrow,lcol,i};
+  }
+  std::sort(lrow_lcol_idx.begin(),lrow_lcol_idx.end());
+  std::vector<Triplet> sorted_triplets;
+  sorted_triplets.reserve(nnz);
+  for (const auto& it : lrow_lcol_idx) {
+    sorted_triplets.push_back(triplets[it[2]]);
+  }
+  triplets.swap(sorted_triplets);
 
   // Alloc views and create mirror views
-  const int nnz = triplets.size();
   row_offsets = view_1d<int>("",num_rows+1);
   col_lids    = view_1d<int>("",nnz);
   weights     = view_1d<Real>("",nnz);
@@ -211,7 +423,7 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
 
   // Fill col ids and weights
   for (int i=0; i<nnz; ++i) {
-    col_lids_h(i) = col_gid2lid.at(triplets[i].col);
+    col_lids_h(i) = lrow_lcol_idx[i][1];
     weights_h(i)  = triplets[i].w;
   }
   Kokkos::deep_copy(weights,weights_h);
@@ -220,7 +432,7 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
   // Compute row offsets
   std::vector<int> row_counts(num_rows);
   for (int i=0; i<nnz; ++i) {
-    ++row_counts[row_gid2lid.at(triplets[i].row)];
+    ++row_counts[lrow_lcol_idx[i][0]];
   }
   std::partial_sum(row_counts.begin(),row_counts.end(),row_offsets_h.data()+1);
   EKAT_REQUIRE_MSG (
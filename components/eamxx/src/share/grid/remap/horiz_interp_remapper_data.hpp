@@ -32,6 +32,23 @@ struct HorizRemapperData {
               const ekat::Comm& comm,
               const InterpType type);
 
+  // The key used to store/retrieve the remap data in a cache. The same map file
+  // may be used with different fine grids (or comms), which yield different data.
+  static std::string cache_key (const std::string& map_file,
+                                const std::shared_ptr<const AbstractGrid>& fine_grid,
+                                const ekat::Comm& comm,
+                                const InterpType type);
+
+  // If a non-empty dir is set, build will look in there for a file storing the triplets
+  // already partitioned for the current fine grid and number of ranks. If found, it
+  // is loaded, skipping the read/redistribution of the map file. If not, the file is
+  // created once the triplets have been redistributed, for use in later runs.
+  static void set_partitioned_maps_dir (const std::string& dir) { s_partitioned_maps_dir = dir; }
+  static const std::string& get_partitioned_maps_dir () { return s_partitioned_maps_dir; }
+
+  // How many times the triplets were loaded from a pre-partitioned file (mostly for testing)
+  static int get_num_partitioned_loads () { return s_num_partitioned_loads; }
+
   // The coarse grid data
   std::shared_ptr<AbstractGrid> coarse_grid;
   std::shared_ptr<AbstractGrid> ov_coarse_grid;
@@ -63,6 +80,27 @@ private:
   std::vector<Triplet>
   get_my_triplets (const std::string& map_file) const;
 
+  // Read/write the triplets of this rank from/to a pre-partitioned file.
+  // The read method returns false if the file does not exist, or if it was
+  // generated for a different map file (or a different version of it), fine grid,
+  // or number of ranks.
+  std::string get_partitioned_map_file (const std::string& map_file) const;
+  bool read_partitioned_triplets (const std::string& map_file,
+                                  std::vector<Triplet>& triplets) const;
+  void write_partitioned_triplets (const std::string& map_file,
+                                   const std::vector<Triplet>& triplets) const;
+
+  // A hash of the fine grid gids owned by this rank. Used to verify that a
+  // pre-partitioned file matches the current decomposition of the fine grid.
+  int get_fine_gids_hash () const;
+
+  // A fingerprint of the map file content (its size and last modification time).
+  // Used to detect a map file that was regenerated after the pre-partitioned file.
+  std::string get_map_file_fingerprint (const std::string& map_file) const;
+
+  static std::string s_partitioned_maps_dir;
+  static int         s_num_partitioned_loads;
+
   void create_coarse_grids (const std::vector<Triplet>& triplets);
 
   // Not a const ref, since we'll sort the triplets according to
@@ -0,0 +1,213 @@
+#include "eamxx_async_writer.hpp"
+
+#include <ekat_assert.hpp>
+
+#include <mpi.h>
+
+#include <chrono>
+
+namespace scream {
+namespace scorpio {
+
+namespace {
+double seconds_since (const std::chrono::steady_clock::time_point& start) {
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end-start).count();
+}
+} // anonymous namespace
+
+AsyncWriter& AsyncWriter::instance ()
+{
+  static AsyncWriter w;
+  return w;
+}
+
+AsyncWriter::~AsyncWriter ()
+{
+  // Do not throw from a destructor: just make sure the worker is gone
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  if (m_worker.joinable()) {
+    m_worker.join();
+  }
+}
+
+bool AsyncWriter::is_async () const
+{
+  if (m_async==-1) {
+    // PIO calls MPI from the worker, while the model keeps calling MPI
+    // from the main thread, so we need full multithreading support.
+    int inited, finalized, provided = MPI_THREAD_SINGLE;
+    MPI_Initialized(&inited);
+    MPI_Finalized(&finalized);
+    if (inited and not finalized) {
+      MPI_Query_thread(&provided);
+    }
+    m_async = provided==MPI_THREAD_MULTIPLE ? 1 : 0;
+  }
+  return m_async==1;
+}
+
+AsyncWriter::ticket_t AsyncWriter::enqueue (const task_t& task)
+{
+  if (not is_async()) {
+    // Execute inline. Still keep track of the time spent in the task,
+    // which in this case is entirely exposed to the caller.
+    // NOTE: the task is counted as submitted only once it completed. The task
+    //       itself calls scorpio, which calls sync_caller: if the task was
+    //       already counted, sync_caller would wait for it forever.
+    ticket_t ticket;
+    auto start = std::chrono::steady_clock::now();
+    auto update_stats = [&]() {
+      auto elapsed = seconds_since(start);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_task_seconds += elapsed;
+      m_wait_seconds += elapsed;
+      ticket = ++m_submitted;
+      ++m_completed;
+    };
+    try {
+      task();
+    } catch (...) {
+      update_stats();
+      throw;
+    }
+    update_stats();
+    return ticket;
+  }
+
+  ticket_t ticket;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (not m_worker.joinable()) {
+      start_worker();
+    }
+    m_tasks.push_back(task);
+    ticket = ++m_submitted;
+  }
+  m_cv.notify_all();
+  return ticket;
+}
+
+void AsyncWriter::wait (const ticket_t ticket)
+{
+  EKAT_REQUIRE_MSG (not on_worker(),
+      "Error! AsyncWriter::wait cannot be called from within an async task.\n");
+
+  if (m_completed.load()<ticket) {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock,[&]{ return m_completed.load()>=ticket; });
+    m_wait_seconds += seconds_since(start);
+  }
+
+  std::exception_ptr err;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(err,m_error);
+  }
+  if (err) {
+    std::rethrow_exception(err);
+  }
+}
+
+void AsyncWriter::sync_caller ()
+{
+  // Fast return: nothing is pending, or we are the worker
+  if (m_completed.load()==m_submitted.load() or on_worker()) {
+    return;
+  }
+  wait_all();
+}
+
+bool AsyncWriter::on_worker () const
+{
+  // m_worker_id is (re)set by start_worker/shutdown, possibly on another thread
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return std::this_thread::get_id()==m_worker_id;
+}
+
+void AsyncWriter::shutdown ()
+{
+  wait_all();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  if (m_worker.joinable()) {
+    m_worker.join();
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stop = false;
+  m_worker_id = std::thread::id();
+}
+
+double AsyncWriter::task_seconds () const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_task_seconds;
+}
+
+double AsyncWriter::wait_seconds () const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_wait_seconds;
+}
+
+double AsyncWriter::hidden_seconds () const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_task_seconds>m_wait_seconds ? m_task_seconds-m_wait_seconds : 0;
+}
+
+void AsyncWriter::start_worker ()
+{
+  // NOTE: called with m_mutex locked
+  m_stop = false;
+  m_worker = std::thread([this]{ worker_loop(); });
+  m_worker_id = m_worker.get_id();
+}
+
+void AsyncWriter::worker_loop ()
+{
+  while (true) {
+    task_t task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock,[&]{ return m_stop or not m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        // Only get here if m_stop=true
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::exception_ptr err;
+    try {
+      task();
+    } catch (...) {
+      err = std::current_exception();
+    }
+    auto elapsed = seconds_since(start);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_task_seconds += elapsed;
+      if (err and not m_error) {
+        // Keep the first error, which is likely the root cause of the others
+        m_error = err;
+      }
+      ++m_completed;
+    }
+    m_cv.notify_all();
+  }
+}
+
+} // namespace scorpio
+} // namespace scream
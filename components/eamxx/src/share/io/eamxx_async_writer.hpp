@@ -0,0 +1,99 @@
+#ifndef SCREAM_ASYNC_WRITER_HPP
+#define SCREAM_ASYNC_WRITER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace scream {
+namespace scorpio {
+
+/*
+ * A small FIFO task queue, serviced by a single background thread,
+ * used to defer scorpio write operations.
+ *
+ * Scorpio (and the MPI collectives behind it) must be called in the same
+ * order on all ranks, and PIO itself is not thread safe. Hence:
+ *  - there is ONE worker for the whole process, so that tasks enqueued
+ *    in the same order on all ranks are executed in the same order;
+ *  - any scorpio call issued by a thread other than the worker first
+ *    drains the queue (see sync_caller). The scorpio interface does this
+ *    automatically, so customers never see a partially written file.
+ *
+ * If MPI was not initialized with MPI_THREAD_MULTIPLE, running PIO on a
+ * separate thread is not safe, and tasks are executed inline at enqueue
+ * time. Customers do not need to care: the semantic is the same.
+ *
+ * The writer keeps track of the time spent executing tasks, and the time
+ * callers spent blocked waiting for them, so that the amount of write time
+ * hidden behind model computation can be reported.
+ */
+
+class AsyncWriter
+{
+public:
+  using task_t   = std::function<void()>;
+  using ticket_t = long long;
+
+  static AsyncWriter& instance ();
+
+  ~AsyncWriter ();
+
+  // Whether tasks are actually executed by a background thread
+  bool is_async () const;
+
+  // Adds a task to the queue, returning a ticket that can be used to wait on it.
+  ticket_t enqueue (const task_t& task);
+
+  // Wait until the task with given ticket (and all the ones before it) completed.
+  // If any task threw, the exception is rethrown here.
+  void wait (const ticket_t ticket);
+  void wait_all () { wait(m_submitted.load()); }
+
+  // Non-blocking check on whether the task with given ticket completed
+  bool is_done (const ticket_t ticket) const { return m_completed.load()>=ticket; }
+
+  // If called from a thread other than the worker, wait for all pending tasks
+  void sync_caller ();
+
+  // Drain the queue and join the worker thread (it is restarted on the next enqueue)
+  void shutdown ();
+
+  // Timings (in seconds) of tasks execution and of callers blocked in wait
+  double task_seconds () const;
+  double wait_seconds () const;
+  double hidden_seconds () const;
+
+private:
+  AsyncWriter () = default;
+
+  void start_worker ();
+  void worker_loop ();
+
+  // Whether the calling thread is the worker
+  bool on_worker () const;
+
+  std::deque<task_t>        m_tasks;
+  mutable std::mutex        m_mutex;
+  std::condition_variable   m_cv;
+  std::thread               m_worker;
+  std::thread::id           m_worker_id;
+  bool                      m_stop = false;
+  mutable int               m_async = -1; // -1: not yet queried
+
+  std::atomic<ticket_t>     m_submitted {0};
+  std::atomic<ticket_t>     m_completed {0};
+  std::exception_ptr        m_error;
+
+  double m_task_seconds = 0;
+  double m_wait_seconds = 0;
+};
+
+} // namespace scorpio
+} // namespace scream
+
+#endif // SCREAM_ASYNC_WRITER_HPP
@@ -11,12 +11,37 @@
 
 #include <chrono>
 #include <ctime>
+#include <functional>
 #include <fstream>
 #include <memory>
 
 namespace scream
 {
 
+namespace {
+// Set a file attribute, stored in a type-erased std::any
+void set_any_attribute (const std::string& filename, const std::string& name, const std::any& any)
+{
+  using scorpio::set_attribute;
+  if (any.type()==typeid(int)) {
+    set_attribute(filename,"GLOBAL",name,std::any_cast<const int&>(any));
+  } else if (any.type()==typeid(std::int64_t)) {
+    set_attribute(filename,"GLOBAL",name,std::any_cast<const std::int64_t&>(any));
+  } else if (any.type()==typeid(float)) {
+    set_attribute(filename,"GLOBAL",name,std::any_cast<const float&>(any));
+  } else if (any.type()==typeid(double)) {
+    set_attribute(filename,"GLOBAL",name,std::any_cast<const double&>(any));
+  } else if (any.type()==typeid(std::string)) {
+    set_attribute(filename,"GLOBAL",name,std::any_cast<const std::string&>(any));
+  } else {
+    EKAT_ERROR_MSG (
+        "Error! Invalid concrete type for IO global.\n"
+        " - global name: " + name + "\n"
+        " - type id    : " + std::string(any.type().name()) + "\n");
+  }
+}
+} // anonymous namespace
+
 OutputManager::~OutputManager() { finalize(); }
 
 void
@@ -463,14 +488,18 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     setup_output_file(m_output_control,m_output_file_specs);
 
     // Update time (must be done _before_ writing fields)
-    update_time(m_output_file_specs.filename,timestamp.days_from(m_case_t0));
+    run_io_task([filename=m_output_file_specs.filename,t=timestamp.days_from(m_case_t0)]() {
+      scorpio::update_time(filename,t);
+    });
   }
   if (is_checkpoint_step) {
     setup_output_file(m_checkpoint_control,m_checkpoint_file_specs);
 
     if (is_full_checkpoint_step) {
       // Update time (must be done _before_ writing fields)
-      update_time(m_checkpoint_file_specs.filename,timestamp.days_from(m_case_t0));
+      run_io_task([filename=m_checkpoint_file_specs.filename,t=timestamp.days_from(m_case_t0)]() {
+        scorpio::update_time(filename,t);
+      });
     }
   }
   stop_timer(timer_root+"::get_new_file");
@@ -505,54 +534,41 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       control.compute_next_write_ts();
       control.nsamples_since_last_write = 0;
 
+      // Gather all the global attributes. We store them by value (rather than writing them
+      // right away), so that the writes can be deferred to the async writer, if in use.
+      std::vector<std::pair<std::string,std::any>> atts;
+      const bool write_last_write_ts = not m_is_model_restart_output and
+                                       filespecs.ftype==FileType::HistoryRestart;
+      const auto last_write_ts = m_output_control.last_write_ts;
       if (m_is_model_restart_output) {
         // Only write nsteps on model restart
-        set_attribute(filespecs.filename,"GLOBAL","nsteps",timestamp.get_num_steps());
+        atts.emplace_back("nsteps",timestamp.get_num_steps());
       } else {
         if (filespecs.ftype==FileType::HistoryRestart) {
-          // Update the date of last write and sample size
-          write_timestamp (filespecs.filename,"last_write",m_output_control.last_write_ts,true);
-          scorpio::set_attribute (filespecs.filename,"GLOBAL","num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
+          // Update the sample size (the date of last write is handled separately)
+          atts.emplace_back("num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
           if (m_output_file_specs.is_open) {
-            scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_file_num_snaps",m_output_file_specs.storage.num_snapshots_in_file);
-            scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_filename",m_output_file_specs.filename);
+            atts.emplace_back("last_output_file_num_snaps",m_output_file_specs.storage.num_snapshots_in_file);
+            atts.emplace_back("last_output_filename",m_output_file_specs.filename);
           } else {
-            scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_filename","");
+            atts.emplace_back("last_output_filename",std::string(""));
           }
         }
         // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
         // output, and the latter b/c we want to make sure these params don't change across restarts
-        set_attribute(filespecs.filename,"GLOBAL","averaging_type",e2str(m_avg_type));
-        set_attribute(filespecs.filename,"GLOBAL","averaging_frequency_units",m_output_control.frequency_units);
-        set_attribute(filespecs.filename,"GLOBAL","averaging_frequency",m_output_control.frequency);
-        set_attribute(filespecs.filename,"GLOBAL","file_max_storage_type",e2str(m_output_file_specs.storage.type));
+        atts.emplace_back("averaging_type",e2str(m_avg_type));
+        atts.emplace_back("averaging_frequency_units",m_output_control.frequency_units);
+        atts.emplace_back("averaging_frequency",m_output_control.frequency);
+        atts.emplace_back("file_max_storage_type",e2str(m_output_file_specs.storage.type));
         if (m_output_file_specs.storage.type==NumSnaps) {
-          set_attribute(filespecs.filename,"GLOBAL","max_snapshots_per_file",m_output_file_specs.storage.max_snapshots_in_file);
+          atts.emplace_back("max_snapshots_per_file",m_output_file_specs.storage.max_snapshots_in_file);
         }
-        const auto& fp_precision = m_params.get<std::string>("floating_point_precision");
-        set_attribute(filespecs.filename,"GLOBAL","fp_precision",fp_precision);
+        atts.emplace_back("fp_precision",m_params.get<std::string>("floating_point_precision"));
       }
 
       // Write all stored globals
       for (const auto& it : m_globals) {
-        const auto& name = it.first;
-        const auto& any = *it.second;
-        if (any.type()==typeid(int)) {
-          set_attribute(filespecs.filename,"GLOBAL",name,std::any_cast<const int&>(any));
-        } else if (any.type()==typeid(std::int64_t)) {
-          set_attribute(filespecs.filename,"GLOBAL",name,std::any_cast<const std::int64_t&>(any));
-        } else if (any.type()==typeid(float)) {
-          set_attribute(filespecs.filename,"GLOBAL",name,std::any_cast<const float&>(any));
-        } else if (any.type()==typeid(double)) {
-          set_attribute(filespecs.filename,"GLOBAL",name,std::any_cast<const double&>(any));
-        } else if (any.type()==typeid(std::string)) {
-          set_attribute(filespecs.filename,"GLOBAL",name,std::any_cast<const std::string&>(any));
-        } else {
-          EKAT_ERROR_MSG (
-              "Error! Invalid concrete type for IO global.\n"
-              " - global name: " + it.first + "\n"
-              " - type id    : " + std::string(any.type().name()) + "\n");
-        }
+        atts.emplace_back(it.first,*it.second);
       }
 
       // We're adding one snapshot to the file
@@ -561,11 +577,24 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       // NOTE: for checkpoint files, unless we write restart data, we did not update time,
       //       which means we cannot write any variable (the check var.num_records==time.length
       //       would fail)
+      std::vector<double> time_bnds;
       if (m_time_bnds.size()>0 and
           (filespecs.ftype!=FileType::HistoryRestart or is_full_checkpoint_step)) {
-        scorpio::write_var(filespecs.filename, "time_bnds", m_time_bnds.data());
+        time_bnds = m_time_bnds;
       }
 
+      run_io_task([filename=filespecs.filename,atts,time_bnds,write_last_write_ts,last_write_ts]() {
+        if (write_last_write_ts) {
+          write_timestamp (filename,"last_write",last_write_ts,true);
+        }
+        for (const auto& [name,val] : atts) {
+          set_any_attribute(filename,name,val);
+        }
+        if (time_bnds.size()>0) {
+          scorpio::write_var(filename, "time_bnds", time_bnds.data());
+        }
+      });
+
       close_or_flush_if_needed(filespecs,control);
     };
 
@@ -581,7 +610,17 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
       // Always flush output during checkpoints (assuming we opened it already)
       if (m_output_file_specs.is_open) {
-        scorpio::flush_file (m_output_file_specs.filename);
+        run_io_task([filename=m_output_file_specs.filename]() {
+          scorpio::flush_file (filename);
+        });
+      }
+
+      // Restart files must be complete once this step is over, so we cannot leave
+      // any pending write behind (this is a no-op if async writes are off)
+      if (m_async_write) {
+        start_timer("EAMxx::IO::async_wait");
+        scorpio::AsyncWriter::instance().wait_all();
+        stop_timer("EAMxx::IO::async_wait");
       }
     }
     stop_timer(timer_root+"::update_snapshot_tally");
@@ -596,6 +635,17 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  if (m_async_write) {
+    // Make sure all deferred writes are done, and report how much write time we hid.
+    // NOTE: the async writer is shared by all streams, so these are process-wide totals
+    auto& writer = scorpio::AsyncWriter::instance();
+    writer.wait_all();
+    m_atm_logger->info("[EAMxx::output_manager] Async writes summary for " + m_filename_prefix + ":");
+    m_atm_logger->info("     running on background thread: " + std::string(writer.is_async() ? "yes" : "no"));
+    m_atm_logger->info("     total write time (s): " + std::to_string(writer.task_seconds()));
+    m_atm_logger->info("     hidden write time (s): " + std::to_string(writer.hidden_seconds()));
+  }
+
   // Close any output file still open
   if (m_output_file_specs.is_open) {
     scorpio::release_file (m_output_file_specs.filename);
@@ -618,6 +668,7 @@ void OutputManager::finalize()
   m_avg_type = {};
   m_output_control = {};
   m_checkpoint_control = {};
+  m_async_write = false;
   m_output_file_specs = {};
   m_checkpoint_file_specs = {};
   m_case_t0 = {};
@@ -634,6 +685,58 @@ long long OutputManager::res_dep_memory_footprint () const {
   return mf;
 }
 
+std::set<std::string> OutputManager::
+get_model_fields_names (const fm_type& field_mgr, const std::string& grid_name) const
+{
+  using vos_t = std::vector<std::string>;
+
+  const auto gm = field_mgr.get_grids_manager();
+  const auto grid = gm->get_grid(grid_name);
+
+  // Gather the specs requested on this grid (possibly via one of its aliases)
+  vos_t specs;
+  if (m_params.isParameter("field_names")) {
+    // Only allowed if there is a single grid, which must then be this one
+    specs = m_params.get<vos_t>("field_names");
+  } else if (m_params.isSublist("fields")) {
+    const auto& fields_pl = m_params.sublist("fields");
+    for (auto it=fields_pl.sublists_names_cbegin(); it!=fields_pl.sublists_names_cend(); ++it) {
+      if (not gm->has_grid(*it) or gm->get_grid(*it)->name()!=grid_name) {
+        continue;
+      }
+      const auto& pl = fields_pl.sublist(*it);
+      if (pl.isType<vos_t>("field_names")) {
+        const auto& names = pl.get<vos_t>("field_names");
+        specs.insert(specs.end(),names.begin(),names.end());
+      } else if (pl.isType<std::string>("field_names")) {
+        const auto& name = pl.get<std::string>("field_names");
+        if (name!="NONE") {
+          specs.push_back(name);
+        }
+      }
+    }
+  }
+
+  // Anything that is not a model field is a diag, which reads its inputs from the model
+  // (possibly via other diags). See also AtmosphereOutput::init_diagnostics.
+  std::set<std::string> names;
+  std::function<void(const std::string&)> add_field;
+  add_field = [&](const std::string& fname) {
+    if (field_mgr.has_field(fname,grid_name)) {
+      names.insert(fname);
+      return;
+    }
+    auto diag = create_diagnostic(fname,grid);
+    for (const auto& req : diag->get_required_field_requests()) {
+      add_field(req.fid.name());
+    }
+  };
+  for (const auto& spec : specs) {
+    add_field(parse_field_alias(spec).second);
+  }
+  return names;
+}
+
 std::string OutputManager::
 compute_filename (const IOFileSpecs& file_specs,
                   const util::TimeStamp& timestamp) const
@@ -778,6 +881,11 @@ setup_internals (const std::shared_ptr<fm_type>& field_mgr,
     }
   }
 
+  // Whether writes can be deferred to the async writer thread. We never do so for
+  // model restart output, which must be on disk when the restart step is over.
+  m_async_write = not m_is_model_restart_output and m_params.get("async_write",false);
+  m_params.set("async_write",m_async_write); // Ensure output streams see the same value
+
   // Set the iotype to use for the output file
   std::string iotype = m_params.get<std::string>("iotype", "default");
   m_output_file_specs.iotype = scorpio::str2iotype(iotype);
@@ -946,10 +1054,24 @@ close_or_flush_if_needed (      IOFileSpecs& file_specs,
   }
 
   if (not file_specs.storage.snapshot_fits(*window_start_ts)) {
-    scorpio::release_file(file_specs.filename);
+    run_io_task([filename=file_specs.filename]() {
+      scorpio::release_file(filename);
+    });
     file_specs.close();
   } else if (file_specs.file_needs_flush()) {
-    scorpio::flush_file (file_specs.filename);
+    run_io_task([filename=file_specs.filename]() {
+      scorpio::flush_file (filename);
+    });
+  }
+}
+
+void OutputManager::
+run_io_task (const scorpio::AsyncWriter::task_t& task) const
+{
+  if (m_async_write) {
+    scorpio::AsyncWriter::instance().enqueue(task);
+  } else {
+    task();
   }
 }
 
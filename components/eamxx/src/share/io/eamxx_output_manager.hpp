@@ -112,6 +112,13 @@ public:
 
   long long res_dep_memory_footprint () const;
 
+  // The names of the fields of field_mgr on the given grid that this output reads, either
+  // directly or as inputs of the requested diagnostics (recursively). It only relies on
+  // the params and on the registered fields, so it can be called before setup, and
+  // before the fields are allocated.
+  std::set<std::string> get_model_fields_names (const fm_type& field_mgr,
+                                                const std::string& grid_name) const;
+
   bool is_restart () const { return m_is_model_restart_output; }
 
   // For debug and testing purposes
@@ -136,6 +143,9 @@ protected:
   void close_or_flush_if_needed (      IOFileSpecs& file_specs,
                                  const IOControl&   control) const;
 
+  // Execute a task that calls scorpio, or defer it to the async writer (if async_write=true)
+  void run_io_task (const scorpio::AsyncWriter::task_t& task) const;
+
   // Manage logging of info to atm.log
   void push_to_logger();
 
@@ -188,6 +198,9 @@ protected:
 
   // If true, we save grid data in output file
   bool m_save_grid_data;
+
+  // If true, scorpio writes are deferred to the async writer thread
+  bool m_async_write = false;
 };
 
 } // namespace scream
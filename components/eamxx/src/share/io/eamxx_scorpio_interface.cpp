@@ -1,5 +1,6 @@
 #include "eamxx_scorpio_interface.hpp"
 #include "eamxx_shr_interface_c2f.hpp"
+#include "eamxx_async_writer.hpp"
 
 #include "eamxx_config.h"
 
@@ -9,12 +10,219 @@
 
 #include <pio.h>
 
+#include <algorithm>
+#include <cstring>
 #include <set>
 #include <numeric>
 
 namespace scream {
 namespace scorpio {
 
+// A node-level cache for non-decomposed variables read from file.
+// Each entry is stored once per node, in MPI-3 shared memory windows allocated
+// on the node-local communicator, and is keyed by (file, var, time index, dtype).
+// Entries are read only by the node roots, through a separate PIO iosystem on the
+// communicator of the node roots, directly into the shared memory, where all the
+// ranks of the node can see them.
+// To limit the number of windows, small entries are sub-allocated from slabs, while
+// large entries get a slab of their own. If the node memory used by the cache would
+// exceed max_bytes, the least recently used entries are evicted, and the slabs that
+// no longer hold any entry are freed. Entries larger than max_bytes are not cached.
+// Reads of non-decomposed vars are collective (just like with PIO), so all ranks see
+// the same sequence of hits, misses, and evictions. Only misses require node-collective
+// calls (to allocate slabs and to publish the data); hits are served locally.
+struct NodeReadCache
+{
+  struct Entry {
+    char*       data = nullptr; // Node-shared data (valid on all ranks of the node)
+    size_t      nbytes = 0;
+    int         slab = -1;
+    long long   last_use = 0;
+    std::string filename;
+  };
+
+  struct Slab {
+    MPI_Win win  = MPI_WIN_NULL;
+    char*   data = nullptr;
+    size_t  capacity = 0;
+    size_t  used = 0;
+    int     num_entries = 0;
+  };
+
+  static constexpr size_t slab_size = 16*1024*1024;
+  static constexpr size_t alignment = 64;
+
+  static std::string make_key (const std::string& filename, const std::string& varname,
+                               const int frame, const std::string& dtype)
+  {
+    return filename + "::" + varname + "::" + std::to_string(frame) + "::" + dtype;
+  }
+
+  // Collective on comm
+  void enable (const ekat::Comm& comm, const int rearranger, const size_t max_node_bytes) {
+    if (node_comm==MPI_COMM_NULL) {
+      MPI_Comm_split_type(comm.mpi_comm(),MPI_COMM_TYPE_SHARED,comm.rank(),MPI_INFO_NULL,&node_comm);
+      MPI_Comm_rank(node_comm,&node_rank);
+      MPI_Comm_split(comm.mpi_comm(),node_rank==0 ? 0 : MPI_UNDEFINED,comm.rank(),&roots_comm);
+      if (node_rank==0) {
+        int num_roots;
+        MPI_Comm_size(roots_comm,&num_roots);
+        auto err = PIOc_Init_Intracomm(roots_comm,num_roots,1,0,rearranger,&roots_sysid);
+        EKAT_REQUIRE_MSG (err==PIO_NOERR,
+            "Error! Could not init the PIO subsystem of the read cache.\n"
+            " - pio error: " + std::to_string(err) + "\n");
+      }
+    }
+    max_bytes = max_node_bytes;
+    enabled = true;
+  }
+
+  void finalize () {
+    clear();
+    if (roots_sysid!=-1) {
+      PIOc_free_iosystem(roots_sysid);
+      roots_sysid = -1;
+    }
+    if (roots_comm!=MPI_COMM_NULL) {
+      MPI_Comm_free(&roots_comm);
+    }
+    if (node_comm!=MPI_COMM_NULL) {
+      MPI_Comm_free(&node_comm);
+    }
+    node_rank = -1;
+    enabled = false;
+  }
+
+  Entry* find (const std::string& key) {
+    auto it = entries.find(key);
+    if (it==entries.end()) {
+      return nullptr;
+    }
+    it->second.last_use = ++num_uses;
+    return &it->second;
+  }
+
+  // Reserve node memory for a new entry. Collective on the node communicator.
+  // Returns nullptr (without allocating) if the entry would not fit in max_bytes.
+  Entry* allocate (const std::string& key, const std::string& filename, const size_t nbytes) {
+    const size_t padded = std::max((nbytes + alignment - 1) / alignment * alignment, alignment);
+    if (padded>max_bytes) {
+      return nullptr;
+    }
+    if (current==-1 or slabs.at(current).used+padded>slabs.at(current).capacity) {
+      const size_t capacity = std::max(std::min(slab_size,max_bytes),padded);
+
+      // Make room for the new slab, evicting the least recently used entries
+      auto older = [](const auto& lhs, const auto& rhs) {
+        return lhs.second.last_use < rhs.second.last_use;
+      };
+      while (not entries.empty() and node_bytes+capacity>max_bytes) {
+        erase(std::min_element(entries.begin(),entries.end(),older));
+      }
+
+      current = next_slab_id++;
+      auto& slab = slabs[current];
+      slab.capacity = capacity;
+      void* base;
+      MPI_Win_allocate_shared(node_rank==0 ? capacity : 0,1,MPI_INFO_NULL,node_comm,&base,&slab.win);
+      MPI_Aint size;
+      int disp_unit;
+      MPI_Win_shared_query(slab.win,0,&size,&disp_unit,&slab.data);
+      node_bytes += capacity;
+    }
+
+    auto& slab = slabs.at(current);
+    auto& e = entries[key];
+    e.data = slab.data + slab.used;
+    e.nbytes = nbytes;
+    e.slab = current;
+    e.last_use = ++num_uses;
+    e.filename = filename;
+    slab.used += padded;
+    ++slab.num_entries;
+    return &e;
+  }
+
+  // Remove an entry, freeing its slab if it holds no other entry. Collective on the node communicator
+  void erase (std::map<std::string,Entry>::iterator it) {
+    const int id = it->second.slab;
+    auto& slab = slabs.at(id);
+    if (--slab.num_entries==0) {
+      MPI_Win_free(&slab.win);
+      node_bytes -= slab.capacity;
+      slabs.erase(id);
+      if (current==id) {
+        current = -1;
+      }
+    }
+    entries.erase(it);
+  }
+
+  void erase_file (const std::string& filename) {
+    for (auto it=entries.begin(); it!=entries.end(); ) {
+      if (it->second.filename==filename) {
+        erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  void clear () {
+    entries.clear();
+    for (auto& it : slabs) {
+      MPI_Win_free(&it.second.win);
+    }
+    slabs.clear();
+    node_bytes = 0;
+    current = -1;
+    while (not root_ncids.empty()) {
+      close_root_file(root_ncids.begin()->first);
+    }
+  }
+
+  // Handle of a file opened on the node roots iosystem (only valid on node roots)
+  int get_root_ncid (const std::string& filename, int iotype) {
+    auto it = root_ncids.find(filename);
+    if (it!=root_ncids.end()) {
+      return it->second;
+    }
+    int ncid;
+    auto err = PIOc_openfile(roots_sysid,&ncid,&iotype,filename.c_str(),PIO_NOWRITE);
+    EKAT_REQUIRE_MSG (err==PIO_NOERR,
+        "Error! Something went wrong while opening a file for the read cache.\n"
+        " - filename : " + filename + "\n"
+        " - pio error: " + std::to_string(err) + "\n");
+    root_ncids[filename] = ncid;
+    return ncid;
+  }
+
+  // Collective on the node roots (no-op on other ranks)
+  void close_root_file (const std::string& filename) {
+    auto it = root_ncids.find(filename);
+    if (it!=root_ncids.end()) {
+      PIOc_closefile(it->second);
+      root_ncids.erase(it);
+    }
+  }
+
+  bool      enabled     = false;
+  MPI_Comm  node_comm   = MPI_COMM_NULL;
+  int       node_rank   = -1;
+  MPI_Comm  roots_comm  = MPI_COMM_NULL;
+  int       roots_sysid = -1;
+
+  size_t    max_bytes   = 0;
+  size_t    node_bytes  = 0;
+  int       current     = -1; // The slab new small entries are sub-allocated from
+  int       next_slab_id = 0;
+  long long num_uses    = 0;
+
+  std::map<std::string,Entry> entries;
+  std::map<int,Slab>          slabs;
+  std::map<std::string,int>   root_ncids;
+};
+
 // This class is an implementation detail, and therefore it is hidden inside
 // a cpp file. All customers of IO capabilities must use the common interfaces
 // exposed in the header file of this source file.
@@ -23,6 +231,11 @@ struct ScorpioSession
 {
 public:
   static ScorpioSession& instance () {
+    // If some writes are pending on the async writer thread, we must wait for
+    // them to complete, since PIO is not thread safe (this is a no-op if
+    // called from the async writer thread itself).
+    AsyncWriter::instance().sync_caller();
+
     static ScorpioSession s;
     return s;
   }
@@ -52,6 +265,8 @@ public:
 
   ekat::Comm  comm;
 
+  NodeReadCache read_cache;
+
 private:
 
   ScorpioSession () = default;
@@ -365,6 +580,9 @@ void finalize_subsystem ()
   EKAT_REQUIRE_MSG (s.pio_sysid!=-1,
       "Error! PIO subsystem was already finalized.\n");
 
+  // Make sure no deferred write is still pending, and stop the writer thread
+  AsyncWriter::instance().shutdown();
+
   for (auto& it : s.files) {
     EKAT_REQUIRE_MSG (it.second.num_customers==0,
       "Error! ScorpioSession::finalize called, but a file is still in use elsewhere.\n"
@@ -382,6 +600,8 @@ void finalize_subsystem ()
   }
   s.decomps.clear();
 
+  s.read_cache.finalize();
+
 #ifndef SCREAM_CIME_BUILD
   // Don't finalize in CIME builds, since the coupler will take care of it
   PIOc_finalize (s.pio_sysid);
@@ -393,6 +613,37 @@ void finalize_subsystem ()
   s.pio_rearranger   = -1;
 }
 
+void set_read_cache_enabled (const bool enabled, const int max_node_mb)
+{
+  auto& s = ScorpioSession::instance();
+  EKAT_REQUIRE_MSG (s.pio_sysid!=-1,
+      "Error! Cannot enable/disable the read cache before the PIO subsystem is inited.\n");
+  EKAT_REQUIRE_MSG (max_node_mb>=0,
+      "Error! Invalid read cache size.\n"
+      " - max node memory (MB): " + std::to_string(max_node_mb) + "\n");
+  if (enabled) {
+    s.read_cache.enable(s.comm,s.pio_rearranger,static_cast<size_t>(max_node_mb)*1024*1024);
+  } else {
+    s.read_cache.clear();
+    s.read_cache.enabled = false;
+  }
+}
+
+bool is_read_cache_enabled ()
+{
+  return ScorpioSession::instance().read_cache.enabled;
+}
+
+int get_read_cache_num_entries ()
+{
+  return ScorpioSession::instance().read_cache.entries.size();
+}
+
+void clear_read_cache ()
+{
+  ScorpioSession::instance().read_cache.clear();
+}
+
 // ========================= File operations ===================== //
 
 void register_file (const std::string& filename,
@@ -413,6 +664,11 @@ void register_file (const std::string& filename,
       " - new type: " + iotype2str(iotype) + "\n");
 
   if (f.mode == Unset) {
+    // If we are about to (over)write the file, cached reads from it are stale
+    if (mode & Write) {
+      s.read_cache.erase_file(filename);
+    }
+
     // First time we ask for this file. Call PIO open routine(s)
     int err;
     int iotype_int = pio_iotype(iotype);
@@ -541,6 +797,7 @@ void release_file  (const std::string& filename)
   check_scorpio_noerr (err,f.name,"release_file","closefile");
 
   auto& s = ScorpioSession::instance();
+  s.read_cache.close_root_file(filename);
   s.files.erase(filename);
 }
 
@@ -1181,6 +1438,91 @@ std::vector<double> get_all_times (const std::string& filename)
   return times;
 }
 
+namespace impl {
+
+// PIO typed getters: netcdf converts from the var type in the file to T
+inline int get_var_typed (const int ncid, const int varid, const PIO_Offset* start, const PIO_Offset* count, int* buf) {
+  return start ? PIOc_get_vara_int(ncid,varid,start,count,buf) : PIOc_get_var_int(ncid,varid,buf);
+}
+inline int get_var_typed (const int ncid, const int varid, const PIO_Offset* start, const PIO_Offset* count, long long* buf) {
+  return start ? PIOc_get_vara_longlong(ncid,varid,start,count,buf) : PIOc_get_var_longlong(ncid,varid,buf);
+}
+inline int get_var_typed (const int ncid, const int varid, const PIO_Offset* start, const PIO_Offset* count, float* buf) {
+  return start ? PIOc_get_vara_float(ncid,varid,start,count,buf) : PIOc_get_var_float(ncid,varid,buf);
+}
+inline int get_var_typed (const int ncid, const int varid, const PIO_Offset* start, const PIO_Offset* count, double* buf) {
+  return start ? PIOc_get_vara_double(ncid,varid,start,count,buf) : PIOc_get_var_double(ncid,varid,buf);
+}
+inline int get_var_typed (const int ncid, const int varid, const PIO_Offset* start, const PIO_Offset* count, char* buf) {
+  return start ? PIOc_get_vara_text(ncid,varid,start,count,buf) : PIOc_get_var_text(ncid,varid,buf);
+}
+
+int get_frame (const PIOFile& f, const PIOVar& var, const int time_index)
+{
+  if (not var.time_dep) {
+    return -1;
+  }
+  const int frame = time_index>=0 ? time_index : f.time_dim->length-1;
+  EKAT_REQUIRE_MSG (frame<f.time_dim->length,
+      "Error! Time index out of bounds.\n"
+      " - filename: " + f.name + "\n"
+      " - varname : " + var.name + "\n"
+      " - time idx: " + std::to_string(time_index) + "\n"
+      " - time len: " + std::to_string(f.time_dim->length));
+  return frame;
+}
+
+// Get the node-shared copy of a non-decomposed var from the read cache. On a miss, the
+// node roots read the var straight into node-shared memory. Collective on the node.
+// Returns nullptr if the var is too large to be cached.
+template<typename T>
+const T* get_cached_var (const PIOFile& f, const PIOVar& var, const int frame)
+{
+  auto& cache = ScorpioSession::instance().read_cache;
+  const auto key = NodeReadCache::make_key(f.name,var.name,frame,var.dtype);
+  if (auto e = cache.find(key)) {
+    return reinterpret_cast<const T*>(e->data);
+  }
+
+  size_t size = 1;
+  for (auto d : var.dims) {
+    size *= d->length;
+  }
+  auto e = cache.allocate(key,f.name,size*sizeof(T));
+  if (e==nullptr) {
+    return nullptr;
+  }
+  const auto win = cache.slabs.at(e->slab).win;
+
+  MPI_Win_fence(0,win);
+  if (cache.node_rank==0) {
+    const int ncid = cache.get_root_ncid(f.name,pio_iotype(f.iotype));
+    int varid;
+    int err = PIOc_inq_varid(ncid,var.name.c_str(),&varid);
+    check_scorpio_noerr (err,f.name,"variable",var.name,"read_var","inq_varid");
+
+    auto dst = reinterpret_cast<T*>(e->data);
+    if (frame>=0) {
+      const int ndims = var.dims.size();
+      std::vector<PIO_Offset> start (ndims+1,0), count(ndims+1,1); // +1 for time
+      start[0] = frame;
+      for (int idim=0; idim<ndims; ++idim) {
+        count[idim+1] = var.dims[idim]->length;
+      }
+      err = get_var_typed(ncid,varid,start.data(),count.data(),dst);
+      check_scorpio_noerr (err,f.name,"variable",var.name,"read_var","get_vara");
+    } else {
+      err = get_var_typed(ncid,varid,nullptr,nullptr,dst);
+      check_scorpio_noerr (err,f.name,"variable",var.name,"read_var","get_var");
+    }
+  }
+  MPI_Win_fence(0,win);
+
+  return reinterpret_cast<const T*>(e->data);
+}
+
+} // namespace impl
+
 // Read variable into user provided buffer.
 // If time dim is present, read given time slice (time_index=-1 means "read last record).
 // If time dim is not present, time_index must be -1 (error out otherwise)
@@ -1198,16 +1540,22 @@ void read_var (const std::string &filename, const std::string &varname, T* buf,
   // If the input pointer type already matches var.dtype, this is a no-op
   change_var_dtype(var,get_dtype<T>(),filename);
 
+  // Static data (from files opened only for reading) goes through the node cache, if enabled.
+  // Vars too large for the cache are read via PIO below.
+  const int frame = impl::get_frame(f,var,time_index);
+  if (not var.decomp and f.mode==Read and ScorpioSession::instance().read_cache.enabled) {
+    if (auto data = impl::get_cached_var<T>(f,var,frame)) {
+      size_t size = 1;
+      for (auto d : var.dims) {
+        size *= d->length;
+      }
+      std::memcpy(buf,data,size*sizeof(T));
+      return;
+    }
+  }
+
   int err;
-  int frame = -1;
-  if (var.time_dep) {
-    frame = time_index>=0 ? time_index : f.time_dim->length-1;
-    EKAT_REQUIRE_MSG (frame<f.time_dim->length,
-        "Error! Time index out of bounds.\n"
-        " - filename: " + filename + "\n"
-        " - varname : " + varname + "\n"
-        " - time idx: " + std::to_string(time_index) + "\n"
-        " - time len: " + std::to_string(f.time_dim->length));
+  if (frame>=0) {
     err = PIOc_setframe(f.ncid,var.ncid,frame);
     check_scorpio_noerr (err,f.name,"variable",varname,"read_var","setframe");
   }
@@ -1265,6 +1613,35 @@ void read_var (const std::string &filename, const std::string &varname, T* buf,
   check_scorpio_noerr (err,f.name,"variable",varname,"read_var",pioc_func);
 }
 
+template<typename T>
+const T* read_var_shared (const std::string &filename, const std::string &varname, const int time_index)
+{
+  const auto& f = impl::get_file(filename,"scorpio::read_var_shared");
+        auto& var = impl::get_var(filename,varname,"scorpio::read_var_shared");
+
+  EKAT_REQUIRE_MSG (ScorpioSession::instance().read_cache.enabled,
+      "Error! Cannot read into node-shared memory, since the read cache is disabled.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (f.mode==Read,
+      "Error! Only files opened in Read mode can be read into node-shared memory.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (not var.decomp,
+      "Error! Decomposed variables cannot be read into node-shared memory.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+
+  change_var_dtype(var,get_dtype<T>(),filename);
+
+  auto data = impl::get_cached_var<T>(f,var,impl::get_frame(f,var,time_index));
+  EKAT_REQUIRE_MSG (data!=nullptr,
+      "Error! Variable is too large to be read into node-shared memory.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  return data;
+}
+
 // Write data from user provided buffer into the requested variable
 template<typename T>
 void write_var (const std::string &filename, const std::string &varname, const T* buf, const T* fillValue)
@@ -1352,6 +1729,12 @@ template void read_var<float>     (const std::string&, const std::string&, float
 template void read_var<double>    (const std::string&, const std::string&, double*,    const int);
 template void read_var<char>      (const std::string&, const std::string&, char*,      const int);
 
+template const int*       read_var_shared<int>       (const std::string&, const std::string&, const int);
+template const long long* read_var_shared<long long> (const std::string&, const std::string&, const int);
+template const float*     read_var_shared<float>     (const std::string&, const std::string&, const int);
+template const double*    read_var_shared<double>    (const std::string&, const std::string&, const int);
+template const char*      read_var_shared<char>      (const std::string&, const std::string&, const int);
+
 template void write_var<int>       (const std::string&, const std::string&, const int*,       const int*);
 template void write_var<long long> (const std::string&, const std::string&, const long long*, const long long*);
 template void write_var<float>     (const std::string&, const std::string&, const float*,     const float*);
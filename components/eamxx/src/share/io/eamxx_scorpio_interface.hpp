@@ -69,6 +69,18 @@ void init_subsystem(const ekat::Comm& comm, const int atm_id = 0);
 bool is_subsystem_inited ();
 void finalize_subsystem ();
 
+// When enabled, non-decomposed variables read from files opened in Read mode are
+// stored in a node-level cache (MPI-3 shared memory, one copy per node), keyed by
+// (file, var, time index, dtype), so that repeated reads do not hit the file system.
+// Data is read by one rank per node, and the least recently used entries are evicted
+// if the cache would use more than max_node_mb MB per node. Variables larger than
+// max_node_mb are not cached, and are read from file every time. The cache is disabled
+// by default. Enabling, disabling, and clearing the cache are collective.
+void set_read_cache_enabled (const bool enabled, const int max_node_mb = 1024);
+bool is_read_cache_enabled ();
+int get_read_cache_num_entries ();
+void clear_read_cache ();
+
 // =================== File operations ================= //
 
 // Opens a file, returns const handle to it (useful for Read mode, to get dims/vars)
@@ -200,6 +212,15 @@ std::vector<double> get_all_times (const std::string& filename);
 template<typename T>
 void read_var (const std::string &filename, const std::string &varname, T* buf, const int time_index = -1);
 
+// Read a non-decomposed variable through the read cache (which must be enabled), and
+// return a pointer to the copy stored in node-shared memory, saving the copy into a
+// private buffer. The pointer is only valid until the next read through the cache,
+// which may evict the entry. Must be called on all ranks, just like read_var.
+// Errors out if the variable is larger than the max size of the read cache.
+// NOTE: ETI in the cpp file for int, long long, float, double, char.
+template<typename T>
+const T* read_var_shared (const std::string &filename, const std::string &varname, const int time_index = -1);
+
 // Write data from user provided buffer into the requested variable
 // NOTE: ETI in the cpp file for int, float, double.
 template<typename T>
@@ -209,13 +209,24 @@ void AtmosphereInput::read_variables (const int time_index)
     m_atm_logger->info("  time idx : " + std::to_string(time_index));
   }
 
+  read_variables_to_host (time_index);
+  sync_variables_to_dev ();
+
+  if (m_atm_logger) {
+    auto func_finish = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start)/1000.0;
+    m_atm_logger->debug("  Done! Elapsed time: " + std::to_string(duration.count()) +" seconds");
+  }
+}
+
+/* ---------------------------------------------------------- */
+void AtmosphereInput::read_variables_to_host (const int time_index)
+{
   EKAT_REQUIRE_MSG (m_fields_inited and m_scorpio_inited,
       "Error! Internal structures not fully inited yet. Did you forget to call 'init(..)'?\n");
 
   for (auto const& name : m_fields_names) {
-
     auto f_scorpio = m_fm_for_scorpio->get_field(name);
-    auto f_user    = m_fm_from_user->get_field(name);
 
     // Read the data
     switch (f_scorpio.data_type()) {
@@ -234,17 +245,24 @@ void AtmosphereInput::read_variables (const int time_index)
             " - file name : " + m_filename + "\n"
             " - field name: " + name + "\n");
     }
+  }
+}
+
+/* ---------------------------------------------------------- */
+void AtmosphereInput::sync_variables_to_dev ()
+{
+  EKAT_REQUIRE_MSG (m_fields_inited,
+      "Error! Internal structures not fully inited yet. Did you forget to call 'init(..)'?\n");
+
+  for (auto const& name : m_fields_names) {
+    auto f_scorpio = m_fm_for_scorpio->get_field(name);
+    auto f_user    = m_fm_from_user->get_field(name);
 
     f_scorpio.sync_to_dev();
     if (not f_scorpio.is_aliasing(f_user)) {
       f_user.deep_copy(f_scorpio);
     }
   }
-  if (m_atm_logger) {
-    auto func_finish = std::chrono::steady_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start)/1000.0;
-    m_atm_logger->debug("  Done! Elapsed time: " + std::to_string(duration.count()) +" seconds");
-  }
 }
 
 /* ---------------------------------------------------------- */
@@ -86,6 +86,13 @@ public:
   // Read fields that were required via parameter list.
   void read_variables (const int time_index = -1);
 
+  // The two halves of read_variables. The first only does the scorpio reads
+  // into the host views of the fields (so it can be executed by the scorpio
+  // async queue), while the second syncs them to device (and to the user
+  // fields, if they could not be aliased).
+  void read_variables_to_host (const int time_index = -1);
+  void sync_variables_to_dev ();
+
   // Cleans up the class
   void finalize();
 
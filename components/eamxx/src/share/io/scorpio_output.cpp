@@ -1,5 +1,6 @@
 #include "share/io/scorpio_output.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_expression.hpp"
 #include "share/grid/remap/coarsening_remapper.hpp"
 #include "share/grid/remap/vertical_remapper.hpp"
 #include "share/io/eamxx_io_utils.hpp"
@@ -94,6 +95,9 @@ AtmosphereOutput::AtmosphereOutput(const ekat::Comm &comm, const ekat::Parameter
 
   auto gm = field_mgr->get_grids_manager();
 
+  // Whether writes should be deferred to the async writer thread
+  m_async_write = params.get("async_write",false);
+
   // Figure out what kind of averaging is requested
   auto avg_type = params.get<std::string>("averaging_type");
   m_avg_type    = str2avg(avg_type);
@@ -415,8 +419,36 @@ run (const std::string& filename,
   if (is_write_step) {
     m_atm_logger->info("[EAMxx::scorpio_output] Writing variables to file");
     m_atm_logger->info("  file name: " + filename);
+
+    if (m_async_write) {
+      // Before recycling the staging buffer, make sure the writes that used it are done
+      start_timer("EAMxx::IO::async_wait");
+      scorpio::AsyncWriter::instance().wait(m_staging[m_staging_idx].ticket);
+      stop_timer("EAMxx::IO::async_wait");
+    }
   }
 
+  // Write a field to file. In async mode, the field is copied into a host staging buffer,
+  // and the actual write is deferred to the async writer (see end of this function)
+  std::vector<scorpio::AsyncWriter::task_t> deferred_writes;
+  auto write_field = [&](const Field& f, const std::string& varname) {
+    auto func_start = std::chrono::steady_clock::now();
+    if (m_async_write) {
+      deferred_writes.push_back(stage_for_async_write(filename,varname,f));
+    } else {
+      // Bring data to host
+      f.sync_to_host();
+      if (f.data_type()==DataType::IntType) {
+        scorpio::write_var(filename,varname,f.get_internal_view_data<int,Host>());
+      } else {
+        scorpio::write_var(filename,varname,f.get_internal_view_data<Real,Host>());
+      }
+    }
+    auto func_finish = std::chrono::steady_clock::now();
+    auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
+    duration_write += duration_loc.count();
+  };
+
   // Update all diagnostics, we need to do this before applying the remapper
   // to make sure that the remapped fields are the most up to date.
   compute_diagnostics(allow_invalid_fields);
@@ -496,14 +528,7 @@ run (const std::string& filename,
 
       // Handle writing the average count variables to file
       if (is_write_step) {
-        // Bring data to host
-        count.sync_to_host();
-
-        auto func_start = std::chrono::steady_clock::now();
-        scorpio::write_var(filename,count.name(),count.get_internal_view_data<int,Host>());
-        auto func_finish = std::chrono::steady_clock::now();
-        auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
-        duration_write += duration_loc.count();
+        write_field(count,count.name());
 
         // If it's an output step, for Avg we need to ensure count>threshold.
         // If count<=threshold, we set count=fill_value, so that fill_val propagates
@@ -544,6 +569,11 @@ run (const std::string& filename,
         "This indicates the field was marked may_be_filled after output initialization or tracking logic missed it." );
     }
 
+    // Without avg count, the last accumulation and the division by the number of steps
+    // can be done in a single pass over the field
+    const bool fuse_avg = is_write_step and output_step and
+                          m_avg_type==OutputAvgType::Average and not m_track_avg_cnt;
+
     switch (m_avg_type) {
       case OutputAvgType::Instant:
         f_out.deep_copy(f_in);  break; // Note: if f_in aliases f_out, this is a no-op
@@ -552,7 +582,12 @@ run (const std::string& filename,
       case OutputAvgType::Min:
         f_out.min(f_in);        break;
       case OutputAvgType::Average:
-        f_out.update(f_in,1,1); break;
+        if (fuse_avg) {
+          assign(f_out, (f_out + f_in)*(Real(1.0) / nsteps_since_last_output));
+        } else {
+          f_out.update(f_in,1,1);
+        }
+        break;
       default:
         EKAT_ERROR_MSG ("Unexpected/unsupported averaging type.\n");
     }
@@ -568,29 +603,68 @@ run (const std::string& filename,
 
           const auto& mask = avg_count.get_header().get_extra_data<Field>("mask");
           f_out.deep_copy(constants::fill_value<Real>,mask);
-        } else {
-          // Divide by steps count only when the summation is complete
-          f_out.scale(Real(1.0) / nsteps_since_last_output);
         }
+        // Otherwise, the division by the steps count was fused with the last accumulation
       }
 
-      // Bring data to host
-      f_out.sync_to_host();
-
       // Write using alias name for netcdf variable
-      auto func_start = std::chrono::steady_clock::now();
-      scorpio::write_var(filename,alias_name,f_out.get_internal_view_data<Real,Host>());
-      auto func_finish = std::chrono::steady_clock::now();
-      auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
-      duration_write += duration_loc.count();
+      write_field(f_out,alias_name);
     }
   }
 
   if (is_write_step) {
-    m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
+    if (m_async_write) {
+      // Hand all the writes of this step to the async writer as a single task,
+      // so that they are executed in the same order on all ranks.
+      auto& staging = m_staging[m_staging_idx];
+      staging.ticket = scorpio::AsyncWriter::instance().enqueue(
+        [writes=std::move(deferred_writes)]() {
+          for (const auto& w : writes) {
+            w();
+          }
+        });
+      m_staging_idx = 1 - m_staging_idx;
+
+      m_atm_logger->info("  Done! Elapsed time (staging for async write): " + std::to_string(duration_write/1000.0) +" seconds");
+    } else {
+      m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
+    }
   }
 } // run
 
+scorpio::AsyncWriter::task_t AtmosphereOutput::
+stage_for_async_write (const std::string& filename, const std::string& varname, const Field& f)
+{
+  // Scorpio fields are contiguous (no padding, not subfields), so we can simply
+  // copy the whole 1d allocation. The copy goes straight from the device view,
+  // so we don't touch the field's host view (which the model may be using).
+  auto snapshot = [&](auto& buffers, auto type_tag) {
+    using T = decltype(type_tag);
+    using host_view_t = Field::view_host_t<T*>;
+    using dev_view_t  = ekat::Unmanaged<Field::view_dev_t<const T*>>;
+
+    const int size = f.get_header().get_identifier().get_layout().size();
+    auto& buf = buffers[varname];
+    if (buf.extent_int(0)!=size) {
+      buf = host_view_t("staging_"+varname,size);
+    }
+    dev_view_t src (f.get_internal_view_data<const T,Device>(),size);
+    Kokkos::deep_copy(buf,src);
+
+    // Capture the view by value, so the task keeps the buffer alive
+    return scorpio::AsyncWriter::task_t([filename,varname,buf]() {
+      scorpio::write_var(filename,varname,buf.data());
+    });
+  };
+
+  auto& staging = m_staging[m_staging_idx];
+  if (f.data_type()==DataType::IntType) {
+    return snapshot(staging.ints,int(0));
+  } else {
+    return snapshot(staging.reals,Real(0));
+  }
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const
 {
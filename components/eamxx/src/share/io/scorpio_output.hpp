@@ -5,6 +5,7 @@
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
+#include "share/io/eamxx_async_writer.hpp"
 #include "share/io/eamxx_io_utils.hpp"
 #include "share/io/eamxx_scorpio_interface.hpp"
 #include "share/util/eamxx_time_stamp.hpp"
@@ -13,6 +14,8 @@
 #include <ekat_comm.hpp>
 #include <ekat_parameter_list.hpp>
 
+#include <array>
+
 /*  The AtmosphereOutput class handles an output stream in SCREAM.
  *  Typical usage is to register an AtmosphereOutput object with the OutputManager (see
  eamxx_output_manager.hpp
@@ -31,6 +34,7 @@
  *  filename_prefix:                    STRING
  *  averaging_type:                     STRING
  *  max_snapshots_per_file:             INT                   (default: 1)
+ *  async_write:                        BOOL                  (default: false)
  *  fields:
  *     GRID_NAME_1:
  *        field_names:                  ARRAY OF STRINGS
@@ -72,6 +76,9 @@
  *          remap, which is the same behavior as 'default').
  *  - max_snapshots_per_file: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - async_write: if true, at write steps the fields are copied into host staging buffers,
+ *    and the actual scorpio writes are deferred to the async writer thread (see
+ *    eamxx_async_writer.hpp), so that they can overlap with the following model steps.
  *  - Output: parameters for output control
  *    - frequency: the frequency of output writes (in the units specified by ${Output
  frequency_units})
@@ -154,6 +161,8 @@ public:
 
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase> &atm_logger);
 
+  bool is_async_write () const { return m_async_write; }
+
 protected:
   template <typename T> using strmap_t = std::map<std::string, T>;
 
@@ -170,6 +179,10 @@ protected:
   // Tracking the averaging of any filled values:
   void set_avg_cnt_tracking(const std::string &name, const FieldLayout &layout);
 
+  // Copy field data in the current staging buffer, and return the task that writes it to file
+  scorpio::AsyncWriter::task_t stage_for_async_write(const std::string &filename,
+                                                     const std::string &varname, const Field &f);
+
   // --- Internal variables --- //
   ekat::Comm m_comm;
 
@@ -231,6 +244,18 @@ protected:
   bool m_track_avg_cnt         = false;
   std::string m_decomp_dimname = "";
 
+  // Async output: at write steps, scorpio fields are copied in host staging buffers,
+  // and the writes are executed by the async writer. We keep two buffers, so that a
+  // write step can be staged while the previous one may still be in flight.
+  struct StagingBuffer {
+    strmap_t<Field::view_host_t<Real*>> reals;
+    strmap_t<Field::view_host_t<int*>>  ints;
+    scorpio::AsyncWriter::ticket_t      ticket = 0;
+  };
+  bool m_async_write = false;
+  int m_staging_idx  = 0;
+  std::array<StagingBuffer, 2> m_staging;
+
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger =
       console_logger(ekat::logger::LogLevel::warn);
 };
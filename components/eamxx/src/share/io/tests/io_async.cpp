@@ -0,0 +1,194 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/eamxx_output_manager.hpp"
+#include "share/io/eamxx_async_writer.hpp"
+#include "share/io/scorpio_input.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "eamxx_setup_random_test.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+#include "share/core/eamxx_types.hpp"
+
+#include <ekat_units.hpp>
+#include <ekat_parameter_list.hpp>
+#include <ekat_comm.hpp>
+
+#include <memory>
+
+namespace scream {
+
+constexpr int num_output_steps = 4;
+constexpr int freq = 3;
+
+void add (const Field& f, const double v) {
+  auto data = f.get_internal_view_data<Real,Host>();
+  auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
+  for (int i=0; i<nscalars; ++i) {
+    data[i] += v;
+  }
+  f.sync_to_dev();
+}
+
+util::TimeStamp get_t0 () {
+  return util::TimeStamp({2023,2,17},{0,0,0});
+}
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm)
+{
+  const int ngcols = std::max(comm.size()-1,1);
+  const int nlevs = 4;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  // Use integers, so we can check answers without risk of non bfb diffs
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_int_distribution<int> pdf (0,100);
+    Real v = pdf(engine);
+    return v;
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  std::vector<FL> layouts =
+  {
+    FL({COL         }, {nlcols        }),
+    FL({COL,     LEV}, {nlcols,  nlevs}),
+    FL({COL,CMP,ILEV}, {nlcols,2,nlevs+1})
+  };
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  const auto units = ekat::units::Units::nondimensional();
+  int count=0;
+  for (const auto& fl : layouts) {
+    FID fid("f_"+std::to_string(count),fl,units,grid->name());
+    Field f(fid);
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    ++count;
+  }
+
+  return fm;
+}
+
+void write (const std::string& prefix, const bool async,
+            const std::string& avg_type, const int seed,
+            const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("point_grid");
+
+  auto t0 = get_t0();
+  const int dt = 1;
+
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : fm->get_repo()) {
+    fnames.push_back(it.second->name());
+  }
+
+  ekat::ParameterList om_pl;
+  om_pl.set("filename_prefix",prefix);
+  om_pl.set("field_names",fnames);
+  om_pl.set("averaging_type", avg_type);
+  om_pl.set("async_write",async);
+  om_pl.set("floating_point_precision",std::string("real"));
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("frequency",freq);
+  ctrl_pl.set("save_grid_data",false);
+
+  OutputManager om;
+  om.initialize(comm,om_pl,t0,false);
+  om.setup(fm,gm->get_grid_names());
+
+  auto t = t0;
+  for (int n=0; n<num_output_steps*freq; ++n) {
+    om.init_timestep(t,dt);
+    t += dt;
+
+    // Modify the fields right after the output manager ran, so that a write
+    // that is still in flight would see the wrong data if it was not staged
+    for (const auto& name : fnames) {
+      add(fm->get_field(name),1.0);
+    }
+    om.run (t);
+  }
+
+  om.finalize();
+}
+
+TEST_CASE ("io_async") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+  auto t0 = get_t0();
+
+  for (std::string avg_type : {"INSTANT","AVERAGE"}) {
+    // Write the same data with and without async writes
+    write("io_async_sync",false,avg_type,seed,comm);
+    write("io_async_async",true,avg_type,seed,comm);
+
+    // All deferred writes must be done once the output manager is finalized
+    auto& writer = scorpio::AsyncWriter::instance();
+    writer.wait_all();
+    REQUIRE (writer.task_seconds()>=writer.hidden_seconds());
+
+    // Read both files back, and check they contain the same data
+    auto gm = get_gm (comm);
+    auto grid = gm->get_grid("point_grid");
+    auto fm_sync  = get_fm(grid,t0,-seed-1);
+    auto fm_async = get_fm(grid,t0,-seed-2);
+    std::vector<std::string> fnames;
+    for (auto it : fm_sync->get_repo()) {
+      fnames.push_back(it.second->name());
+    }
+
+    auto suffix = "." + avg_type + ".nsteps_x" + std::to_string(freq)
+                + ".np" + std::to_string(comm.size())
+                + "." + t0.to_string() + ".nc";
+
+    ekat::ParameterList pl_sync, pl_async;
+    pl_sync.set("filename","io_async_sync" + suffix);
+    pl_sync.set("field_names",fnames);
+    pl_async.set("filename","io_async_async" + suffix);
+    pl_async.set("field_names",fnames);
+    AtmosphereInput reader_sync(pl_sync,fm_sync);
+    AtmosphereInput reader_async(pl_async,fm_async);
+
+    const int num_writes = num_output_steps + (avg_type=="INSTANT" ? 1 : 0);
+    REQUIRE (scorpio::get_time_len(pl_async.get<std::string>("filename"))==num_writes);
+    for (int n=0; n<num_writes; ++n) {
+      reader_sync.read_variables(n);
+      reader_async.read_variables(n);
+      for (const auto& fn : fnames) {
+        REQUIRE (views_are_equal(fm_sync->get_field(fn),fm_async->get_field(fn)));
+      }
+    }
+  }
+
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
@@ -2,6 +2,8 @@
 
 #include "share/io/eamxx_scorpio_interface.hpp"
 
+#include <numeric>
+
 namespace scream {
 
 using namespace scorpio;
@@ -209,4 +211,98 @@ TEST_CASE ("write_and_read") {
   finalize_subsystem ();
 }
 
+TEST_CASE ("read_cache") {
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  init_subsystem (comm);
+  REQUIRE (not is_read_cache_enabled());
+
+  std::string filename = "scorpio_interface_read_cache_test_np" + std::to_string(comm.size()) + ".nc";
+
+  const int dim1 = 5;
+  auto write_file = [&](const int offset) {
+    register_file (filename,Write);
+    define_dim (filename,"dim1",dim1);
+    define_time (filename,"some_units","time");
+    define_var (filename,"var1",{"dim1"},"double",false);
+    define_var (filename,"var2",{"dim1"},"double",true);
+    enddef (filename);
+
+    std::vector<double> v(dim1);
+    std::iota (v.begin(),v.end(),offset);
+    write_var (filename,"var1",v.data());
+    for (int t=0; t<2; ++t) {
+      update_time (filename,t);
+      std::iota (v.begin(),v.end(),offset+10*(t+1));
+      write_var (filename,"var2",v.data());
+    }
+    release_file (filename);
+  };
+
+  auto check_read = [&](const int offset) {
+    std::vector<double> v(dim1), tgt(dim1);
+    read_var (filename,"var1",v.data());
+    std::iota (tgt.begin(),tgt.end(),offset);
+    REQUIRE (v==tgt);
+    for (int t=0; t<2; ++t) {
+      read_var (filename,"var2",v.data(),t);
+      std::iota (tgt.begin(),tgt.end(),offset+10*(t+1));
+      REQUIRE (v==tgt);
+    }
+  };
+
+  write_file (100);
+  set_read_cache_enabled (true);
+
+  // First read populates the cache, second read is served from it
+  register_file (filename,Read);
+  check_read (100);
+  REQUIRE (get_read_cache_num_entries()==3);
+  check_read (100);
+  REQUIRE (get_read_cache_num_entries()==3);
+
+  // Entries are also valid across open/close of the file
+  release_file (filename);
+  register_file (filename,Read);
+  check_read (100);
+  REQUIRE (get_read_cache_num_entries()==3);
+  release_file (filename);
+
+  // Overwriting the file invalidates the cached entries
+  write_file (200);
+  REQUIRE (get_read_cache_num_entries()==0);
+  register_file (filename,Read);
+  check_read (200);
+  REQUIRE (get_read_cache_num_entries()==3);
+  release_file (filename);
+
+  // Reads into node-shared memory see the same data as regular reads
+  register_file (filename,Read);
+  const double* shared = read_var_shared<double>(filename,"var1");
+  for (int i=0; i<dim1; ++i) {
+    REQUIRE (shared[i]==200+i);
+  }
+  REQUIRE (get_read_cache_num_entries()==3);
+
+  clear_read_cache ();
+  REQUIRE (get_read_cache_num_entries()==0);
+
+  // Entries larger than the max cache size are not cached, and reads go through PIO
+  set_read_cache_enabled (true,0);
+  check_read (200);
+  REQUIRE (get_read_cache_num_entries()==0);
+  REQUIRE_THROWS (read_var_shared<double>(filename,"var1"));
+  release_file (filename);
+
+  // Disabling the cache drops all entries, and reads go through PIO again
+  set_read_cache_enabled (false);
+  REQUIRE (get_read_cache_num_entries()==0);
+  register_file (filename,Read);
+  check_read (200);
+  REQUIRE (get_read_cache_num_entries()==0);
+  release_file (filename);
+
+  finalize_subsystem ();
+}
+
 } // namespace scream
@@ -0,0 +1,174 @@
+#include "share/property_checks/property_checks_batch.hpp"
+#include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/field_within_interval_check.hpp"
+
+namespace scream
+{
+
+namespace {
+
+template<typename ViewT, typename InfoT>
+void set_view_info (const ViewT& v, InfoT& info) {
+  info.data = v.data();
+  for (int i=0; i<info.rank; ++i) {
+    info.strides[i] = v.stride(i);
+  }
+}
+
+template<typename ST, typename InfoT>
+void set_field_info (const Field& f, InfoT& info) {
+  switch (info.rank) {
+    case 1: set_view_info(f.get_strided_view<const ST*     >(),info); break;
+    case 2: set_view_info(f.get_strided_view<const ST**    >(),info); break;
+    case 3: set_view_info(f.get_strided_view<const ST***   >(),info); break;
+    case 4: set_view_info(f.get_strided_view<const ST****  >(),info); break;
+    case 5: set_view_info(f.get_strided_view<const ST***** >(),info); break;
+    case 6: set_view_info(f.get_strided_view<const ST******>(),info); break;
+  }
+}
+
+} // anonymous namespace
+
+void PropertyChecksBatch::add (const prop_check_ptr& pc)
+{
+  EKAT_REQUIRE_MSG (pc!=nullptr,
+      "Error! Invalid property check pointer.\n");
+
+  m_checks.push_back(pc);
+  m_setup_done = false;
+}
+
+void PropertyChecksBatch::setup () const
+{
+  const int nchecks = m_checks.size();
+  m_can_screen.assign(nchecks,false);
+  m_team_check_h.clear();
+
+  m_info = decltype(m_info)("screen info",nchecks);
+  auto info_h = Kokkos::create_mirror_view(m_info);
+  for (int i=0; i<nchecks; ++i) {
+    const auto& pc = m_checks[i];
+    auto nan_pc = dynamic_cast<const FieldNaNCheck*>(pc.get());
+    auto int_pc = dynamic_cast<const FieldWithinIntervalCheck*>(pc.get());
+    if (nan_pc==nullptr and int_pc==nullptr) {
+      continue;
+    }
+
+    const auto& f = pc->fields().front();
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const auto dt = f.data_type();
+    // NOTE: we store the data pointer, so skip dynamic subfields, whose
+    //       data pointer can change at runtime.
+    if ((dt!=DataType::DoubleType and dt!=DataType::FloatType) or
+        fl.rank()<1 or fl.rank()>MAX_RANK or fl.size()==0 or
+        f.get_header().get_alloc_properties().is_dynamic_subfield()) {
+      continue;
+    }
+
+    auto& info = info_h(i);
+    info.is_double = dt==DataType::DoubleType;
+    info.nan_only  = nan_pc!=nullptr;
+    info.lb = int_pc ? int_pc->lower_bound() : 0;
+    info.ub = int_pc ? int_pc->upper_bound() : 0;
+    info.rank = fl.rank();
+    info.size = fl.size();
+    for (int d=0; d<info.rank; ++d) {
+      info.dims[d] = fl.dim(d);
+    }
+    if (info.is_double) {
+      set_field_info<double>(f,info);
+    } else {
+      set_field_info<float>(f,info);
+    }
+
+    m_can_screen[i] = true;
+    const int nchunks = (info.size + s_chunk_size - 1) / s_chunk_size;
+    m_team_check_h.insert(m_team_check_h.end(),nchunks,i);
+  }
+  Kokkos::deep_copy(m_info,info_h);
+
+  // Map each team to its check and chunk
+  const int nteams = m_team_check_h.size();
+  m_team_check = decltype(m_team_check)("team check",nteams);
+  m_team_chunk = decltype(m_team_chunk)("team chunk",nteams);
+  m_team_fail  = decltype(m_team_fail)("team fail",nteams);
+  auto team_check_h = Kokkos::create_mirror_view(m_team_check);
+  auto team_chunk_h = Kokkos::create_mirror_view(m_team_chunk);
+  for (int t=0; t<nteams; ++t) {
+    // Store the first entry of each chunk
+    team_check_h(t) = m_team_check_h[t];
+    team_chunk_h(t) = t>0 and m_team_check_h[t]==m_team_check_h[t-1]
+                    ? team_chunk_h(t-1) + s_chunk_size : 0;
+  }
+  Kokkos::deep_copy(m_team_check,team_check_h);
+  Kokkos::deep_copy(m_team_chunk,team_chunk_h);
+
+  m_setup_done = true;
+}
+
+std::vector<bool> PropertyChecksBatch::screen () const
+{
+  if (not m_setup_done) {
+    setup();
+  }
+
+  // By default, run each check individually
+  const int nchecks = m_checks.size();
+  std::vector<bool> must_run(nchecks);
+  for (int i=0; i<nchecks; ++i) {
+    must_run[i] = not m_can_screen[i];
+  }
+
+  const int nteams = m_team_check_h.size();
+  if (nteams==0) {
+    return must_run;
+  }
+
+  using TeamPolicy = Kokkos::TeamPolicy<KT::ExeSpace>;
+  using TeamMember = typename TeamPolicy::member_type;
+  constexpr int chunk_size = s_chunk_size;
+
+  auto info  = m_info;
+  auto check = m_team_check;
+  auto beg   = m_team_chunk;
+  auto fail  = m_team_fail;
+  auto policy = TeamPolicy(nteams,Kokkos::AUTO());
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const TeamMember& team) {
+    const int t = team.league_rank();
+    const auto& ci = info(check(t));
+    const int ibeg = beg(t);
+    const int iend = ibeg+chunk_size<ci.size ? ibeg+chunk_size : ci.size;
+
+    int nfail = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,ibeg,iend),
+                            [&](const int idx, int& nfail) {
+      // Unflatten idx, and compute the offset in the (possibly strided) view
+      int offset = 0;
+      int rem = idx;
+      for (int d=ci.rank-1; d>=0; --d) {
+        offset += (rem % ci.dims[d])*ci.strides[d];
+        rem /= ci.dims[d];
+      }
+      const double v = ci.is_double ? static_cast<const double*>(ci.data)[offset]
+                                    : static_cast<const float*>(ci.data)[offset];
+      // NOTE: for interval checks, NaN's also fail, so that the check is
+      //       run individually, and handles them as it normally would.
+      const bool ok = ci.nan_only ? not Kokkos::isnan(v)
+                                  : (v>=ci.lb and v<=ci.ub);
+      if (not ok) ++nfail;
+    }, nfail);
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      fail(t) = nfail;
+    });
+  });
+  auto fail_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),m_team_fail);
+
+  for (int t=0; t<nteams; ++t) {
+    if (fail_h(t)>0) {
+      must_run[m_team_check_h[t]] = true;
+    }
+  }
+  return must_run;
+}
+
+} // namespace scream
@@ -0,0 +1,76 @@
+#ifndef SCREAM_PROPERTY_CHECKS_BATCH_HPP
+#define SCREAM_PROPERTY_CHECKS_BATCH_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/core/eamxx_types.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A batch of property checks, which can be screened all at once.
+ *
+ * Running each check separately means at least one reduction (and fence)
+ * per check. However, most of the times checks pass, and we do not need
+ * the detailed info (e.g., min/max location) that each check computes.
+ * This class fuses the pass/fail logic of all the NaN and within-interval
+ * checks in the batch in a single device kernel, which only tells whether
+ * each check might fail. Only those checks (and the ones that cannot be
+ * screened, e.g., because of their type) need to be run individually.
+ *
+ * The screening is conservative: if it says a check passes, then running
+ * the check would return CheckResult::Pass.
+ */
+
+class PropertyChecksBatch
+{
+public:
+  using prop_check_ptr = std::shared_ptr<const PropertyCheck>;
+
+  // Add a check to the batch. Checks are screened in the order they are added.
+  void add (const prop_check_ptr& pc);
+
+  int size () const { return m_checks.size(); }
+
+  // For each check in the batch, return whether it must be run individually,
+  // that is, whether it may not pass, or it cannot be screened.
+  std::vector<bool> screen () const;
+
+private:
+
+  // Build the device views needed by the screening kernel
+  void setup () const;
+
+  std::vector<prop_check_ptr>   m_checks;
+
+  // Each team of the screening kernel handles (at most) this many entries of a check
+  static constexpr int s_chunk_size = 4096;
+
+  // Info needed to screen each check, built lazily upon the first call to screen()
+  static constexpr int MAX_RANK = 6;
+  struct ScreenInfo {
+    const void* data;
+    bool        is_double;
+    bool        nan_only;  // If true, only check for NaN's, otherwise check [lb,ub]
+    double      lb, ub;
+    int         rank;
+    int         size;
+    int         dims[MAX_RANK];
+    int         strides[MAX_RANK];
+  };
+  using KT = KokkosTypes<DefaultDevice>;
+  mutable KT::view_1d<ScreenInfo>   m_info;
+  mutable KT::view_1d<int>          m_team_check;
+  mutable KT::view_1d<int>          m_team_chunk;  // First entry of each team's chunk
+  mutable std::vector<int>          m_team_check_h;
+  mutable KT::view_1d<int>          m_team_fail;
+  mutable std::vector<bool>         m_can_screen;
+  mutable bool                      m_setup_done = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_PROPERTY_CHECKS_BATCH_HPP
@@ -206,6 +206,11 @@ public:
     add_field<Required>("Temperature",lt,K,m_grid_name);
     add_field<Computed>("Concentration A",lt,kg/pow(m,3),m_grid_name);
   }
+
+  // Like radiation, Bar can be set to only update its outputs every few steps
+  bool computes_fields_every_step () const {
+    return not m_params.isParameter("frequency") or m_params.get<int>("frequency")==1;
+  }
 };
 
 class Baz : public DummyProcess
@@ -388,6 +393,44 @@ TEST_CASE("atm_proc_dag", "") {
 
     REQUIRE (dag.has_unmet_dependencies());
   }
+
+  SECTION ("lifetimes") {
+    auto params = create_test_params ();
+    std::shared_ptr<AtmosphereProcess> atm_process (factory.create("group",comm,params));
+    atm_process->set_grids(gm);
+
+    // Lifetimes only rely on the field requests, so there is no need to create fields
+    AtmProcDAG dag;
+    auto lifetimes = dag.compute_field_lifetimes(*std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_process));
+    const auto& lt = lifetimes.at("point_grid");
+
+    // Foo requires the temperature tendency before Baz computes it, so that one
+    // holds data from the previous time step
+    REQUIRE (lt.size()==2);
+    REQUIRE (lt.count("Temperature tendency")==0);
+    REQUIRE (lt.at("Temperature").first==0);
+    REQUIRE (lt.at("Temperature").last==2);
+    REQUIRE (lt.at("Concentration A").first==1);
+    REQUIRE (lt.at("Concentration A").last==2);
+  }
+
+  SECTION ("lifetimes_freq_gated") {
+    auto params = create_test_params ();
+    params.sublist("BarBaz").sublist("Bar").set("frequency",3);
+    std::shared_ptr<AtmosphereProcess> atm_process (factory.create("group",comm,params));
+    atm_process->set_grids(gm);
+
+    AtmProcDAG dag;
+    auto lifetimes = dag.compute_field_lifetimes(*std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_process));
+    const auto& lt = lifetimes.at("point_grid");
+
+    // Bar only updates Concentration A every 3 steps, while Baz reads it at every
+    // step, so it must keep its value across steps
+    REQUIRE (lt.size()==1);
+    REQUIRE (lt.count("Concentration A")==0);
+    REQUIRE (lt.at("Temperature").first==0);
+    REQUIRE (lt.at("Temperature").last==2);
+  }
 }
 
 TEST_CASE("field_checks", "") {
@@ -6,6 +6,9 @@
 #include "eamxx_setup_random_test.hpp"
 #include "share/field/field_utils.hpp"
 
+#include <filesystem>
+#include <iterator>
+
 namespace scream {
 
 class CoarseningRemapperTester : public CoarseningRemapper {
@@ -514,4 +517,82 @@ TEST_CASE("coarsening_remap")
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE("coarsening_remap_partitioned_map")
+{
+  // Check that loading the triplets from a pre-partitioned file
+  // yields the same CRS matrix as reading the original map file
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  root_print ("\n +---------------------------------------------+\n",comm);
+  root_print (" |   Testing pre-partitioned remap map files   |\n",comm);
+  root_print (" +---------------------------------------------+\n\n",comm);
+
+  scorpio::init_subsystem(comm);
+  auto engine = setup_random_test (&comm);
+
+  std::string filename = "cr_tests_part_map." + std::to_string(comm.size()) + ".nc";
+
+  const int nldofs_tgt = 2;
+  const int ngdofs_tgt = nldofs_tgt*comm.size();
+  create_remap_file(filename, ngdofs_tgt);
+
+  const int ngdofs_src = ngdofs_tgt+1;
+  auto src_grid = build_src_grid(comm, ngdofs_src, engine);
+
+  // Use a dedicated folder, and start from scratch, so a stale file from a previous
+  // run cannot be picked up by the first remapper. Do not create the folder: the
+  // remap data must create it when writing the pre-partitioned file.
+  const std::string part_dir = "cr_tests_part_maps.np" + std::to_string(comm.size());
+  auto remove_part_dir = [&]() {
+    if (comm.am_i_root()) {
+      std::filesystem::remove_all(part_dir);
+    }
+    comm.barrier();
+  };
+  remove_part_dir();
+  HorizRemapperData::set_partitioned_maps_dir(part_dir);
+  const int num_loads = HorizRemapperData::get_num_partitioned_loads();
+
+  // The first remapper reads the map file, and creates the pre-partitioned one
+  auto remap = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  auto row_offsets = cmvdc(remap->get_row_offsets());
+  auto col_lids    = cmvdc(remap->get_col_lids());
+  auto weights     = cmvdc(remap->get_weights());
+  auto tgt_gids    = remap->get_coarse_grid()->get_dofs_gids().clone();
+
+  // Destroy the remapper, so that the remap data is erased from the cache
+  remap = nullptr;
+
+  // The pre-partitioned file was created, but not loaded
+  auto part_dir_it = std::filesystem::directory_iterator(part_dir);
+  REQUIRE (std::distance(begin(part_dir_it),end(part_dir_it))==1);
+  REQUIRE (HorizRemapperData::get_num_partitioned_loads()==num_loads);
+
+  // The second remapper loads the pre-partitioned file
+  remap = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  REQUIRE (HorizRemapperData::get_num_partitioned_loads()==num_loads+1);
+  REQUIRE (views_are_equal(tgt_gids,remap->get_coarse_grid()->get_dofs_gids()));
+
+  auto row_offsets_2 = cmvdc(remap->get_row_offsets());
+  auto col_lids_2    = cmvdc(remap->get_col_lids());
+  auto weights_2     = cmvdc(remap->get_weights());
+  REQUIRE (row_offsets.size()==row_offsets_2.size());
+  REQUIRE (col_lids.size()==col_lids_2.size());
+  for (size_t i=0; i<row_offsets.size(); ++i) {
+    REQUIRE (row_offsets(i)==row_offsets_2(i));
+  }
+  for (size_t i=0; i<col_lids.size(); ++i) {
+    REQUIRE (col_lids(i)==col_lids_2(i));
+    REQUIRE (weights(i)==weights_2(i));
+  }
+
+  remap = nullptr;
+  HorizRemapperData::set_partitioned_maps_dir("");
+  remove_part_dir();
+
+  // Clean up scorpio stuff
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
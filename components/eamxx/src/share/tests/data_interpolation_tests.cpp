@@ -52,7 +52,8 @@ void root_print (const ekat::Comm& comm,
 void run_tests (const std::shared_ptr<const AbstractGrid>& grid,
                 const strvec_t& input_files, util::TimeStamp t_beg,
                 const util::TimeLine timeline,
-                const DataInterpolation::VRemapType vr_type = DataInterpolation::None)
+                const DataInterpolation::VRemapType vr_type = DataInterpolation::None,
+                const bool prefetch = false)
 {
   auto t_end = t_beg + t_beg.days_in_curr_month()*spd;
   auto t0 = t_beg + (t_end-t_beg)/2;
@@ -122,6 +123,7 @@ void run_tests (const std::shared_ptr<const AbstractGrid>& grid,
   int nfields = fields.size();
   auto interp = create_interp(grid,fields);
   interp->setup_time_database(input_files,util::TimeLine::YearlyPeriodic);
+  interp->set_prefetch (prefetch);
   interp->create_horiz_remappers (map_file);
   interp->create_vert_remapper (vremap_data);
   interp->init_data_interval(t0);
@@ -317,6 +319,19 @@ TEST_CASE ("interpolation")
         root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=p3d ......... PASS\n");
       }
     }
+
+    SECTION ("prefetch") {
+      SECTION ("no-horiz") {
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=NO,  vert_remap=NO,  prefetch\n");
+        run_tests (data_grid,files,t_beg,timeline,NOP,true);
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=NO,  vert_remap=NO,  prefetch PASS\n");
+      }
+      SECTION ("yes-horiz") {
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=p3d, prefetch\n");
+        run_tests (hvfine_grid,files_no_ilev,t_beg,timeline,P3D,true);
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=p3d, prefetch PASS\n");
+      }
+    }
   }
 
   SECTION ("linear") {
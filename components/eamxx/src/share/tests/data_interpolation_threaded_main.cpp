@@ -0,0 +1,47 @@
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+
+#include "share/core/eamxx_session.hpp"
+#include "share/io/eamxx_async_writer.hpp"
+
+#include <ekat_assert.hpp>
+
+#include <mpi.h>
+
+#include <cstdio>
+
+/*
+ * Runs the data_interpolation tests with MPI initialized with MPI_THREAD_MULTIPLE,
+ * so that the prefetch reads are actually executed by the AsyncWriter thread,
+ * while the model thread keeps running (and communicating) on all ranks.
+ */
+
+int main (int argc, char** argv)
+{
+  int provided;
+  MPI_Init_thread(&argc,&argv,MPI_THREAD_MULTIPLE,&provided);
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD,&rank);
+
+  int num_failed = 0;
+  if (provided!=MPI_THREAD_MULTIPLE) {
+    // Nothing to test here: the other data_interpolation test already covers the serial path
+    if (rank==0) {
+      printf("MPI does not provide MPI_THREAD_MULTIPLE. Skipping threaded prefetch tests.\n");
+    }
+  } else {
+    scream::initialize_eamxx_session(argc,argv,rank==0);
+    {
+      EKAT_REQUIRE_MSG (scream::scorpio::AsyncWriter::instance().is_async(),
+          "Error! AsyncWriter is not async, despite MPI_THREAD_MULTIPLE.\n");
+
+      Catch::Session session;
+      num_failed = session.run(argc,argv);
+    }
+    scream::finalize_eamxx_session();
+  }
+
+  MPI_Finalize();
+  return num_failed!=0 ? 1 : 0;
+}
@@ -7,6 +7,7 @@
 #include "share/field/field_manager.hpp"
 #include "share/field/field_utils.hpp"
 #include "share/field/field_impl.hpp"
+#include "share/field/field_expression.hpp"
 #include "eamxx_setup_random_test.hpp"
 
 #include "share/grid/point_grid.hpp"
@@ -553,6 +554,90 @@ TEST_CASE("field_mgr", "") {
   REQUIRE_THROWS (field_mgr.add_field(f2_1_sf)); // Cannot have duplicates
 }
 
+TEST_CASE("field_mgr_transient_fields", "") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using FID = FieldIdentifier;
+  using FR  = FieldRequest;
+
+  SECTION ("planner") {
+    FieldMemoryPlanner plan;
+    plan.add_field("A",1000,{0,1});
+    plan.add_field("B",500,{2,3});
+    plan.add_field("C",200,{1,2});
+    plan.add_field("D",300,{3,4});
+    REQUIRE_THROWS (plan.add_field("A",10,{0,0})); // Duplicate
+    REQUIRE_THROWS (plan.add_field("E",10,{1,0})); // Bad lifetime
+    plan.plan();
+
+    // A and B do not overlap in time, so B goes at the beginning of the arena.
+    // C overlaps with both A and B, and D overlaps with B only.
+    REQUIRE (plan.get_offset("A")==0);
+    REQUIRE (plan.get_offset("B")==0);
+    REQUIRE (plan.get_offset("D")==512);
+    REQUIRE (plan.get_offset("C")==1024);
+    REQUIRE (plan.arena_size()==1224);
+    REQUIRE (plan.total_size()==2000);
+  }
+
+  SECTION ("field_mgr") {
+    const int ncols = 4;
+    const int nlevs = 7;
+
+    ekat::Comm comm(MPI_COMM_WORLD);
+    auto grid = create_point_grid("grid",ncols*comm.size(),nlevs,comm);
+    FieldManager field_mgr(grid);
+
+    FieldLayout lt ({COL,LEV},{ncols,nlevs});
+    FID fid_a("A",lt,m/s,"grid");
+    FID fid_b("B",lt,m/s,"grid");
+    FID fid_c("C",lt,m/s,"grid");
+    FID fid_g("G",lt,m/s,"grid");
+
+    field_mgr.register_field(FR(fid_a));
+    field_mgr.register_field(FR(fid_b));
+    field_mgr.register_field(FR(fid_c));
+    field_mgr.register_field(FR(fid_g,"group"));
+
+    std::map<std::string,FieldLifetime> lifetimes = {
+      {"A",{0,1}}, {"B",{2,3}}, {"C",{1,2}}, {"G",{3,4}}
+    };
+    field_mgr.set_field_lifetimes("grid",lifetimes);
+    field_mgr.registration_ends();
+
+    REQUIRE_THROWS (field_mgr.set_field_lifetimes("grid",lifetimes)); // Repo is closed
+
+    // Group members are never aliased
+    const auto& plan = field_mgr.get_memory_plan("grid");
+    REQUIRE (plan.num_fields()==3);
+    REQUIRE (not plan.has_field("G"));
+    REQUIRE (plan.arena_size()<plan.total_size());
+
+    auto a = field_mgr.get_field("A");
+    auto b = field_mgr.get_field("B");
+    auto c = field_mgr.get_field("C");
+    auto g = field_mgr.get_field("G");
+    REQUIRE (a.get_internal_view_data<Real>()==b.get_internal_view_data<Real>());
+    REQUIRE (a.get_internal_view_data<Real>()!=c.get_internal_view_data<Real>());
+
+    // Fields in the arena are regular fields
+    a.deep_copy(1.0);
+    c.deep_copy(2.0);
+    g.deep_copy(3.0);
+    a.sync_to_host();
+    c.sync_to_host();
+    auto a_h = a.get_view<const Real**,Host>();
+    auto c_h = c.get_view<const Real**,Host>();
+    for (int i=0; i<ncols; ++i) {
+      for (int k=0; k<nlevs; ++k) {
+        REQUIRE (a_h(i,k)==1.0);
+        REQUIRE (c_h(i,k)==2.0);
+      }
+    }
+  }
+}
+
 TEST_CASE("tracers_group", "") {
   using namespace scream;
   using namespace ekat::units;
@@ -1012,6 +1097,71 @@ TEST_CASE ("update") {
       REQUIRE (views_are_equal(f2,one));
     }
   }
+
+  SECTION ("expression") {
+    Field x = f_real.clone("x");
+    Field y = f_real.clone("y");
+    Field z = f_real.clone("z");
+    randomize (z,engine,RPDF(1,2));
+
+    // Fused y = y/z + 2*x, vs a chain of updates
+    Field y_ref = y.clone("y_ref");
+    y_ref.scale_inv(z);
+    y_ref.update(x,2,1);
+    assign(y, y/z + 2*x);
+    REQUIRE (views_are_equal(y,y_ref));
+
+    // max/min and negation
+    Field lo = f_real.clone("lo");
+    lo.deep_copy(0.25);
+    assign(y, min(max(x,lo),0.75) + -(-z));
+    y_ref.deep_copy(x);
+    y_ref.max(lo);
+    lo.deep_copy(0.75);
+    y_ref.min(lo);
+    y_ref.update(z,1,1);
+    REQUIRE (views_are_equal(y,y_ref));
+
+    // Packed fields and subfields
+    Field p (fid_r);
+    p.get_header().get_alloc_properties().request_allocation(16);
+    p.allocate_view();
+    p.deep_copy(x);
+    for (int icmp=0; icmp<ncmp; ++icmp) {
+      auto p_i = p.subfield(1,icmp);
+      auto x_i = x.subfield(1,icmp);
+      auto y_i = y.subfield(1,icmp);
+      assign(y_i, p_i*icmp + x_i);
+    }
+    y_ref.deep_copy(x);
+    for (int icmp=0; icmp<ncmp; ++icmp) {
+      y_ref.subfield(1,icmp).scale(Real(icmp+1));
+    }
+    REQUIRE (views_are_equal(y,y_ref));
+
+    // Entries where a fill-aware operand is filled are left untouched
+    Field one = f_real.clone("one");
+    one.deep_copy(1.0);
+    Field filled = f_real.clone("filled");
+    filled.deep_copy(constants::fill_value<Real>);
+    filled.get_header().set_may_be_filled(true);
+    y.deep_copy(1.0);
+    assign(y, y + 2*filled);
+    REQUIRE (views_are_equal(y,one));
+
+    // Masked assignment only touches entries where mask!=0
+    auto mask = f_int.clone("mask");
+    compute_mask<Comparison::GT>(x,Real(0.5),mask);
+    y.deep_copy(x);
+    assign(y, 0*x, mask);
+    y_ref.deep_copy(x);
+    y_ref.deep_copy(0,mask);
+    REQUIRE (views_are_equal(y,y_ref));
+
+    // Invalid operands
+    REQUIRE_THROWS (assign(y, x + x.subfield(1,0)));
+    REQUIRE_THROWS (assign(f_int, 2*x));
+  }
 }
 
 TEST_CASE ("sync_subfields") {
@@ -1030,4 +1030,87 @@ TEST_CASE ("transpose") {
   }
 }
 
+TEST_CASE ("hash_fields") {
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+  using HashType = bfbhash::HashType;
+
+  using P8 = ekat::Pack<Real,8>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto engine = setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(-1,1);
+
+  const int ncols = 3;
+  const int ncmp  = 2;
+  const int nlevs = 10;
+  const int nbig  = 5000; // Spans several chunks in hash_fields
+  const auto u = ekat::units::m;
+
+  FieldIdentifier fid1d ("f1d", {{COL},{ncols}}, u, "some_grid");
+  FieldIdentifier fid2d ("f2d", {{COL,LEV},{ncols,nlevs}}, u, "some_grid");
+  FieldIdentifier fid3d ("f3d", {{COL,CMP,LEV},{ncols,ncmp,nlevs}}, u, "some_grid");
+  FieldIdentifier fid4d ("f4d", {{COL,CMP,CMP,LEV},{ncols,ncmp,ncmp,nlevs}}, u, "some_grid");
+  FieldIdentifier fidbig("fbig", {{COL,LEV},{ncols,nbig}}, u, "some_grid");
+
+  Field f1d(fid1d), f2d(fid2d), f3d(fid3d), f4d(fid4d), fbig(fidbig);
+  // Padding must not be hashed
+  f2d.get_header().get_alloc_properties().request_allocation(P8::n);
+  for (auto f : {&f1d,&f2d,&f3d,&f4d,&fbig}) {
+    f->allocate_view();
+    randomize(*f,engine,pdf);
+  }
+  // A subfield, whose view is not contiguous
+  auto f3d_1 = f3d.get_component(1);
+
+  // Hash all entries of a field, one at a time, on host
+  auto hash_field = [](const Field& f) {
+    f.sync_to_host();
+    const auto& lo = f.get_header().get_identifier().get_layout();
+    HashType h = 0;
+    if (lo.rank()==1) {
+      auto v = f.get_view<const Real*,Host>();
+      for (int i=0; i<lo.dim(0); ++i)
+        bfbhash::hash(v(i),h);
+    } else if (lo.rank()==2) {
+      auto v = f.get_view<const Real**,Host>();
+      for (int i=0; i<lo.dim(0); ++i)
+        for (int j=0; j<lo.dim(1); ++j)
+          bfbhash::hash(v(i,j),h);
+    } else if (lo.rank()==3) {
+      auto v = f.get_view<const Real***,Host>();
+      for (int i=0; i<lo.dim(0); ++i)
+        for (int j=0; j<lo.dim(1); ++j)
+          for (int k=0; k<lo.dim(2); ++k)
+            bfbhash::hash(v(i,j,k),h);
+    } else if (lo.rank()==4) {
+      auto v = f.get_view<const Real****,Host>();
+      for (int i=0; i<lo.dim(0); ++i)
+        for (int j=0; j<lo.dim(1); ++j)
+          for (int k=0; k<lo.dim(2); ++k)
+            for (int l=0; l<lo.dim(3); ++l)
+              bfbhash::hash(v(i,j,k,l),h);
+    }
+    return h;
+  };
+
+  std::vector<Field> fields = {f1d,f2d,f3d,f4d,fbig,f3d_1};
+  auto hashes = hash_fields(fields);
+  REQUIRE (hashes.size()==fields.size());
+  for (size_t i=0; i<fields.size(); ++i) {
+    REQUIRE (hashes[i]==hash_field(fields[i]));
+  }
+
+  // Changing one entry changes the hash of that field only
+  f2d.get_view<Real**,Host>()(1,2) += 1;
+  f2d.sync_to_dev();
+  auto hashes_new = hash_fields(fields);
+  for (size_t i=0; i<fields.size(); ++i) {
+    REQUIRE ((hashes_new[i]==hashes[i])==(i!=1));
+  }
+
+  REQUIRE (hash_fields({}).empty());
+}
+
 } // anonymous namespace
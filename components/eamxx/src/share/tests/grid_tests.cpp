@@ -176,6 +176,30 @@ TEST_CASE ("gid2lid_map") {
   for (const auto& it : gid2lid) {
     REQUIRE (it.first==dofs_h[it.second]);
   }
+
+  SECTION ("gid2lid_index") {
+    // Host lookup, including gids owned by other ranks
+    const auto& index_h = grid->get_gid2lid_index<Host>();
+    for (int i=0; i<num_global_dofs; ++i) {
+      const auto gid = all_dofs[i];
+      const int expected = (i>=offset and i<offset+num_local_dofs) ? i-offset : -1;
+      REQUIRE (index_h.lid(gid)==expected);
+    }
+
+    // Batched lookup on device
+    using KT = KokkosTypes<DefaultDevice>;
+    KT::view_1d<gid_type> gids("gids",num_global_dofs);
+    KT::view_1d<int> lids("lids",num_global_dofs);
+    auto gids_h = Kokkos::create_mirror_view(gids);
+    std::copy(all_dofs.begin(),all_dofs.end(),gids_h.data());
+    Kokkos::deep_copy(gids,gids_h);
+
+    grid->gids_to_lids(gids,lids);
+    auto lids_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lids);
+    for (int i=0; i<num_global_dofs; ++i) {
+      REQUIRE (lids_h(i)==index_h.lid(gids_h(i)));
+    }
+  }
 }
 
 TEST_CASE ("get_remote_pids_and_lids") {
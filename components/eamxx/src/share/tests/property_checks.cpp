@@ -5,6 +5,7 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/property_checks_batch.hpp"
 #include "eamxx_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
@@ -309,6 +310,49 @@ TEST_CASE("property_checks", "") {
       REQUIRE(f_data[i] == 1.0);
     }
   }
+
+  // Screen several checks at once
+  SECTION ("checks_batch") {
+    // A subfield, so that the batch has to handle non-contiguous data
+    auto f1 = f.get_component(1);
+
+    PropertyChecksBatch batch;
+    batch.add(std::make_shared<FieldNaNCheck>(f,grid));
+    batch.add(std::make_shared<FieldWithinIntervalCheck>(f,grid,0,1));
+    batch.add(std::make_shared<FieldLowerBoundCheck>(f1,grid,0.25));
+    batch.add(std::make_shared<FieldUpperBoundCheck>(f1,grid,0.75));
+    REQUIRE (batch.size()==4);
+
+    auto f_view = f.get_strided_view<Real***,Host>();
+    auto set = [&](const Real val) {
+      Kokkos::deep_copy(f_view,val);
+      f.sync_to_dev();
+    };
+
+    // All pass
+    set(0.5);
+    REQUIRE (batch.screen()==std::vector<bool>{false,false,false,false});
+
+    // Out of [0,1], but only in a slice other than f1
+    f_view(1,0,3) = 2.0;
+    f.sync_to_dev();
+    REQUIRE (batch.screen()==std::vector<bool>{false,true,false,false});
+
+    // Out of [0.25,0.75] within f1
+    set(0.5);
+    f_view(0,1,nlevs-1) = 0.9;
+    f.sync_to_dev();
+    REQUIRE (batch.screen()==std::vector<bool>{false,false,false,true});
+    f_view(0,1,nlevs-1) = 0.1;
+    f.sync_to_dev();
+    REQUIRE (batch.screen()==std::vector<bool>{false,false,true,false});
+
+    // NaN's fail all the checks on the field
+    set(0.5);
+    f_view(1,1,2) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+    REQUIRE (batch.screen()==std::vector<bool>{true,true,true,true});
+  }
 }
 
 } // anonymous namespace
@@ -1,9 +1,98 @@
 #include "share/util/eamxx_timing.hpp"
 
+#include <ekat_assert.hpp>
+
+#include <Kokkos_Core.hpp>
 #include <gptl.h>
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
 namespace scream {
 
+namespace {
+
+// NOTE: GPTL handles are per-thread, so registered timers should only be
+//       started/stopped by the master thread (which is what we always do).
+struct TimerEntry {
+  std::string name;
+  void*       gptl_handle = nullptr;
+};
+
+// Start time and duration are in microseconds since the trace was enabled
+struct TraceEvent {
+  int    id;
+  double start;
+  double duration;
+};
+
+struct TimersRegistry {
+  std::vector<TimerEntry>             timers;
+  std::unordered_map<std::string,int> name_to_id;
+
+  bool        trace_enabled = false;
+  std::size_t max_events    = 0;
+  long long   num_dropped   = 0;
+
+  std::chrono::steady_clock::time_point trace_t0;
+
+  // The (id,start) of the timers currently running, and the completed events
+  std::vector<std::pair<int,double>>  running;
+  std::vector<TraceEvent>             events;
+};
+
+TimersRegistry& registry () {
+  static TimersRegistry r;
+  return r;
+}
+
+double trace_time () {
+  const auto elapsed = std::chrono::steady_clock::now() - registry().trace_t0;
+  return std::chrono::duration<double,std::micro>(elapsed).count();
+}
+
+void trace_start (const int id) {
+  auto& r = registry();
+  r.running.emplace_back(id,trace_time());
+}
+
+void trace_stop (const int id) {
+  auto& r = registry();
+  const double now = trace_time();
+
+  // Timers are usually nested, so the one to stop is likely the last one started
+  auto it = std::find_if(r.running.rbegin(),r.running.rend(),
+                         [&](const std::pair<int,double>& t) { return t.first==id; });
+  if (it==r.running.rend()) {
+    // Started before the trace was enabled
+    return;
+  }
+  const double start = it->second;
+  r.running.erase(std::next(it).base());
+
+  if (r.events.size()<r.max_events) {
+    r.events.push_back(TraceEvent{id,start,now-start});
+  } else {
+    ++r.num_dropped;
+  }
+}
+
+std::string json_escape (const std::string& s) {
+  std::string out;
+  for (char c : s) {
+    if (c=='"' or c=='\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out;
+}
+
+} // anonymous namespace
+
 void init_gptl (bool& was_already_inited) {
 #ifdef SCREAM_CIME_BUILD
   was_already_inited = true;
@@ -13,19 +102,157 @@ void init_gptl (bool& was_already_inited) {
 #endif
 }
 void finalize_gptl () {
+  // GPTL handles are no longer valid
+  for (auto& t : registry().timers) {
+    t.gptl_handle = nullptr;
+  }
   GPTLfinalize();
 }
 
 void start_timer (const std::string& name) {
   GPTLstart(name.c_str());
+  if (registry().trace_enabled) {
+    trace_start(register_timer(name));
+  }
 }
 
 void stop_timer (const std::string& name) {
   GPTLstop(name.c_str());
+  if (registry().trace_enabled) {
+    trace_stop(register_timer(name));
+  }
 }
 
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
   GPTLpr_summary_file (comm.mpi_comm(),fname.c_str());
 }
 
+int register_timer (const std::string& name) {
+  auto& r = registry();
+  auto it = r.name_to_id.find(name);
+  if (it!=r.name_to_id.end()) {
+    return it->second;
+  }
+
+  const int id = r.timers.size();
+  r.timers.push_back(TimerEntry{name,nullptr});
+  r.name_to_id[name] = id;
+  return id;
+}
+
+void start_timer (const int id, const bool fence) {
+  auto& r = registry();
+  EKAT_ASSERT_MSG (id>=0 and id<static_cast<int>(r.timers.size()),
+      "Error! Invalid timer id: " + std::to_string(id) + "\n");
+
+  if (fence) {
+    Kokkos::fence();
+  }
+  auto& t = r.timers[id];
+  GPTLstart_handle(t.name.c_str(),&t.gptl_handle);
+  if (r.trace_enabled) {
+    trace_start(id);
+  }
+}
+
+void stop_timer (const int id, const bool fence) {
+  auto& r = registry();
+  EKAT_ASSERT_MSG (id>=0 and id<static_cast<int>(r.timers.size()),
+      "Error! Invalid timer id: " + std::to_string(id) + "\n");
+
+  if (fence) {
+    Kokkos::fence();
+  }
+  auto& t = r.timers[id];
+  GPTLstop_handle(t.name.c_str(),&t.gptl_handle);
+  if (r.trace_enabled) {
+    trace_stop(id);
+  }
+}
+
+void enable_timers_trace (const ekat::Comm& comm, const int max_events) {
+  EKAT_REQUIRE_MSG (max_events>0,
+      "Error! The max number of timer trace events must be positive.\n"
+      "  - max_events: " + std::to_string(max_events) + "\n");
+
+  auto& r = registry();
+  r.max_events = max_events;
+  r.num_dropped = 0;
+  r.running.clear();
+  r.events.clear();
+  r.events.reserve(std::min(max_events,10000));
+
+  // Align the time origin of all ranks (as much as we can)
+  comm.barrier();
+  r.trace_t0 = std::chrono::steady_clock::now();
+  r.trace_enabled = true;
+}
+
+void disable_timers_trace () {
+  registry().trace_enabled = false;
+}
+
+bool timers_trace_enabled () {
+  return registry().trace_enabled;
+}
+
+void write_timers_trace_to_file (const ekat::Comm& comm, const std::string& fname) {
+  const auto& r = registry();
+  const int rank = comm.rank();
+  const std::string pid = std::to_string(rank);
+
+  // Each rank serializes its own events
+  std::string my_events;
+  my_events += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pid
+             + ",\"args\":{\"name\":\"rank " + pid + "\"}},\n";
+  my_events += "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" + pid
+             + ",\"args\":{\"sort_index\":" + pid + "}}";
+  if (r.num_dropped>0) {
+    my_events += ",\n{\"name\":\"dropped_events\",\"ph\":\"M\",\"pid\":" + pid
+               + ",\"args\":{\"count\":" + std::to_string(r.num_dropped) + "}}";
+  }
+  for (const auto& e : r.events) {
+    my_events += ",\n{\"name\":\"" + json_escape(r.timers[e.id].name) + "\",\"ph\":\"X\""
+               + ",\"pid\":" + pid + ",\"tid\":0"
+               + ",\"ts\":" + std::to_string(e.start)
+               + ",\"dur\":" + std::to_string(e.duration) + "}";
+  }
+
+  // Each rank writes its own chunk of the file, right after the chunks of the
+  // lower ranks. File offsets are 64 bit, so the file can exceed 2GB.
+  std::string chunk = (rank==0 ? "{\"traceEvents\":[\n" : ",\n") + my_events;
+  if (rank==comm.size()-1) {
+    chunk += "\n],\n\"displayTimeUnit\":\"ms\"}\n";
+  }
+  EKAT_REQUIRE_MSG (chunk.size()<=static_cast<size_t>(std::numeric_limits<int>::max()),
+      "Error! The timers trace of a single rank is too large to be written.\n"
+      "  - rank: " + pid + "\n"
+      "  - size: " + std::to_string(chunk.size()) + "\n"
+      "  - max size: " + std::to_string(std::numeric_limits<int>::max()) + "\n"
+      "Reduce max_events in enable_timers_trace.\n");
+
+  long long my_size = chunk.size();
+  long long my_offset = 0;
+  MPI_Exscan(&my_size,&my_offset,1,MPI_LONG_LONG,MPI_SUM,comm.mpi_comm());
+  if (rank==0) {
+    // MPI_Exscan leaves the output undefined on rank 0
+    my_offset = 0;
+  }
+
+  MPI_File fh;
+  int err = MPI_File_open(comm.mpi_comm(),fname.c_str(),MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                          MPI_INFO_NULL,&fh);
+  EKAT_REQUIRE_MSG (err==MPI_SUCCESS,
+      "Error! Could not open timers trace file.\n"
+      "  - file name: " + fname + "\n");
+  // Truncate the file, in case it already exists and is longer than the trace
+  MPI_File_set_size(fh,0);
+  err = MPI_File_write_at_all(fh,static_cast<MPI_Offset>(my_offset),chunk.data(),
+                              static_cast<int>(chunk.size()),MPI_CHAR,MPI_STATUS_IGNORE);
+  MPI_File_close(&fh);
+  EKAT_REQUIRE_MSG (err==MPI_SUCCESS,
+      "Error! Could not write timers trace file.\n"
+      "  - file name: " + fname + "\n");
+}
+
 } // namespace scream
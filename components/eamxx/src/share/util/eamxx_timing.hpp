@@ -17,6 +17,48 @@ void stop_timer (const std::string& name);
 
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
+// Timers can also be registered once, and then started/stopped via the returned id.
+// This avoids building and hashing the timer name at every call, which is handy
+// for timers that are started/stopped many times (e.g., once per time step).
+// Registering a name more than once returns the same id.
+// If fence=true, Kokkos::fence is called before starting and before stopping the timer,
+// so that the timer includes the device work launched within it.
+int register_timer (const std::string& name);
+void start_timer (const int id, const bool fence = false);
+void stop_timer (const int id, const bool fence = false);
+
+// Starts a registered timer at construction, and stops it at destruction
+class ScopedTimer {
+public:
+  ScopedTimer (const int id, const bool fence = false)
+   : m_id (id), m_fence (fence)
+  {
+    start_timer(m_id,m_fence);
+  }
+  ~ScopedTimer () { stop_timer(m_id,m_fence); }
+
+  ScopedTimer (const ScopedTimer&) = delete;
+  ScopedTimer& operator= (const ScopedTimer&) = delete;
+
+private:
+  const int  m_id;
+  const bool m_fence;
+};
+
+// Record the start/stop time of all timers (besides accumulating them in GPTL), so that
+// the per-rank timeline can be written in the Chrome trace format (which can be loaded
+// in chrome://tracing or https://ui.perfetto.dev). Each rank is shown as a process.
+// Recording stops once max_events events are stored on a rank.
+// NOTE: enabling/disabling the trace is collective over comm (ranks synchronize,
+//       so that timelines of different ranks are roughly aligned).
+void enable_timers_trace (const ekat::Comm& comm, const int max_events = 1000000);
+void disable_timers_trace ();
+bool timers_trace_enabled ();
+
+// Collective over comm. Writes the events of all ranks in a single json file
+// (each rank writes its own events, with MPI-IO)
+void write_timers_trace_to_file (const ekat::Comm& comm, const std::string& fname);
+
 } // namespace scream
 
 #endif // SCREAM_TIMING_HPP
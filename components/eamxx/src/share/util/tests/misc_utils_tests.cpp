@@ -3,6 +3,12 @@
 #include "share/util/eamxx_family_tracking.hpp"
 #include "share/util/eamxx_universal_constants.hpp"
 #include "share/util/eamxx_utils.hpp"
+#include "share/util/eamxx_timing.hpp"
+
+#include <ekat_comm.hpp>
+
+#include <fstream>
+#include <sstream>
 
 TEST_CASE("fill_value") {
   using namespace scream::constants;
@@ -69,3 +75,58 @@ TEST_CASE("family_tracking") {
   REQUIRE (parent->get_children().size()==1);
   REQUIRE (child->get_children().size()==0);
 }
+
+TEST_CASE("timers") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  bool was_inited;
+  init_gptl(was_inited);
+
+  // Registering the same name twice gives the same id
+  const int id_a = register_timer("timer_a");
+  const int id_b = register_timer("timer_b");
+  REQUIRE (id_a!=id_b);
+  REQUIRE (register_timer("timer_a")==id_a);
+
+  enable_timers_trace(comm,3);
+  REQUIRE (timers_trace_enabled());
+  {
+    ScopedTimer outer(id_a);
+    for (int i=0; i<3; ++i) {
+      ScopedTimer inner(id_b,true);
+    }
+  }
+  // Name-based timers are traced too
+  start_timer("timer_c");
+  stop_timer("timer_c");
+  disable_timers_trace();
+  REQUIRE (not timers_trace_enabled());
+
+  // Once max_events is reached, events are dropped
+  const std::string fname = "timers_trace_np" + std::to_string(comm.size()) + ".json";
+  write_timers_trace_to_file(comm,fname);
+  if (comm.am_i_root()) {
+    std::ifstream ifile(fname);
+    REQUIRE (ifile.good());
+    std::stringstream ss;
+    ss << ifile.rdbuf();
+    const auto json = ss.str();
+    REQUIRE (json.find("\"traceEvents\"")!=std::string::npos);
+    REQUIRE (json.find("\"timer_b\"")!=std::string::npos);
+    REQUIRE (json.find("\"timer_a\"")==std::string::npos);
+    REQUIRE (json.find("\"dropped_events\"")!=std::string::npos);
+    // Each rank wrote its own chunk, and the last one closed the json
+    for (int pid=0; pid<comm.size(); ++pid) {
+      REQUIRE (json.find("\"rank " + std::to_string(pid) + "\"")!=std::string::npos);
+    }
+    const std::string tail = "\n],\n\"displayTimeUnit\":\"ms\"}\n";
+    REQUIRE (json.size()>tail.size());
+    REQUIRE (json.compare(json.size()-tail.size(),tail.size(),tail)==0);
+  }
+
+  if (not was_inited) {
+    finalize_gptl();
+  }
+}
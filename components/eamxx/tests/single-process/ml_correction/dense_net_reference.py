@@ -0,0 +1,60 @@
+import numpy as np
+import xarray as xr
+import fv3fit
+from scream_run.steppers.machine_learning import MultiModelAdapter
+
+
+class DenseNetPredictor(fv3fit.Predictor):
+    """
+    fv3fit predictor evaluating the same dense network as MLDenseNet. It lets
+    the test time the python backend (ml_correction.update_fields) against
+    the native one, with the same model.
+    """
+
+    def __init__(self, input_variables, output_variables, nlev, weights,
+                 biases, activations, in_mean, in_scale, out_mean, out_scale):
+        super().__init__(input_variables, output_variables)
+        self.nlev = nlev
+        self.weights = [np.asarray(W) for W in weights]
+        self.biases = [np.asarray(b) for b in biases]
+        self.activations = list(activations)
+        self.in_mean = np.asarray(in_mean)
+        self.in_scale = np.asarray(in_scale)
+        self.out_mean = np.asarray(out_mean)
+        self.out_scale = np.asarray(out_scale)
+
+    def predict(self, X):
+        cols = []
+        for name in self.input_variables:
+            x = np.asarray(X[name].values)
+            cols.append(x if x.ndim == 2 else x[:, np.newaxis])
+        a = (np.concatenate(cols, axis=1) - self.in_mean) / self.in_scale
+        for W, b, act in zip(self.weights, self.biases, self.activations):
+            a = a @ W.T + b
+            if act == "relu":
+                a = np.maximum(a, 0)
+            elif act == "tanh":
+                a = np.tanh(a)
+        y = a * self.out_scale + self.out_mean
+        nlev = self.nlev
+        return xr.Dataset(
+            {
+                name: xr.DataArray(y[:, i * nlev:(i + 1) * nlev], dims=["ncol", "z"])
+                for i, name in enumerate(self.output_variables)
+            }
+        )
+
+    def dump(self, path):
+        raise NotImplementedError("DenseNetPredictor is only used in tests")
+
+    @classmethod
+    def load(cls, path):
+        raise NotImplementedError("DenseNetPredictor is only used in tests")
+
+
+def get_ML_model(input_variables, output_variables, nlev, weights, biases,
+                 activations, in_mean, in_scale, out_mean, out_scale):
+    predictor = DenseNetPredictor(input_variables, output_variables, nlev,
+                                  weights, biases, activations,
+                                  in_mean, in_scale, out_mean, out_scale)
+    return MultiModelAdapter([predictor])
@@ -0,0 +1,359 @@
+#include <catch2/catch.hpp>
+
+#include "control/atmosphere_driver.hpp"
+#include "physics/ml_correction/eamxx_ml_correction_process_interface.hpp"
+#include "physics/ml_correction/ml_dense_net.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/io/eamxx_scorpio_interface.hpp"
+
+#include <ekat_comm.hpp>
+#include <ekat_fpe.hpp>
+#include <ekat_logger.hpp>
+#include <ekat_test_utils.hpp>
+#include <ekat_yaml.hpp>
+
+#include <pybind11/embed.h>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace scream {
+
+namespace {
+
+struct HostLayer {
+  int n_in, n_out;
+  std::vector<Real> W, b;
+  std::string act;
+};
+
+struct HostNet {
+  std::vector<HostLayer> layers;
+  std::vector<Real> in_mean, in_scale, out_mean, out_scale;
+};
+
+HostNet create_net (const std::vector<int>& widths, std::mt19937_64& engine)
+{
+  std::uniform_real_distribution<Real> pdf(-0.5,0.5);
+  std::uniform_real_distribution<Real> pos_pdf(0.5,2.0);
+  auto fill = [&](std::vector<Real>& v, const int n, auto& dist) {
+    v.resize(n);
+    for (auto& x : v) x = dist(engine);
+  };
+
+  HostNet net;
+  const int nlayers = widths.size()-1;
+  for (int k=0; k<nlayers; ++k) {
+    auto& l = net.layers.emplace_back();
+    l.n_in  = widths[k];
+    l.n_out = widths[k+1];
+    fill(l.W,l.n_out*l.n_in,pdf);
+    fill(l.b,l.n_out,pdf);
+    l.act = k==nlayers-1 ? "linear" : (k%2==0 ? "relu" : "tanh");
+  }
+  fill(net.in_mean,widths.front(),pdf);
+  fill(net.in_scale,widths.front(),pos_pdf);
+  fill(net.out_mean,widths.back(),pdf);
+  fill(net.out_scale,widths.back(),pos_pdf);
+  return net;
+}
+
+void write_net (const std::string& filename, const HostNet& net,
+                const std::string& inputs, const std::string& outputs)
+{
+  const int nlayers = net.layers.size();
+  scorpio::register_file(filename,scorpio::FileMode::Write);
+  for (int k=0; k<nlayers; ++k) {
+    const auto& l = net.layers[k];
+    const auto sk = std::to_string(k);
+    scorpio::define_dim(filename,"n_in_"+sk,l.n_in);
+    scorpio::define_dim(filename,"n_out_"+sk,l.n_out);
+    scorpio::define_var(filename,"W_"+sk,{"n_out_"+sk,"n_in_"+sk},"real");
+    scorpio::define_var(filename,"b_"+sk,{"n_out_"+sk},"real");
+    scorpio::set_attribute(filename,"W_"+sk,"activation",l.act);
+  }
+  scorpio::define_var(filename,"input_mean",{"n_in_0"},"real");
+  scorpio::define_var(filename,"input_scale",{"n_in_0"},"real");
+  const auto last = "n_out_" + std::to_string(nlayers-1);
+  scorpio::define_var(filename,"output_mean",{last},"real");
+  scorpio::define_var(filename,"output_scale",{last},"real");
+  scorpio::set_attribute(filename,"GLOBAL","num_layers",nlayers);
+  scorpio::set_attribute(filename,"GLOBAL","input_variables",inputs);
+  scorpio::set_attribute(filename,"GLOBAL","output_variables",outputs);
+  scorpio::enddef(filename);
+
+  for (int k=0; k<nlayers; ++k) {
+    const auto& l = net.layers[k];
+    const auto sk = std::to_string(k);
+    scorpio::write_var(filename,"W_"+sk,l.W.data());
+    scorpio::write_var(filename,"b_"+sk,l.b.data());
+  }
+  scorpio::write_var(filename,"input_mean",net.in_mean.data());
+  scorpio::write_var(filename,"input_scale",net.in_scale.data());
+  scorpio::write_var(filename,"output_mean",net.out_mean.data());
+  scorpio::write_var(filename,"output_scale",net.out_scale.data());
+  scorpio::release_file(filename);
+}
+
+// Serial evaluation of one row, used as reference
+std::vector<Real> eval_row (const HostNet& net, const Real* x)
+{
+  const int n_in = net.layers.front().n_in;
+  std::vector<Real> a(n_in);
+  for (int j=0; j<n_in; ++j) {
+    a[j] = (x[j]-net.in_mean[j]) / net.in_scale[j];
+  }
+  for (const auto& l : net.layers) {
+    std::vector<Real> z(l.n_out);
+    for (int o=0; o<l.n_out; ++o) {
+      z[o] = l.b[o];
+      for (int j=0; j<l.n_in; ++j) {
+        z[o] += l.W[o*l.n_in+j]*a[j];
+      }
+      if (l.act=="relu") {
+        z[o] = std::max(z[o],Real(0));
+      } else if (l.act=="tanh") {
+        z[o] = std::tanh(z[o]);
+      }
+    }
+    a = z;
+  }
+  for (int o=0; o<static_cast<int>(a.size()); ++o) {
+    a[o] = a[o]*net.out_scale[o] + net.out_mean[o];
+  }
+  return a;
+}
+
+} // anonymous namespace
+
+TEST_CASE ("ml_dense_net") {
+  using net_t = MLDenseNet;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // Same seed on all ranks, since all ranks must write/read the same weights
+  std::mt19937_64 engine(1234);
+
+  // A typical T/q net: (T_mid,qv,lat,cos_zenith_angle) -> (dQ1,dQ2)
+  const int nlevs = 72;
+  const int ncols = 512;
+  const int width = 256;
+  const std::vector<int> widths = {2*nlevs+2, width, width, 2*nlevs};
+  const auto host_net = create_net(widths,engine);
+  const std::string filename = "ml_dense_net_np" + std::to_string(comm.size()) + ".nc";
+  write_net(filename,host_net,"T_mid, qv, lat, cos_zenith_angle","dQ1,dQ2");
+
+  net_t net(filename);
+  REQUIRE (net.num_inputs()==widths.front());
+  REQUIRE (net.num_outputs()==widths.back());
+  REQUIRE (net.input_names()==std::vector<std::string>{"T_mid","qv","lat","cos_zenith_angle"});
+  REQUIRE (net.output_names()==std::vector<std::string>{"dQ1","dQ2"});
+
+  const int n_in  = net.num_inputs();
+  const int n_out = net.num_outputs();
+  net_t::view_2d<Real> x("x",ncols,n_in);
+  net_t::view_2d<Real> y("y",ncols,n_out);
+  auto x_h = Kokkos::create_mirror_view(x);
+  auto y_h = Kokkos::create_mirror_view(y);
+  std::uniform_real_distribution<Real> pdf(-1,1);
+  for (int i=0; i<ncols; ++i) {
+    for (int j=0; j<n_in; ++j) {
+      x_h(i,j) = pdf(engine);
+    }
+  }
+  Kokkos::deep_copy(x,x_h);
+
+  net.evaluate(x,y);
+  Kokkos::deep_copy(y_h,y);
+
+  // The kernels may sum the layer products in a different order than the
+  // serial reference: allow a round-off error for each term of the widest sum
+  const Real tol = 10*width*std::numeric_limits<Real>::epsilon();
+  for (int i=0; i<ncols; ++i) {
+    const auto y_ref = eval_row(host_net,&x_h(i,0));
+    for (int o=0; o<n_out; ++o) {
+      REQUIRE (y_h(i,o)==Approx(y_ref[o]).epsilon(tol).margin(tol));
+    }
+  }
+
+  scorpio::finalize_subsystem();
+}
+
+TEST_CASE ("ml_correction_native") {
+  using namespace control;
+  namespace py = pybind11;
+
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file("input_native.yaml",ad_params);
+
+  const auto& ts     = ad_params.sublist("time_stepping");
+  const auto  dt     = ts.get<int>("time_step");
+  const auto  t0_str = ts.get<std::string>("run_t0");
+  const auto  t0     = util::str_to_time_stamp(t0_str);
+  const auto& ml     = ad_params.sublist("eamxx").sublist("ml_correction");
+  const auto  model_path = ml.get<std::string>("ml_model_path_tq");
+  const int   nlevs  = ad_params.sublist("grids_manager").sublist("physics")
+                                .get<int>("number_of_vertical_levels");
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A T/q net whose tendencies keep the state within the MLCorrection bounds:
+  // inputs are normalized around typical values, and dQ1/dQ2 are O(1e-4 K/s)/O(1e-7 1/s)
+  const int width = 64;
+  std::mt19937_64 engine(5678);
+  auto host_net = create_net({2*nlevs, width, width, 2*nlevs},engine);
+  for (int k=0; k<nlevs; ++k) {
+    host_net.in_mean[k]         = 280;
+    host_net.in_scale[k]        = 10;
+    host_net.in_mean[nlevs+k]   = 1e-2;
+    host_net.in_scale[nlevs+k]  = 5e-3;
+    host_net.out_mean[k]        = 0;
+    host_net.out_scale[k]       = 1e-4;
+    host_net.out_mean[nlevs+k]  = 0;
+    host_net.out_scale[nlevs+k] = 1e-7;
+  }
+  scorpio::init_subsystem(comm);
+  write_net(model_path,host_net,"T_mid,qv","dQ1,dQ2");
+  scorpio::finalize_subsystem();
+
+  auto& proc_factory = AtmosphereProcessFactory::instance();
+  auto& gm_factory = GridsManagerFactory::instance();
+  proc_factory.register_product("MLCorrection",&create_atmosphere_process<MLCorrection>);
+  gm_factory.register_product("mesh_free",&create_mesh_free_grids_manager);
+
+  AtmosphereDriver ad;
+  ad.initialize(comm,ad_params,t0);
+
+  const auto& grid = ad.get_grids_manager()->get_grid("physics");
+  const auto& field_mgr = *ad.get_field_mgr();
+  const int ncols = grid->get_num_local_dofs();
+
+  auto T_f  = field_mgr.get_field("T_mid");
+  auto qv_f = field_mgr.get_field("qv");
+  auto T_h  = T_f.get_view<Real**,Host>();
+  auto qv_h = qv_f.get_view<Real**,Host>();
+  std::vector<Real> T0(ncols*nlevs), qv0(ncols*nlevs);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      const Real phase = icol*3.14/2.0/ncols;
+      const Real xval  = ilev*3.14/2.0/nlevs;
+      T_h(icol,ilev)  = T0[icol*nlevs+ilev]  = 280 + 10*std::sin(xval-phase);
+      qv_h(icol,ilev) = qv0[icol*nlevs+ilev] = 1e-2*(1 + 0.5*std::cos(xval+phase));
+    }
+  }
+  T_f.sync_to_dev();
+  qv_f.sync_to_dev();
+
+  // One step must pack T_mid/qv, evaluate the net, and apply dQ1/dQ2 as tendencies
+  ad.run(dt);
+  T_f.sync_to_host();
+  qv_f.sync_to_host();
+
+  const Real tol = 10*width*std::numeric_limits<Real>::epsilon();
+  for (int icol=0; icol<ncols; ++icol) {
+    std::vector<Real> x(2*nlevs);
+    std::copy_n(&T0[icol*nlevs],nlevs,x.begin());
+    std::copy_n(&qv0[icol*nlevs],nlevs,x.begin()+nlevs);
+    const auto y = eval_row(host_net,x.data());
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      REQUIRE (T_h(icol,ilev)==Approx(T0[icol*nlevs+ilev]+y[ilev]*dt).epsilon(tol));
+      REQUIRE (qv_h(icol,ilev)==Approx(qv0[icol*nlevs+ilev]+y[nlevs+ilev]*dt).epsilon(tol));
+    }
+  }
+
+  // Optionally, time an MLCorrection step with the native backend against
+  // ml_correction.update_fields, which is what the python backend calls, running
+  // the same net. The latter includes the host round-trip of the updated fields.
+  // The user can enable it via --args --benchmark true
+  auto& session = ekat::TestSession::get();
+  session.params.emplace("benchmark","false");
+  if (session.params["benchmark"]!="true") {
+    ad.finalize();
+    return;
+  }
+
+  using clock = std::chrono::steady_clock;
+  const int nrep = 10;
+
+  Kokkos::fence();
+  auto start = clock::now();
+  for (int r=0; r<nrep; ++r) {
+    ad.run(dt);
+  }
+  Kokkos::fence();
+  const double t_native = std::chrono::duration<double>(clock::now()-start).count()/nrep;
+
+  int fpe_mask = ekat::get_enabled_fpes();
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    py::initialize_interpreter();
+  }
+  {
+    py::module sys = py::module::import("sys");
+    sys.attr("path").attr("insert")(1, CUSTOM_SYS_PATH);
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    auto py_correction = py::module::import("ml_correction");
+    auto py_reference  = py::module::import("dense_net_reference");
+
+    py::list Ws, bs, acts;
+    for (const auto& l : host_net.layers) {
+      Ws.append(py::array_t<Real>({l.n_out,l.n_in},l.W.data()));
+      bs.append(py::array_t<Real>(l.n_out,l.b.data()));
+      acts.append(l.act);
+    }
+    auto to_np = [](const std::vector<Real>& v) {
+      return py::array_t<Real>(v.size(),v.data());
+    };
+    py::object ML_model_tq = py_reference.attr("get_ML_model")(
+        std::vector<std::string>{"T_mid","qv"}, std::vector<std::string>{"dQ1","dQ2"}, nlevs,
+        Ws, bs, acts, to_np(host_net.in_mean), to_np(host_net.in_scale),
+        to_np(host_net.out_mean), to_np(host_net.out_scale));
+
+    // Inputs that the T/q model does not use
+    std::vector<Real> u(ncols*nlevs,0), v(ncols*nlevs,0), SW_flux_dn(ncols*(nlevs+1),0);
+    std::vector<Real> lat(ncols,0), lon(ncols,0), phis(ncols,0), sfc_alb_dif_vis(ncols,0),
+                      sfc_flux_sw_net(ncols,0), sfc_flux_lw_dn(ncols,0);
+    auto as_np = [](Real* data, const int n) {
+      return py::array_t<Real, py::array::c_style | py::array::forcecast>(n, data, py::str{});
+    };
+    const std::string datetime_str = t0.get_date_string() + " " + t0.get_time_string();
+    // qv is the only tracer registered in this test
+    const int num_tracers = 1;
+
+    start = clock::now();
+    for (int r=0; r<nrep; ++r) {
+      T_f.sync_to_host();
+      qv_f.sync_to_host();
+      py_correction.attr("update_fields")(
+          as_np(T_h.data(),ncols*nlevs), as_np(qv_h.data(),ncols*nlevs*num_tracers),
+          as_np(u.data(),ncols*nlevs), as_np(v.data(),ncols*nlevs),
+          as_np(lat.data(),ncols), as_np(lon.data(),ncols), as_np(phis.data(),ncols),
+          as_np(SW_flux_dn.data(),ncols*(nlevs+1)), as_np(sfc_alb_dif_vis.data(),ncols),
+          as_np(sfc_flux_sw_net.data(),ncols), as_np(sfc_flux_lw_dn.data(),ncols),
+          ncols, nlevs, num_tracers, dt,
+          ML_model_tq, py::none(), py::none(), datetime_str);
+      T_f.sync_to_dev();
+      qv_f.sync_to_dev();
+    }
+    Kokkos::fence();
+    const double t_python = std::chrono::duration<double>(clock::now()-start).count()/nrep;
+
+    using namespace ekat::logger;
+    Logger<LogNoFile,LogRootRank> logger("ml_dense_net",LogLevel::info,comm);
+    logger.info(" MLCorrection step (ncols={}, widths={}-{}-{}-{}):",ncols,2*nlevs,width,width,2*nlevs);
+    logger.info("   native: {:.3e} s/step",t_native);
+    logger.info("   python: {:.3e} s/step",t_python);
+    logger.info("   ratio : {:.2f}",t_python/t_native);
+  }
+  ekat::enable_fpes(fpe_mask);
+
+  ad.finalize();
+}
+
+} // namespace scream
@@ -66,6 +66,11 @@ struct CaarFunctorImpl {
   RKStageData           m_data;
   const int             m_num_elems;
   const int             m_rsplit;
+
+  // GPTL handles of the run timers, set at the first run, so that
+  // GPTL does not need to hash the timer names at every call
+  void* m_compute_timer = nullptr;
+  void* m_bexchV_timer  = nullptr;
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
   ElementsDerivedState  m_derived;
@@ -212,14 +217,14 @@ struct CaarFunctorImpl {
     }
 
     profiling_resume();
-    GPTLstart("caar compute");
+    GPTLstart_handle("caar compute",&m_compute_timer);
     Kokkos::parallel_for("caar loop pre-boundary exchange", m_policy, *this);
     Kokkos::fence();
-    GPTLstop("caar compute");
+    GPTLstop_handle("caar compute",&m_compute_timer);
 
-    GPTLstart("caar_bexchV");
+    GPTLstart_handle("caar_bexchV",&m_bexchV_timer);
     m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    GPTLstop("caar_bexchV");
+    GPTLstop_handle("caar_bexchV",&m_bexchV_timer);
 
     profiling_pause();
   }
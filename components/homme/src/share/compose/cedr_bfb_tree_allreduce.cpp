@@ -78,10 +78,18 @@ void BfbTreeAllReducer<ES>
 template <typename ES>
 void BfbTreeAllReducer<ES>
 ::allreduce (const ConstRealList& send, const RealList& recv, const bool transpose) const {
-  const auto mpitag = tree::NodeSets::mpitag;
+  start_allreduce(send, recv, transpose);
+  finish_allreduce();
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>
+::start_allreduce (const ConstRealList& send, const RealList& recv,
+                   const bool transpose) const {
   const auto& ns = *ns_;
   const auto nf = nfield_;
   cedr_assert(ns.levels[0].nodes.size() == static_cast<size_t>(nlocal_));
+  cedr_assert( ! inflight_.active);
 
   { // We want to be behaviorally const but still permit lazy finish_setup.
     //   Cuda 10.1.105 with GCC 8.5.0 incorrectly misses the const_cast; for
@@ -105,16 +113,56 @@ void BfbTreeAllReducer<ES>
       for (Int j = 0; j < nf; ++j) d[j] = s[j];
     }
   }
+
+  inflight_.recv = recv;
+  inflight_.active = true;
+  inflight_.up = true;
+  inflight_.posted = false;
+  inflight_.il = 0;
+  advance(false);
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>::progress () const {
+  if (inflight_.active) advance(false);
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>::finish_allreduce () const {
+  cedr_assert(inflight_.active);
+  advance(true);
+}
+
+template <typename ES>
+bool BfbTreeAllReducer<ES>::advance (const bool block) const {
+  const auto mpitag = tree::NodeSets::mpitag;
+  const auto& ns = *ns_;
+  const auto nf = nfield_;
+  auto& st = inflight_;
+
+  const auto wait = [&] (std::vector<mpi::Request>& reqs) {
+    if (block) {
+      mpi::waitall(reqs.size(), reqs.data());
+      return true;
+    }
+    bool done;
+    mpi::testall(reqs.size(), reqs.data(), &done);
+    return done;
+  };
+
   // Leaves to root.
-  for (size_t il = 0; il < ns.levels.size(); ++il) {
-    auto& lvl = ns.levels[il];
+  while (st.up && st.il < ns.levels.size()) {
+    auto& lvl = ns.levels[st.il];
     // Set up receives.
-    for (size_t i = 0; i < lvl.kids.size(); ++i) {
-      const auto& mmd = lvl.kids[i];
-      mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
-                 &lvl.kids_req[i]);
+    if ( ! st.posted) {
+      for (size_t i = 0; i < lvl.kids.size(); ++i) {
+        const auto& mmd = lvl.kids[i];
+        mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
+                   &lvl.kids_req[i]);
+      }
+      st.posted = true;
     }
-    mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
+    if ( ! wait(lvl.kids_req)) return false;
     // Combine kids' data.
     for (const auto& idx : lvl.nodes) {
       const auto n = ns.node_h(idx);
@@ -131,17 +179,26 @@ void BfbTreeAllReducer<ES>
       const auto& mmd = lvl.me[i];
       mpi::isend(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag);
     }
+    ++st.il;
+    st.posted = false;
+  }
+  if (st.up) {
+    st.up = false;
+    st.il = ns.levels.size();
   }
   // Root to leaves.
-  for (size_t il = ns.levels.size(); il > 0; --il) {
-    auto& lvl = ns.levels[il-1];
+  while (st.il > 0) {
+    auto& lvl = ns.levels[st.il-1];
     // Get the global sum from parent.
-    for (size_t i = 0; i < lvl.me.size(); ++i) {
-      const auto& mmd = lvl.me[i];
-      mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
-                 &lvl.me_recv_req[i]);
-    }    
-    mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
+    if ( ! st.posted) {
+      for (size_t i = 0; i < lvl.me.size(); ++i) {
+        const auto& mmd = lvl.me[i];
+        mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
+                   &lvl.me_recv_req[i]);
+      }
+      st.posted = true;
+    }
+    if ( ! wait(lvl.me_recv_req)) return false;
     // Pass to kids.
     for (const auto& idx : lvl.nodes) {
       const auto n = ns.node_h(idx);
@@ -157,9 +214,14 @@ void BfbTreeAllReducer<ES>
       const auto& mmd = lvl.kids[i];
       mpi::isend(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag);
     }
+    --st.il;
+    st.posted = false;
   }
 
-  fill_recv(recv);
+  fill_recv(st.recv);
+  st.recv = RealList();
+  st.active = false;
+  return true;
 }
 
 template <typename ES>
@@ -174,7 +236,8 @@ Int BfbTreeAllReducer<ES>::unittest (const Parallel::Ptr& p) {
   for (size_t is = 0; is < sizeof(szs)/sizeof(*szs); ++is)
     for (size_t id = 0; id < sizeof(dists)/sizeof(*dists); ++id)
       for (bool imbalanced : {false, true})
-        for (bool transpose : {false, true}) {
+        for (bool transpose : {false, true})
+        for (bool split_phase : {false, true}) {
           const Int ncell = szs[is];
           Mesh m(ncell, p, dists[id]);
           tree::Node::Ptr tree = make_tree(m, imbalanced);
@@ -197,7 +260,13 @@ Int BfbTreeAllReducer<ES>::unittest (const Parallel::Ptr& p) {
           Kokkos::deep_copy(send, send_m);
 
           BfbTreeAllReducer<> ar(p, tree, m.ncell(), nfield);
-          ar.allreduce(send, recv, transpose);
+          if (split_phase) {
+            ar.start_allreduce(send, recv, transpose);
+            ar.progress();
+            ar.finish_allreduce();
+          } else {
+            ar.allreduce(send, recv, transpose);
+          }
           Kokkos::deep_copy(recv_m, recv);
 
           std::vector<Real> lcl_red(nfield, 0);
@@ -40,6 +40,17 @@ struct BfbTreeAllReducer {
   void allreduce(const ConstRealList& send, const RealList& recv,
                  const bool transpose = false) const;
 
+  // Split-phase allreduce: start_allreduce(send, recv, transpose);
+  // finish_allreduce(); is equivalent to allreduce(send, recv, transpose).
+  // start_allreduce consumes send and advances through the tree as far as it
+  // can without waiting on a message; progress() does the same and may be
+  // called any number of times in between. recv is valid only after
+  // finish_allreduce returns.
+  void start_allreduce(const ConstRealList& send, const RealList& recv,
+                       const bool transpose = false) const;
+  void progress() const;
+  void finish_allreduce() const;
+
   static Int unittest(const mpi::Parallel::Ptr& p);
 
 private:
@@ -48,10 +59,24 @@ private:
   std::shared_ptr<const tree::NodeSets> ns_;
   mutable RealListHost bd_;
 
+  // State of an in-flight split-phase allreduce. The tree is traversed leaves
+  // to root (up), then root to leaves. il is the level being processed and
+  // posted says whether its receives have been posted.
+  struct InFlight {
+    RealList recv;
+    bool active = false, up = true, posted = false;
+    size_t il = 0;
+  };
+  mutable InFlight inflight_;
+
   void init(const mpi::Parallel::Ptr& p, const tree::Node::Ptr& tree,
             const Int nleaf, const Int nfield);
   const Real* get_send_host(const ConstRealList& send) const;
   void fill_recv(const RealList& recv) const;
+  // Advance the in-flight allreduce. If block, run it to completion; else stop
+  // at the first level whose messages have not all arrived. Return true when
+  // the allreduce is complete.
+  bool advance(const bool block) const;
 };
 
 } // namespace cedr
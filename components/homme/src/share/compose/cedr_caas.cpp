@@ -43,6 +43,8 @@ CAAS<ES>::CAAS (const mpi::Parallel::Ptr& p, const Int nlclcells,
   o.nrhomidxs_ = 0;
   o.need_conserve_ = false;
   finished_setup_ = false;
+  running_ = false;
+  reduce_done_ = false;
   cedr_throw_if(nlclcells == 0, "CAAS does not support 0 cells on a rank.");
   tracer_decls_ = std::make_shared<std::vector<Decl> >();  
 }
@@ -208,6 +210,25 @@ void CAAS<ES>::reduce_globally () {
                 "CAAS::reduce_globally MPI_Allreduce returned " << err);
 }
 
+template <typename ES>
+void CAAS<ES>::start_reduce_globally () {
+  // The reduction reads send_ asynchronously, so reduce_locally must be done.
+  Kokkos::fence();
+  const int err = mpi::iall_reduce(*p_, send_.data(), recv_.data(),
+                                   send_.size(), MPI_SUM, &reduce_req_);
+  cedr_throw_if(err != MPI_SUCCESS,
+                "CAAS::start_reduce_globally MPI_Iallreduce returned " << err);
+  reduce_done_ = false;
+}
+
+template <typename ES>
+void CAAS<ES>::finish_reduce_globally () {
+  if (reduce_done_) return;
+  const int err = mpi::waitall(1, &reduce_req_);
+  cedr_throw_if(err != MPI_SUCCESS,
+                "CAAS::finish_reduce_globally MPI_Wait returned " << err);
+}
+
 template <typename ES>
 void CAAS<ES>::finish_locally () {
   using ESU = cedr::impl::ExeSpaceUtils<ES>;
@@ -269,6 +290,51 @@ void CAAS<ES>::run () {
   finish_locally();
 }
 
+template <typename ES>
+void CAAS<ES>::start_run () {
+  cedr_assert(finished_setup_);
+  cedr_assert( ! running_);
+  reduce_locally();
+  const bool user_reduces = user_reducer_ != nullptr;
+  if (user_reduces)
+    user_reducer_->start(*p_, send_.data(), recv_.data(),
+                         o.nlclcells_ / user_reducer_->n_accum_in_place(),
+                         recv_.size(), MPI_SUM);
+  else
+    start_reduce_globally();
+  running_ = true;
+}
+
+template <typename ES>
+void CAAS<ES>::finish_run () {
+  cedr_assert(running_);
+  const bool user_reduces = user_reducer_ != nullptr;
+  if (user_reduces)
+    user_reducer_->finish();
+  else
+    finish_reduce_globally();
+  running_ = false;
+  finish_locally();
+}
+
+template <typename ES>
+void CAAS<ES>::progress_run () {
+  cedr_assert(running_);
+  const bool user_reduces = user_reducer_ != nullptr;
+  if (user_reduces) {
+    user_reducer_->progress();
+  } else if ( ! reduce_done_) {
+    const int err = mpi::testall(1, &reduce_req_, &reduce_done_);
+    cedr_throw_if(err != MPI_SUCCESS,
+                  "CAAS::progress_run MPI_Testall returned " << err);
+  }
+}
+
+template <typename ES>
+bool CAAS<ES>::run_is_split () const {
+  return user_reducer_ == nullptr || user_reducer_->is_split();
+}
+
 namespace test {
 struct TestCAAS : public cedr::test::TestRandomized {
   typedef CAAS<Kokkos::DefaultExecutionSpace> CAAST;
@@ -304,9 +370,9 @@ struct TestCAAS : public cedr::test::TestRandomized {
 
   TestCAAS (const mpi::Parallel::Ptr& p, const Int& ncells,
             const bool use_own_reducer, const bool external_memory,
-            const bool verbose)
+            const bool split_phase, const bool verbose)
     : TestRandomized("CAAS", p, ncells, verbose),
-      p_(p), external_memory_(external_memory)
+      p_(p), external_memory_(external_memory), split_phase_(split_phase)
   {
     const auto np = p->size(), rank = p->rank();
     nlclcells_ = ncells / np;
@@ -362,12 +428,18 @@ struct TestCAAS : public cedr::test::TestRandomized {
   }
 
   void run_impl (const Int trial) override {
-    caas_->run();
+    if (split_phase_) {
+      caas_->start_run();
+      caas_->progress_run();
+      caas_->finish_run();
+    } else {
+      caas_->run();
+    }
   }
 
 private:
   mpi::Parallel::Ptr p_;
-  bool external_memory_;
+  bool external_memory_, split_phase_;
   Int nlclcells_;
   CAAST::Ptr caas_;
   typename CAAST::RealList buf1_, buf2_;
@@ -388,8 +460,10 @@ Int unittest (const mpi::Parallel::Ptr& p) {
     if (ncells > np) ncells -= np/2;
     for (const bool own_reducer : {false, true})
       for (const bool external_memory : {false, true})
-        nerr += TestCAAS(p, ncells, own_reducer, external_memory, false)
-          .run<TestCAAS::CAAST>(1, false);
+        for (const bool split_phase : {false, true})
+          nerr += TestCAAS(p, ncells, own_reducer, external_memory, split_phase,
+                           false)
+            .run<TestCAAS::CAAST>(1, false);
   }
   return nerr;
 }
@@ -46,6 +46,19 @@ public:
     // if those DOFs are guaranteed always to be on the same processor. If so,
     // expose that value n here.
     virtual int n_accum_in_place () const { return 1; }
+
+    // Split-phase interface, used by CAAS::start_run/finish_run. The arguments
+    // to start are as for operator(); rcvbuf is valid only after finish
+    // returns. By default, the reduction is done entirely in start. A reducer
+    // that overrides these so that the reduction proceeds between start and
+    // finish should say so in is_split and may advance it in progress.
+    virtual int start (const mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+                       int nlocal, int nfld, MPI_Op op) const {
+      return (*this)(p, sendbuf, rcvbuf, nlocal, nfld, op);
+    }
+    virtual int finish () const { return MPI_SUCCESS; }
+    virtual void progress () const {}
+    virtual bool is_split () const { return false; }
   };
 
   CAAS(const mpi::Parallel::Ptr& p, const Int nlclcells,
@@ -88,6 +101,13 @@ public:
 
   void run() override;
 
+  // The global reduction is started in start_run, using MPI_Iallreduce or the
+  // split-phase interface of the UserAllReducer, and completed in finish_run.
+  void start_run() override;
+  void finish_run() override;
+  void progress_run() override;
+  bool run_is_split() const override;
+
 protected:
   typedef cedr::impl::Unmanaged<RealList> UnmanagedRealList;
 
@@ -104,10 +124,13 @@ protected:
   typename IntList::HostMirror probs_h_;
   IntList t2r_;
   RealList send_, recv_;
-  bool finished_setup_;
+  bool finished_setup_, running_, reduce_done_;
+  mpi::Request reduce_req_;
   DeviceOp o;
 
   void reduce_globally();
+  void start_reduce_globally();
+  void finish_reduce_globally();
 
 PRIVATE_CUDA:
   void reduce_locally();
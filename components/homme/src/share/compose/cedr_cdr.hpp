@@ -107,6 +107,23 @@ struct CDR {
   // call this function from a parallel region.
   virtual void run() = 0;
 
+  // Split-phase version of run: start_run(); finish_run(); is equivalent to
+  // run(). A CDR that needs global communication may start it in start_run and
+  // complete it in finish_run, letting the caller overlap the communication
+  // with work that touches neither the CDR's data nor the values set by
+  // set_{rhom,Qm}. By default, all the work is done in finish_run. It is an
+  // error to call these functions from a parallel region.
+  virtual void start_run() {}
+  virtual void finish_run() { run(); }
+
+  // Advance the communication started in start_run without blocking. It may be
+  // called any number of times between start_run and finish_run.
+  virtual void progress_run() {}
+
+  // Whether the communication is actually in flight between start_run and
+  // finish_run, i.e., whether work done in between is overlapped with it.
+  virtual bool run_is_split() const { return false; }
+
 protected:
   Options options_;
 };
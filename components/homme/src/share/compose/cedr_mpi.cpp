@@ -77,6 +77,25 @@ int waitall (int count, Request* reqs, MPI_Status* stats) {
 #endif
 }
 
+int testall (int count, Request* reqs, bool* flag, MPI_Status* stats) {
+  int iflag = 0;
+#ifdef COMPOSE_DEBUG_MPI
+  std::vector<MPI_Request> vreqs(count);
+  for (int i = 0; i < count; ++i) vreqs[i] = reqs[i].request;
+  const auto out = MPI_Testall(count, vreqs.data(), &iflag,
+                               stats ? stats : MPI_STATUSES_IGNORE);
+  for (int i = 0; i < count; ++i) {
+    reqs[i].request = vreqs[i];
+    if (iflag) reqs[i].unfreed--;
+  }
+#else
+  const auto out = MPI_Testall(count, reinterpret_cast<MPI_Request*>(reqs), &iflag,
+                               stats ? stats : MPI_STATUSES_IGNORE);
+#endif
+  *flag = static_cast<bool>(iflag);
+  return out;
+}
+
 bool all_ok (const Parallel& p, bool im_ok) {
   int ok = im_ok, msg;
   all_reduce<int>(p, &ok, &msg, 1, MPI_LAND);
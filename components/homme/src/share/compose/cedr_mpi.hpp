@@ -47,6 +47,11 @@ int reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_Op op,
 template <typename T>
 int all_reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_Op op);
 
+// Nonblocking all_reduce. Complete it with waitall(1, ireq).
+template <typename T>
+int iall_reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count,
+                MPI_Op op, Request* ireq);
+
 template <typename T>
 int isend(const Parallel& p, const T* buf, int count, int dest, int tag,
           Request* ireq = nullptr);
@@ -59,6 +64,10 @@ int waitany(int count, Request* reqs, int* index, MPI_Status* stats = nullptr);
 
 int waitall(int count, Request* reqs, MPI_Status* stats = nullptr);
 
+// Nonblocking test of the completion of all of reqs. On output, *flag is true
+// iff all have completed, in which case reqs are freed as by waitall.
+int testall(int count, Request* reqs, bool* flag, MPI_Status* stats = nullptr);
+
 template<typename T>
 int gather(const Parallel& p, const T* sendbuf, int sendcount,
            T* recvbuf, int recvcount, int root);
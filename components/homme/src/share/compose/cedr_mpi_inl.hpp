@@ -20,6 +20,18 @@ int all_reduce (const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_O
   return MPI_Allreduce(const_cast<T*>(sendbuf), rcvbuf, count, dt, op, p.comm());
 }
 
+template <typename T>
+int iall_reduce (const Parallel& p, const T* sendbuf, T* rcvbuf, int count,
+                 MPI_Op op, Request* ireq) {
+  MPI_Datatype dt = get_type<T>();
+  int ret = MPI_Iallreduce(const_cast<T*>(sendbuf), rcvbuf, count, dt, op,
+                           p.comm(), &ireq->request);
+#ifdef COMPOSE_DEBUG_MPI
+  ireq->unfreed++;
+#endif
+  return ret;
+}
+
 template <typename T>
 int isend (const Parallel& p, const T* buf, int count, int dest, int tag,
            Request* ireq) {
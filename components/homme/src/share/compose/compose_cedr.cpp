@@ -417,6 +417,49 @@ struct TreeReducer :
     return 0;
   }
 
+  // The tree reduction is started here and proceeds, without blocking, as far
+  // as the messages that have already arrived permit; finish completes it.
+  int start (const cedr::mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+             int nlocal, int count, MPI_Op op) const override {
+    cedr_assert(op == MPI_SUM);
+    cedr_assert(count == nfield_);
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp barrier
+#   pragma omp master
+#endif
+    r_.start_allreduce(typename Reducer::ConstRealList(sendbuf, nlocal*count),
+                       typename Reducer::RealList(rcvbuf, count), true);
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp barrier
+#endif
+    return 0;
+  }
+
+  int finish () const override {
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp barrier
+#   pragma omp master
+#endif
+    r_.finish_allreduce();
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp barrier
+#endif
+    return 0;
+  }
+
+  void progress () const override {
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp barrier
+#   pragma omp master
+#endif
+    r_.progress();
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp barrier
+#endif
+  }
+
+  bool is_split () const override { return true; }
+
 private:
   const Int n_accum_in_place_, nfield_;
   Reducer r_;
@@ -426,7 +469,8 @@ template <typename MT>
 CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int np_,
               Int qsize_, bool use_sgi, bool independent_time_steps,
               const bool hard_zero_, const Int* gid_data, const Int* rank_data,
-              const cedr::mpi::Parallel::Ptr& p_, Int fcomm)
+              const cedr::mpi::Parallel::Ptr& p_, Int fcomm,
+              const bool use_tree_reducer)
   : alg(Alg::convert(cdr_alg_)),
     ncell(ngblcell_), nlclcell(nlclcell_), nlev(nlev_), np(np_), qsize(qsize_),
     nsublev(Alg::is_suplev(alg) ? nsublev_per_suplev : 1),
@@ -452,9 +496,10 @@ CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int np_,
                                   (Alg::is_point(alg) ? np*np : 1)*
                                   (cdr_over_super_levels ? nsuplev : 1));
     typename CAAST::UserAllReducer::Ptr reducer;
-    //todo Measure perf on CPU and GPU of TreeReducer vs
-    // ReproSumReducer. For now, I'll continue to use ReproSumReducer.
-    if (false && ko::OnGpu<ko::MachineTraits::DES>::value) {
+    // ReproSumReducer is the default. TreeReducer is also BFB-invariant to
+    // rank decomposition, and its reduction proceeds between CAAS::start_run
+    // and finish_run, so the caller can do work while it is in flight.
+    if (use_tree_reducer) {
       tree = make_tree(p, ncell, gid_data, rank_data, 1, use_sgi, false, false);
       const Int nfield = 4*qsize*(cdr_over_super_levels ? 1 : nsuplev);
       reducer = std::make_shared<TreeReducer<MT> >(p, tree, ncell, nfield,
@@ -637,11 +682,12 @@ cedr_init_impl (const homme::Int fcomm, const homme::Int cdr_alg, const bool use
                 const homme::Int gbl_ncell, const homme::Int lcl_ncell,
                 const homme::Int nlev, const homme::Int np, const homme::Int qsize,
                 const bool independent_time_steps, const bool hard_zero,
-                const homme::Int, const homme::Int) {
+                const bool use_tree_reducer, const homme::Int, const homme::Int) {
   const auto p = cedr::mpi::make_parallel(MPI_Comm_f2c(fcomm));
   g_cdr = std::make_shared<homme::CDR<ko::MachineTraits> >(
     cdr_alg, gbl_ncell, lcl_ncell, nlev, np, qsize, use_sgi,
-    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm);
+    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm,
+    use_tree_reducer);
 }
 
 extern "C" void cedr_query_bufsz (homme::Int* sendsz, homme::Int* recvsz) {
@@ -748,6 +794,19 @@ void cedr_sl_run_global () {
                                            0, g_sl->ta->nelemd - 1);
 }
 
+void cedr_sl_start_run_global () {
+  homme::sl::start_run_global<ko::MachineTraits>(*g_cdr, *g_sl, nullptr, nullptr,
+                                                 0, g_sl->ta->nelemd - 1);
+}
+
+void cedr_sl_finish_run_global () {
+  homme::sl::finish_run_global<ko::MachineTraits>(*g_cdr);
+}
+
+void cedr_sl_progress_run_global () { g_cdr->cdr->progress_run(); }
+
+bool cedr_sl_run_global_is_split () { return g_cdr->cdr->run_is_split(); }
+
 void cedr_sl_run_local (const int limiter_option) {
   homme::sl::run_local(*g_cdr, *g_sl, nullptr, nullptr, 0, g_sl->ta->nelemd - 1,
                        false, limiter_option);
@@ -24,6 +24,20 @@ void CAAS::run_horiz_omp () {
   finish_locally_horiz_omp();
 }
 
+void CAAS::start_run_horiz_omp () {
+  cedr_assert(finished_setup_);
+  cedr_assert(user_reducer_ != nullptr);
+  reduce_locally_horiz_omp();
+  user_reducer_->start(*p_, send_.data(), recv_.data(),
+                       o.nlclcells_ / user_reducer_->n_accum_in_place(),
+                       recv_.size(), MPI_SUM);
+}
+
+void CAAS::finish_run_horiz_omp () {
+  user_reducer_->finish();
+  finish_locally_horiz_omp();
+}
+
 template <typename Func>
 void homme_parallel_for (const Int& beg, const Int& end, const Func& f) {
 #ifdef COMPOSE_HORIZ_OPENMP
@@ -23,9 +23,13 @@ struct CAAS : public cedr::caas::CAAS<Kokkos::Serial> {
   {}
 
   void run () override { run_horiz_omp(); }
+  void start_run () override { start_run_horiz_omp(); }
+  void finish_run () override { finish_run_horiz_omp(); }
 
 private:
   void run_horiz_omp();
+  void start_run_horiz_omp();
+  void finish_run_horiz_omp();
   void reduce_locally_horiz_omp();
   void finish_locally_horiz_omp();
 };
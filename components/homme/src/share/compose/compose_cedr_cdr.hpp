@@ -74,7 +74,7 @@ struct CDR {
   CDR(Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int np_, Int qsize_,
       bool use_sgi, bool independent_time_steps, const bool hard_zero_,
       const Int* gid_data, const Int* rank_data, const cedr::mpi::Parallel::Ptr& p_,
-      Int fcomm);
+      Int fcomm, const bool use_tree_reducer = false);
 
   CDR(const CDR&) = delete;
   CDR& operator=(const CDR&) = delete;
@@ -51,6 +51,15 @@ template <typename MT>
 void run_global(CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
                 const Int nets, const Int nete);
 
+// Split-phase run_global: start_run_global sets the CDR's data and starts the
+// CDR's global communication; finish_run_global completes it. In between, the
+// caller can do work that touches neither the tracers nor the CDR's data.
+template <typename MT>
+void start_run_global(CDR<MT>& cdr, const Data& d, Real* q_min_r,
+                      const Real* q_max_r, const Int nets, const Int nete);
+template <typename MT>
+void finish_run_global(CDR<MT>& cdr);
+
 template <typename MT>
 void run_local(CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
                const Int nets, const Int nete, const bool scalar_bounds,
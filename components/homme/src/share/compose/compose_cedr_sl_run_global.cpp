@@ -41,11 +41,22 @@ COMPOSE_FUNCTION ko::EnableIfOnGpu<MT> warn_on_Qm_prev_negative (
 {}
 
 template <typename MT>
-static void run_cdr (CDR<MT>& q) {
+static void start_run_cdr (CDR<MT>& q) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
-  q.cdr->run();
+  q.cdr->start_run();
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
+}
+
+template <typename MT>
+static void finish_run_cdr (CDR<MT>& q) {
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
+  q.cdr->finish_run();
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
@@ -172,8 +183,8 @@ void run_global (CDR<MT>& cdr, CDRT* cedr_cdr_p,
 }
 
 template <typename MT>
-void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
-                 const Int nets, const Int nete) {
+void start_run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r,
+                       const Real* q_max_r, const Int nets, const Int nete) {
   if (dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()))
     run_global<4, MT, typename CDR<MT>::QLTT>(
       cdr, dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()),
@@ -185,10 +196,28 @@ void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r
   else
     cedr_throw_if(true, "run_global: could not cast cdr.");
   ko::fence();
-  { Timer t("02_run_cdr");
-    run_cdr(cdr); }
+  { Timer t("02_start_run_cdr");
+    start_run_cdr(cdr); }
 }
 
+template <typename MT>
+void finish_run_global (CDR<MT>& cdr) {
+  Timer t("02_finish_run_cdr");
+  finish_run_cdr(cdr);
+}
+
+template <typename MT>
+void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
+                 const Int nets, const Int nete) {
+  start_run_global(cdr, d, q_min_r, q_max_r, nets, nete);
+  finish_run_global(cdr);
+}
+
+template void
+start_run_global(CDR<ko::MachineTraits>& cdr, const Data& d, Real* q_min_r,
+                 const Real* q_max_r, const Int nets, const Int nete);
+template void
+finish_run_global(CDR<ko::MachineTraits>& cdr);
 template void
 run_global(CDR<ko::MachineTraits>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
            const Int nets, const Int nete);
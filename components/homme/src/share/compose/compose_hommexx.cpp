@@ -8,6 +8,10 @@ islmpi::IslMpi<>::Ptr get_isl_mpi_singleton();
 
 bool cedr_should_run();
 void cedr_sl_run_global();
+void cedr_sl_start_run_global();
+void cedr_sl_finish_run_global();
+void cedr_sl_progress_run_global();
+bool cedr_sl_run_global_is_split();
 void cedr_sl_run_local(const int limiter_option);
 void cedr_sl_check();
 
@@ -80,6 +84,24 @@ bool property_preserve_global () {
   return true;
 }
 
+bool property_preserve_global_start () {
+  if ( ! cedr_should_run()) return false;
+  homme::cedr_sl_start_run_global();
+  return true;
+}
+
+void property_preserve_global_finish () {
+  homme::cedr_sl_finish_run_global();
+}
+
+void property_preserve_global_progress () {
+  homme::cedr_sl_progress_run_global();
+}
+
+bool property_preserve_global_is_split () {
+  return cedr_should_run() && homme::cedr_sl_run_global_is_split();
+}
+
 bool property_preserve_local (const int limiter_option) {
   if ( ! cedr_should_run()) return false;
   homme::cedr_sl_run_local(limiter_option);
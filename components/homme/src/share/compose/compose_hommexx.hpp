@@ -27,6 +27,16 @@ void advect(const int np1, const int n0_qdp, const int np1_qdp);
 
 void set_dp3d_np1(const int np1);
 bool property_preserve_global();
+// Split-phase property_preserve_global. If start returns true, finish must be
+// called before property_preserve_local. In between, the caller may do work
+// that does not touch the tracers.
+bool property_preserve_global_start();
+void property_preserve_global_finish();
+// Advance the reduction started in property_preserve_global_start without
+// blocking; call any number of times before finish.
+void property_preserve_global_progress();
+// Whether the reduction is actually in flight between start and finish.
+bool property_preserve_global_is_split();
 bool property_preserve_local(const int limiter_option);
 void property_preserve_check();
 
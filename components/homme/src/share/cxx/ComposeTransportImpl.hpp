@@ -120,7 +120,11 @@ struct ComposeTransportImpl {
   TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_qsize, m_tu_ne_hv_q;
 
   std::shared_ptr<BoundaryExchange>
-    m_qdp_dss_be[Q_NUM_TIME_LEVELS], m_v_dss_be[2], m_hv_dss_be[2];
+    m_qdp_dss_be[Q_NUM_TIME_LEVELS], m_v_dss_be[2], m_hv_dss_be[2],
+    m_omega_dss_be;
+  // If true, omega has its own DSS, done while the CDR's global reduction is in
+  // flight; otherwise, omega is DSSed with qdp.
+  bool m_omega_dss_in_cdr;
 
   ComposeTransportImpl();
   ComposeTransportImpl(const int num_elems);
@@ -25,14 +25,16 @@ static int calc_nslot (const int nelemd) {
 
 ComposeTransportImpl::ComposeTransportImpl ()
   : m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), m_tp_ne_hv_q(1,1,1), // throwaway settings
-    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_hv_q(m_tp_ne_hv_q)
+    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_hv_q(m_tp_ne_hv_q),
+    m_omega_dss_in_cdr(false)
 {
   setup();
 }
 
 ComposeTransportImpl::ComposeTransportImpl (const int num_elems)
   : m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), m_tp_ne_hv_q(1,1,1), // throwaway settings
-    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_hv_q(m_tp_ne_hv_q)
+    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_hv_q(m_tp_ne_hv_q),
+    m_omega_dss_in_cdr(false)
 {
   nslot = calc_nslot(m_geometry.num_elems());
 }
@@ -150,6 +152,11 @@ void ComposeTransportImpl::init_boundary_exchanges () {
   auto bm_exchange = Context::singleton().get<MpiBuffersManagerMap>()[MPI_EXCHANGE];
   const auto& sp = Context::singleton().get<SimulationParams>();
 
+  // The CDR was created in compose_init, before this call. If its global
+  // reduction proceeds between start and finish, the extra round of messages
+  // for a separate omega DSS is hidden behind it.
+  m_omega_dss_in_cdr = homme::compose::property_preserve_global_is_split();
+
   // For qdp DSS at end of transport step.
   for (int i = 0; i < Q_NUM_TIME_LEVELS; ++i) {
     m_qdp_dss_be[i] = std::make_shared<BoundaryExchange>();
@@ -157,8 +164,19 @@ void ComposeTransportImpl::init_boundary_exchanges () {
     be->set_label(std::string("ComposeTransport-qdp-DSS-" + std::to_string(i)));
     be->set_diagnostics_level(sp.internal_diagnostics_level);
     be->set_buffers_manager(bm_exchange);
-    be->set_num_fields(0, 0, m_data.qsize + 1);
+    be->set_num_fields(0, 0, m_data.qsize + (m_omega_dss_in_cdr ? 0 : 1));
     be->register_field(m_tracers.qdp, i, m_data.qsize, 0);
+    if ( ! m_omega_dss_in_cdr) be->register_field(m_derived.m_omega_p);
+    be->registration_completed();
+  }
+
+  if (m_omega_dss_in_cdr) {
+    m_omega_dss_be = std::make_shared<BoundaryExchange>();
+    auto be = m_omega_dss_be;
+    be->set_label("ComposeTransport-omega-DSS");
+    be->set_diagnostics_level(sp.internal_diagnostics_level);
+    be->set_buffers_manager(bm_exchange);
+    be->set_num_fields(0, 0, 1);
     be->register_field(m_derived.m_omega_p);
     be->registration_completed();
   }
@@ -230,8 +248,29 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   homme::compose::set_dp3d_np1(m_data.independent_time_steps ?
                                0 : // dp3d is actually divdp
                                tl.np1);
-  const auto run_cedr = homme::compose::property_preserve_global();
-  if (run_cedr) Kokkos::fence();
+  const auto run_cedr = homme::compose::property_preserve_global_start();
+  { // Overlap the CDR's global reduction with the omega DSS, which does not
+    // depend on the tracers. If the reduction is not split, only the scaling
+    // is done here, and omega is exchanged with qdp below.
+    const auto omega = m_derived.m_omega_p;
+    const auto spheremp = m_geometry.m_spheremp;
+    const auto f = KOKKOS_LAMBDA (const int idx) {
+      int ie, i, j, lev;
+      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
+      omega(ie,i,j,lev) *= spheremp(ie,i,j);
+    };
+    launch_ie_ij_nlev<num_lev_pack>(f);
+    if (m_omega_dss_in_cdr) {
+      m_omega_dss_be->pack_and_send();
+      if (run_cedr) homme::compose::property_preserve_global_progress();
+      m_omega_dss_be->recv_and_unpack(m_geometry.m_rspheremp);
+      if (run_cedr) homme::compose::property_preserve_global_progress();
+    }
+  }
+  if (run_cedr) {
+    homme::compose::property_preserve_global_finish();
+    Kokkos::fence();
+  }
   GPTLstop("compose_cedr_global");
   GPTLstart("compose_cedr_local");
   if (run_cedr) {
@@ -269,13 +308,8 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
       qdp(ie,np1_qdp,q,i,j,lev) *= spheremp(ie,i,j);
     };
     launch_ie_q_ij_nlev<num_lev_pack>(qsize, f1);
-    const auto omega = m_derived.m_omega_p;
-    const auto f2 = KOKKOS_LAMBDA (const int idx) {
-      int ie, i, j, lev;
-      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
-      omega(ie,i,j,lev) *= spheremp(ie,i,j);
-    };
-    launch_ie_ij_nlev<num_lev_pack>(f2);
+    // omega was already multiplied by spheremp, and possibly DSSed, while the
+    // CDR ran.
     m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
     Kokkos::fence();
     GPTLstop("compose_dss_q");
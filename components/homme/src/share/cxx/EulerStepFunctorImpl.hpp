@@ -108,6 +108,11 @@ class EulerStepFunctorImpl {
 
   bool                m_kernel_will_run_limiters;
 
+  // Whether to overlap advect_and_limit with the qdp/dss_var exchange. If
+  // m_elems_subset is not empty, advect_and_limit only processes these elements.
+  bool                          m_overlap_exchange;
+  ExecViewUnmanaged<const int*> m_elems_subset;
+
   ThreadPreferences m_tpref;
 
   std::shared_ptr<BoundaryExchange> m_mm_be, m_mmqb_be;
@@ -130,6 +135,7 @@ public:
    , m_tu_ne_qsize   (Homme::get_default_team_policy<ExecSpace>(1))
    , m_prev_num_elems(0)
    , m_prev_qsize    (0)
+   , m_overlap_exchange(false)
   {
     m_kernel_will_run_limiters = false;
     m_tpref.prefer_larger_team = true;
@@ -142,6 +148,7 @@ public:
     , m_tu_ne_qsize   (Homme::get_default_team_policy<ExecSpace>(1))
     , m_prev_num_elems(0)
     , m_prev_qsize    (0)
+    , m_overlap_exchange(false)
   {}
 
   void setup ()
@@ -165,6 +172,7 @@ public:
     m_data.nu_p = params.nu_p;
     m_data.nu_q = params.nu_q;
     m_data.consthv = (params.hypervis_scaling == 0);
+    m_overlap_exchange = params.overlap_bndry_exchange;
 
     if (m_data.limiter_option == 4) {
       std::string msg = "[EulerStepFunctorImpl::reset]:";
@@ -417,18 +425,24 @@ public:
 
   void advect_and_limit() {
     profiling_resume();
-    Kokkos::parallel_for(
+    auto setup_policy =
       Homme::get_default_team_policy<ExecSpace, AALSetupPhase>(
-        m_geometry.num_elems(), m_tpref),
-      *this);
-    Kokkos::fence();
-    m_kernel_will_run_limiters = true;
-    Kokkos::parallel_for(
+        m_geometry.num_elems(), m_tpref);
+    auto tracer_policy =
       //to play with launch bounds
       //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
       Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
-        m_geometry.num_elems() * m_data.qsize, m_tpref),
-      *this);
+        m_geometry.num_elems() * m_data.qsize, m_tpref);
+    if (m_elems_subset.size() > 0) {
+      // Keep the team size of the full policies, since m_tu_ne* are sized on them
+      const int nelems = m_elems_subset.extent_int(0);
+      setup_policy  = Homme::get_subset_team_policy(setup_policy, nelems);
+      tracer_policy = Homme::get_subset_team_policy(tracer_policy, nelems * m_data.qsize);
+    }
+    Kokkos::parallel_for(setup_policy, *this);
+    Kokkos::fence();
+    m_kernel_will_run_limiters = true;
+    Kokkos::parallel_for(tracer_policy, *this);
     Kokkos::fence();
     m_kernel_will_run_limiters = false;
     profiling_pause();
@@ -437,12 +451,14 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALSetupPhase&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu_ne);
+    if (m_elems_subset.size() > 0) kv.ie = m_elems_subset(kv.ie);
     run_setup_phase(kv);
   }
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALTracerPhase&, const TeamMember& team) const {
     KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    if (m_elems_subset.size() > 0) kv.ie = m_elems_subset(kv.ie);
     run_tracer_phase(kv);
   }
 
@@ -607,6 +623,22 @@ public:
     GPTLstop("eus_bexch");
   }
 
+  // Same as advect_and_limit followed by exchange_qdp_dss_var, but the
+  // interior elements are advected while the halo data is in flight.
+  void advect_and_limit_overlapped () {
+    auto compute = [&](const ExecViewUnmanaged<const int*>& elems) {
+      GPTLstart("tl-at adv-n-limit");
+      m_elems_subset = elems;
+      advect_and_limit();
+      m_elems_subset = ExecViewUnmanaged<const int*>();
+      GPTLstop("tl-at adv-n-limit");
+    };
+    GPTLstart("eus_bexch");
+    const int idx = 3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt);
+    m_bes[idx]->exchange_overlapped(compute, m_geometry.m_rspheremp);
+    GPTLstop("eus_bexch");
+  }
+
   void euler_step(const int np1_qdp, const int n0_qdp, const Real dt,
                   const Real rhs_multiplier, const DSSOption DSSopt) {
 
@@ -653,10 +685,14 @@ public:
       }
     }
 
-    GPTLstart("tl-at adv-n-limit");
-    advect_and_limit();
-    GPTLstop("tl-at adv-n-limit");
-    exchange_qdp_dss_var();
+    if (m_overlap_exchange) {
+      advect_and_limit_overlapped();
+    } else {
+      GPTLstart("tl-at adv-n-limit");
+      advect_and_limit();
+      GPTLstop("tl-at adv-n-limit");
+      exchange_qdp_dss_var();
+    }
   }
 
 private:
@@ -181,6 +181,21 @@ get_default_team_policy(const int num_parallel_iterations,
   return policy;
 }
 
+// Return a TeamPolicy with the same team size and vector length as the input
+// one, but a different league size. Useful to run a kernel on a subset of the
+// elements: the team workspaces (see TeamUtils) are sized on the team size of
+// the full policy, so the latter must not change.
+template <typename ExecSpace, typename... Tags>
+Kokkos::TeamPolicy<ExecSpace, Tags...>
+get_subset_team_policy(const Kokkos::TeamPolicy<ExecSpace, Tags...>& policy,
+                       const int num_parallel_iterations) {
+  auto subset = Kokkos::TeamPolicy<ExecSpace, Tags...>(num_parallel_iterations,
+                                                   policy.team_size(),
+                                                   policy.impl_vector_length());
+  subset.set_chunk_size(1);
+  return subset;
+}
+
 template<typename ExecSpaceType, typename... Tags>
 static
 typename std::enable_if<!OnGpu<ExecSpaceType>::value,int>::type
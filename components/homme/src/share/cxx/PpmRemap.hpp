@@ -201,6 +201,20 @@ struct PpmVertRemap : public VertRemapAlg {
   void compute_remap_phase(KernelVariables &kv,
                            ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]> remap_var)
       const {
+    compute_remap_phase(kv, 1, [&](const int) { return remap_var; });
+  }
+
+  // Remaps a batch of num_vars variables on the grids of element kv.ie.
+  // get_var(iv) must return the iv-th variable of the batch, as a
+  // view of type ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>.
+  // Each thread owns one (igp,jgp) column and loops over the batch, so that
+  // the grid quantities computed in compute_grids_phase (dpo, ppmdx, kid, z2)
+  // are read once per column and stay in cache for all the variables, while
+  // the levels are still processed by the vector lanes.
+  template <typename GetVarFunctor>
+  KOKKOS_INLINE_FUNCTION
+  void compute_remap_phase(KernelVariables &kv, const int num_vars,
+                           const GetVarFunctor &get_var) const {
     // From here, we loop over tracers for only those portions which depend on
     // tracer data, which includes PPM limiting and mass accumulation
     // More parallelism than we need here, maybe break it up?
@@ -209,48 +223,55 @@ struct PpmVertRemap : public VertRemapAlg {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
 
-      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
-                           [&](const int k) {
-        const int ilevel = k / VECTOR_SIZE;
-        const int ivector = k % VECTOR_SIZE;
-        m_ao(kv.team_idx, igp, jgp, k + _ppm_consts::INITIAL_PADDING) =
-            remap_var(igp, jgp, ilevel)[ivector] /
-            m_dpo(kv.ie, igp, jgp, k + _ppm_consts::INITIAL_PADDING);
-      });
+      // Tracer-independent quantities, shared by the whole batch
+      const auto pt_dpo   = Homme::subview(m_dpo, kv.ie, igp, jgp);
+      const auto pt_ppmdx = Homme::subview(m_ppmdx, kv.ie, igp, jgp);
+      const auto pt_kid   = Homme::subview(m_kid, kv.ie, igp, jgp);
+      const auto pt_z2    = Homme::subview(m_z2, kv.ie, igp, jgp);
+
+      // Workspace, reused by each variable of the batch
+      const auto pt_ao     = Homme::subview(m_ao, kv.team_idx, igp, jgp);
+      const auto pt_mass_o = Homme::subview(m_mass_o, kv.team_idx, igp, jgp);
+      const auto pt_dma    = Homme::subview(m_dma, kv.team_idx, igp, jgp);
+      const auto pt_ai     = Homme::subview(m_ai, kv.team_idx, igp, jgp);
+      const auto pt_coeffs = Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp);
+
+      for (int iv = 0; iv < num_vars; ++iv) {
+        const ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]> var = get_var(iv);
+        const ExecViewUnmanaged<Scalar[NUM_LEV]> pt_var =
+            Homme::subview(var, igp, jgp);
+
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                             [&](const int k) {
+          const int ilevel = k / VECTOR_SIZE;
+          const int ivector = k % VECTOR_SIZE;
+          pt_ao(k + _ppm_consts::INITIAL_PADDING) =
+              pt_var(ilevel)[ivector] /
+              pt_dpo(k + _ppm_consts::INITIAL_PADDING);
+        });
 
-      boundaries::fill_cell_means_gs(kv, Homme::subview(m_dpo, kv.ie, igp, jgp),
-                                     Homme::subview(m_ao, kv.team_idx, igp, jgp));
+        boundaries::fill_cell_means_gs(kv, pt_dpo, pt_ao);
+
+        Dispatch<ExecSpace>::parallel_scan(
+            kv.team, NUM_PHYSICAL_LEV,
+            [=](const int &k, Real &accumulator, const bool last) {
+              // Accumulate the old mass up to old grid cell interface locations
+              // to simplify integration during remapping. Also, divide out the
+              // grid spacing so we're working with actual tracer values and can
+              // conserve mass.
+              const int ilevel = k / VECTOR_SIZE;
+              const int ivector = k % VECTOR_SIZE;
+              accumulator += pt_var(ilevel)[ivector];
+              if (last) {
+                pt_mass_o(k + 1) = accumulator;
+              }
+        });
 
-      Dispatch<ExecSpace>::parallel_scan(
-          kv.team, NUM_PHYSICAL_LEV,
-          [=](const int &k, Real &accumulator, const bool last) {
-            // Accumulate the old mass up to old grid cell interface locations
-            // to simplify integration during remapping. Also, divide out the
-            // grid spacing so we're working with actual tracer values and can
-            // conserve mass.
-            const int ilevel = k / VECTOR_SIZE;
-            const int ivector = k % VECTOR_SIZE;
-            accumulator += remap_var(igp, jgp, ilevel)[ivector];
-            if (last) {
-              m_mass_o(kv.team_idx, igp, jgp, k + 1) = accumulator;
-            }
-      });
+        // Computes a monotonic and conservative PPM reconstruction
+        compute_ppm(kv, pt_ao, pt_ppmdx, pt_dma, pt_ai, pt_coeffs);
 
-      // Computes a monotonic and conservative PPM reconstruction
-      compute_ppm(kv,
-                  Homme::subview(m_ao, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ppmdx, kv.ie, igp, jgp),
-                  Homme::subview(m_dma, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ai, kv.team_idx, igp, jgp),
-                  Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp));
-
-      compute_remap(kv,
-                    Homme::subview(m_kid, kv.ie, igp, jgp),
-                    Homme::subview(m_z2, kv.ie, igp, jgp),
-                    Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp),
-                    Homme::subview(m_mass_o, kv.team_idx, igp, jgp),
-                    Homme::subview(m_dpo, kv.ie, igp, jgp),
-                    Homme::subview(remap_var, igp, jgp));
+        compute_remap(kv, pt_kid, pt_z2, pt_coeffs, pt_mass_o, pt_dpo, pt_var);
+      }
     }); // End team thread range
     kv.team_barrier();
   }
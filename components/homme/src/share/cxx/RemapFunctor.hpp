@@ -311,7 +311,7 @@ struct RemapFunctor : public Remapper {
    // Functor tags are irrelevant below
    , m_tu_ne(remap_team_policy<ComputeThicknessTag>(m_state.num_elems()))
    , m_tu_ne_nsr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * m_fields_provider.num_states_remap()))
-   , m_tu_ne_ntr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_to_remap()))
+   , m_tu_ne_ntr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_remap_batches(num_to_remap())))
   {
     // Members used for sanity checks
     valid_layer_thickness = decltype(valid_layer_thickness)("Check for whether the surface thicknesses are positive",elements.num_elems());
@@ -345,6 +345,17 @@ struct RemapFunctor : public Remapper {
   KOKKOS_INLINE_FUNCTION
   int num_to_remap() const { return m_fields_provider.num_states_remap() + m_data.qsize; }
 
+  // Variables are remapped in batches: each team of the remap phase handles
+  // up to remap_batch_size variables of one element, reusing the element's
+  // grids across the batch. On GPU, batches are kept small, so that there
+  // are still enough teams to fill the device.
+  static constexpr int remap_batch_size = OnGpu<ExecSpace>::value ? 4 : 16;
+
+  KOKKOS_INLINE_FUNCTION
+  static int num_remap_batches(const int num_vars) {
+    return (num_vars + remap_batch_size - 1) / remap_batch_size;
+  }
+
   KOKKOS_INLINE_FUNCTION
   ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>
   get_remap_val(const KernelVariables &kv, int var) const {
@@ -414,11 +425,15 @@ struct RemapFunctor : public Remapper {
   void operator()(ComputeRemapTag, const TeamMember &team) const {
     KernelVariables kv(team, m_tu_ne_ntr);
     assert(num_to_remap() != 0);
-    const int var = kv.ie % num_to_remap();
-    kv.ie /= num_to_remap();
+    const int num_batches = num_remap_batches(num_to_remap());
+    const int first_var = (kv.ie % num_batches) * remap_batch_size;
+    const int num_vars = min(remap_batch_size, num_to_remap() - first_var);
+    kv.ie /= num_batches;
     assert(kv.ie < m_state.num_elems());
 
-    this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
+    this->m_remap.compute_remap_phase(kv, num_vars, [&](const int iv) {
+      return get_remap_val(kv, first_var + iv);
+    });
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -474,7 +489,7 @@ struct RemapFunctor : public Remapper {
       run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
                                    m_state.num_elems());
       run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
-                                   m_state.num_elems() * num_to_remap());
+                                   m_state.num_elems() * num_remap_batches(num_to_remap()));
       if (nonzero_rsplit) {
         run_functor<ComputeIntrinsicsTag>("Remap Rescale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
@@ -504,12 +519,16 @@ struct RemapFunctor : public Remapper {
     };
     Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), g);
     const auto tu_ne_ntr = m_tu_ne_ntr;
+    const int nb = num_remap_batches(nv);
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
-      KernelVariables kv(team, nv, tu_ne_ntr);
-      remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, kv.iq, ALL(), ALL(), ALL()));
+      KernelVariables kv(team, nb, tu_ne_ntr);
+      const int first_var = kv.iq * remap_batch_size;
+      remap.compute_remap_phase(kv, min(remap_batch_size, nv - first_var), [&](const int iv) {
+        return Kokkos::subview(v, kv.ie, first_var + iv, ALL(), ALL(), ALL());
+      });
     };
     Kokkos::fence();
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
+    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nb), r);
   }
 
   void remap1 (
@@ -530,12 +549,16 @@ struct RemapFunctor : public Remapper {
     };
     Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), g);
     const auto tu_ne_ntr = m_tu_ne_ntr;
+    const int nb = num_remap_batches(nv);
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
-      KernelVariables kv(team, nv, tu_ne_ntr);
-      remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, n_v, kv.iq, ALL(), ALL(), ALL()));
+      KernelVariables kv(team, nb, tu_ne_ntr);
+      const int first_var = kv.iq * remap_batch_size;
+      remap.compute_remap_phase(kv, min(remap_batch_size, nv - first_var), [&](const int iv) {
+        return Kokkos::subview(v, kv.ie, n_v, first_var + iv, ALL(), ALL(), ALL());
+      });
     };
     Kokkos::fence();
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
+    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nb), r);
   }
 
   int requested_buffer_size () const override {
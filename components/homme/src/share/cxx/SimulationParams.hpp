@@ -69,6 +69,14 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // Overlap the computation on interior elements with the boundary exchanges
+  // of CAAR, hyperviscosity and euler step. Default is false.
+  bool      overlap_bndry_exchange = false;
+
+  // DIRK Newton solver options. See DirkFunctorImpl::set_newton_options.
+  bool      dirk_column_convergence = false;
+  bool      dirk_warm_start = false;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +121,9 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   overlap_bndry_exchange: " << (overlap_bndry_exchange ? "yes" : "no") << "\n";
+  out << "   dirk_column_convergence: " << (dirk_column_convergence ? "yes" : "no") << "\n";
+  out << "   dirk_warm_start: " << (dirk_warm_start ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
@@ -172,7 +172,9 @@ namespace Remap {
 // compute_remap_phase remaps each of the tracers based on the quantities
 // previously computed in compute_grids_phase.
 // It is also expected to have a large amount of parallelism, specifically
-// qsize * num_elems
+// qsize * num_elems. It comes in two flavors: one remapping a single
+// variable, and one remapping a batch of variables of the same element,
+// which allows the grid quantities to be reused across the batch.
 struct VertRemapAlg {};
 } // namespace Remap
 
@@ -59,6 +59,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_local_pack_pending = false;
 
   m_diagnostics_level = 0;
 }
@@ -360,12 +361,21 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 }
 
+// Whether a connection with the given sharing must be packed when packing the
+// connections of type 'which' (LOCAL, SHARED, or ANY). Missing connections
+// point to the blackhole, and are packed together with the shared ones.
+KOKKOS_INLINE_FUNCTION
+static bool to_be_packed (const int sharing, const int which) {
+  return which == etoi(ConnectionSharing::ANY) ||
+         ((which == etoi(ConnectionSharing::LOCAL)) == (sharing == etoi(ConnectionSharing::LOCAL)));
+}
+
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields, const int which) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +384,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      if ( ! to_be_packed(info.sharing, which)) return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -391,7 +402,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const int num_elems, const int num_3d_fields, const int which,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -411,6 +422,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        if ( ! to_be_packed(info.sharing, which)) return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -442,6 +454,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if ( ! to_be_packed(info.sharing, which)) continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -462,6 +475,57 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 }
 
 void BoundaryExchange::pack_and_send ()
+{
+  pack_and_send(ConnectionSharing::ANY);
+}
+
+void BoundaryExchange::pack_and_send_shared ()
+{
+  pack_and_send(ConnectionSharing::SHARED);
+}
+
+void BoundaryExchange::pack_local ()
+{
+  tstart("be pack_local");
+  // I am not sure why and if we could have this scenario, but just in case.
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // The shared connections must have been packed (and sent) already
+  assert (m_send_pending && m_local_pack_pending);
+
+  pack_fields(ConnectionSharing::LOCAL);
+  m_local_pack_pending = false;
+  tstop("be pack_local");
+}
+
+void BoundaryExchange::pack_fields (const ConnectionSharing which)
+{
+  const int iwhich = etoi(which);
+  const auto& ucon = m_connectivity->get_d_ucon();
+  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  // First, pack 2d fields (if any)...
+  if (m_num_2d_fields > 0)
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+         m_num_2d_fields, iwhich);
+  // ...then pack 3d fields (if any)...
+  if (m_num_3d_fields > 0) {
+    if (m_3d_nlev_pack_d.size() > 0)
+      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                          m_num_elems, m_num_3d_fields, iwhich, &m_3d_nlev_pack_d);
+    else
+      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                    m_num_elems, m_num_3d_fields, iwhich);
+  }
+  // ...then pack 3d interface fields (if any)
+  if (m_num_3d_int_fields > 0)
+    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                    m_num_elems, m_num_3d_int_fields, iwhich);
+  Kokkos::fence();
+}
+
+void BoundaryExchange::pack_and_send (const ConnectionSharing which)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -489,27 +553,18 @@ void BoundaryExchange::pack_and_send ()
     tstop("be build_buffer_views_and_requests");
   }
 
-  // ---- Pack ---- //
-  const auto& ucon = m_connectivity->get_d_ucon();
-  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, pack 2d fields (if any)...
-  if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
-  // ...then pack 3d fields (if any)...
-  if (m_num_3d_fields > 0) {
-    if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
-    else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+  // When splitting the pack, the local connections are packed later on, while
+  // messages are in flight. Start receiving now, like in 'exchange'.
+  if (which == ConnectionSharing::SHARED) {
+    if ( ! m_recv_requests.empty())
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                              m_connectivity->get_comm().mpi_comm());
+    m_recv_pending = true;
+    m_local_pack_pending = true;
   }
-  // ...then pack 3d interface fields (if any)
-  if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
-  Kokkos::fence();
+
+  // ---- Pack ---- //
+  pack_fields(which);
 
   // ---- Send ---- //
   tstart("be sync_send_buffer");
@@ -529,6 +584,10 @@ void BoundaryExchange::recv_and_unpack () {
   recv_and_unpack(nullptr);
 }
 
+void BoundaryExchange::recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  recv_and_unpack(&rspheremp);
+}
+
 // assume:conn-edges-snwe
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
@@ -693,6 +752,9 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
     return;
   }
 
+  // If the pack was split, the local connections must have been packed too
+  assert (!m_local_pack_pending);
+
   // If I am doing pack_and_send and recv_and_unpack manually (rather than
   // through 'exchange'), then I need to start receiving now (otherwise it is
   // done already inside 'exchange')
@@ -218,6 +218,23 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
+  // Split version of pack_and_send: pack_and_send_shared starts the receives, and
+  // packs/sends only the shared connections; pack_local packs the local connections.
+  // Both must be called, in this order, before recv_and_unpack.
+  void pack_and_send_shared ();
+  void pack_local ();
+
+  // Overlap the exchange with the computation of the registered fields.
+  // compute(elems) must compute the registered fields on the elements with the
+  // given local ids, and fence. It is called first on the halo elements (see
+  // Connectivity), whose data is then sent, and then on the interior elements,
+  // while messages are in flight.
+  template<typename ComputeFunctor>
+  void exchange_overlapped (const ComputeFunctor& compute);
+  template<typename ComputeFunctor>
+  void exchange_overlapped (const ComputeFunctor& compute, ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
@@ -301,6 +318,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_local_pack_pending;
 
   int         m_num_elems;
 
@@ -313,10 +331,57 @@ private:
   void free_requests();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  template<typename ComputeFunctor>
+  void exchange_overlapped (const ComputeFunctor& compute,
+                            const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+
+  // Pack (and send) only the connections with the given sharing (ANY for all)
+  void pack_and_send (const ConnectionSharing which);
+  void pack_fields (const ConnectionSharing which);
 public: // This is semantically private but must be public for nvcc.
   void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 };
 
+// ============================ OVERLAPPED EXCHANGE ========================= //
+
+template<typename ComputeFunctor>
+void BoundaryExchange::exchange_overlapped (const ComputeFunctor& compute)
+{
+  exchange_overlapped(compute,nullptr);
+}
+
+template<typename ComputeFunctor>
+void BoundaryExchange::exchange_overlapped (const ComputeFunctor& compute,
+                                            ExecViewUnmanaged<const Real * [NP][NP]> rspheremp)
+{
+  exchange_overlapped(compute,&rspheremp);
+}
+
+template<typename ComputeFunctor>
+void BoundaryExchange::exchange_overlapped (const ComputeFunctor& compute,
+                                            const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  // Check that the registration has completed first
+  assert (m_registration_completed);
+
+  const auto halo_elems = m_connectivity->get_d_halo_elems();
+  const auto interior_elems = m_connectivity->get_d_interior_elems();
+
+  if (m_diagnostics_level > 0) {
+    // The diagnostics hash the whole state before the exchange, so don't overlap
+    if (halo_elems.size() > 0) compute(halo_elems);
+    if (interior_elems.size() > 0) compute(interior_elems);
+    exchange(rspheremp);
+    return;
+  }
+
+  if (halo_elems.size() > 0) compute(halo_elems);
+  pack_and_send_shared();
+  if (interior_elems.size() > 0) compute(interior_elems);
+  pack_local();
+  recv_and_unpack(rspheremp);
+}
+
 // ============================ REGISTER METHODS ========================= //
 
 // --- 2d fields --- //
@@ -9,6 +9,7 @@
 
 #include <array>
 #include <algorithm>
+#include <vector>
 
 namespace Homme
 {
@@ -136,6 +137,7 @@ void Connectivity::finalize(const bool sanity_check)
   }
 
   setup_ucon();
+  setup_elems_partition();
 
   m_finalized = true;
 }
@@ -313,6 +315,31 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::setup_elems_partition () {
+  std::vector<int> halo, interior;
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool is_halo = false;
+    if (h_ucon.size() > 0) {
+      for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k) {
+        if (h_ucon(k).sharing == etoi(ConnectionSharing::SHARED)) {
+          is_halo = true;
+          break;
+        }
+      }
+    }
+    (is_halo ? halo : interior).push_back(ie);
+  }
+
+  d_halo_elems = decltype(d_halo_elems)("Halo elements", halo.size());
+  d_interior_elems = decltype(d_interior_elems)("Interior elements", interior.size());
+  auto h_halo_elems = Kokkos::create_mirror_view(d_halo_elems);
+  auto h_interior_elems = Kokkos::create_mirror_view(d_interior_elems);
+  for (size_t i = 0; i < halo.size(); ++i) h_halo_elems(i) = halo[i];
+  for (size_t i = 0; i < interior.size(); ++i) h_interior_elems(i) = interior[i];
+  Kokkos::deep_copy(d_halo_elems, h_halo_elems);
+  Kokkos::deep_copy(d_interior_elems, h_interior_elems);
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
@@ -322,6 +349,8 @@ void Connectivity::clean_up()
   h_ucon = decltype(h_ucon)("", 0);
   d_ucon_ptr = decltype(d_ucon_ptr)("", 0);
   h_ucon_ptr = decltype(h_ucon_ptr)("", 0);
+  d_halo_elems = decltype(d_halo_elems)("", 0);
+  d_interior_elems = decltype(d_interior_elems)("", 0);
 
   m_initialized = false;
   m_finalized   = false;
@@ -122,6 +122,12 @@ public:
   KOKKOS_INLINE_FUNCTION
   int get_num_local_connections  () const { return get_num_connections<MemSpace>(ConnectionSharing::LOCAL, ConnectionKind::ANY); }
 
+  // Local ids of the elements with at least one shared connection (halo elements),
+  // and of the elements whose connections are all local (interior elements).
+  // Used to overlap the computation on the interior elements with the exchange.
+  ExecViewUnmanaged<const int*> get_d_halo_elems     () const { return d_halo_elems;     }
+  ExecViewUnmanaged<const int*> get_d_interior_elems () const { return d_interior_elems; }
+
   int get_num_local_elements     () const { return m_num_local_elements;  }
   int get_max_corner_elements    () const { return m_max_corner_elements; }
 
@@ -156,6 +162,8 @@ private:
   ExecViewManaged<int*>::HostMirror h_ucon_ptr;
   ExecViewManaged<int*>             d_ucon_dir_ptr;
   ExecViewManaged<int*>::HostMirror h_ucon_dir_ptr;
+  ExecViewManaged<int*>             d_halo_elems;
+  ExecViewManaged<int*>             d_interior_elems;
   // Helper used to accumulate connections during add_connection phase. Emptied
   // in finalize. l_ is local; r_ is remote.
   struct UConInfo {
@@ -167,6 +175,8 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // In finalize call, split the local elements in halo/interior, using the ucon data.
+  void setup_elems_partition();
 };
 
 } // namespace Homme
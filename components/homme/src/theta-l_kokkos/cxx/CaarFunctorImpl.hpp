@@ -92,6 +92,15 @@ struct CaarFunctorImpl {
   const bool          m_theta_hydrostatic_mode;
   const AdvectionForm m_theta_advection_form;
   const bool          m_pgrad_correction;
+  const bool          m_overlap_exchange;
+
+  // If not empty, the pre-exchange kernel only processes these elements
+  ExecViewUnmanaged<const int*> m_elems_subset;
+
+  // GPTL handles of the run timers, set at the first run, so that
+  // GPTL does not need to hash the timer names at every call
+  void* m_compute_timer = nullptr;
+  void* m_bexchV_timer  = nullptr;
 
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
@@ -131,6 +140,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_exchange(params.overlap_bndry_exchange)
       , m_hvcoord(hvcoord)
       , m_state(elements.m_state)
       , m_derived(elements.m_derived)
@@ -154,6 +164,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_exchange(params.overlap_bndry_exchange)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
@@ -345,24 +356,46 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    int nerr = 0;
+    if (m_overlap_exchange) {
+      // Compute the elements on the rank boundary first, send their data, and
+      // compute the interior elements while messages are in flight.
+      auto compute = [&](const ExecViewUnmanaged<const int*>& elems) {
+        GPTLstart_handle("caar compute",&m_compute_timer);
+        int nerr_subset;
+        m_elems_subset = elems;
+        const auto policy = Homme::get_subset_team_policy(m_policy_pre, elems.extent_int(0));
+        Kokkos::parallel_reduce("caar loop pre-boundary exchange", policy, *this, nerr_subset);
+        Kokkos::fence();
+        m_elems_subset = ExecViewUnmanaged<const int*>();
+        nerr += nerr_subset;
+        GPTLstop_handle("caar compute",&m_compute_timer);
+      };
+      GPTLstart_handle("caar_bexchV",&m_bexchV_timer);
+      m_bes[data.np1]->exchange_overlapped(compute, m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop_handle("caar_bexchV",&m_bexchV_timer);
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    } else {
+      GPTLstart_handle("caar compute",&m_compute_timer);
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+      Kokkos::fence();
+      GPTLstop_handle("caar compute",&m_compute_timer);
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart_handle("caar_bexchV",&m_bexchV_timer);
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop_handle("caar_bexchV",&m_bexchV_timer);
+    }
 
     if (!m_theta_hydrostatic_mode) {
-      GPTLstart("caar compute");
+      GPTLstart_handle("caar compute",&m_compute_timer);
       Kokkos::parallel_for("caar loop post-boundary exchange", m_policy_post, *this);
       Kokkos::fence();
-      GPTLstop("caar compute");
+      GPTLstop_handle("caar compute",&m_compute_timer);
     }
 
     limiter.run(data.np1);
@@ -376,6 +409,7 @@ struct CaarFunctorImpl {
     // Note: make sure the same temp is not used within each epoch!
 
     KernelVariables kv(team, m_tu);
+    if (m_elems_subset.size() > 0) kv.ie = m_elems_subset(kv.ie);
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
@@ -7,16 +7,24 @@
 #include "DirkFunctor.hpp"
 #include "DirkFunctorImpl.hpp"
 #include "Context.hpp"
+#include "SimulationParams.hpp"
+#include "mpi/Comm.hpp"
 
 #include "profiling.hpp"
 
 #include <assert.h>
+#include <iostream>
 #include <type_traits>
 
 namespace Homme {
 
 DirkFunctor::DirkFunctor (int nelem) {
   m_dirk_impl.reset(new DirkFunctorImpl(nelem));
+
+  const auto& params = Context::singleton().get<SimulationParams>();
+  m_dirk_impl->set_newton_options(params.dirk_column_convergence,
+                                  params.dirk_warm_start,
+                                  params.internal_diagnostics_level > 0);
 }
 
 // Note: you cannot declare the default destructor in the header,
@@ -34,6 +42,10 @@ void DirkFunctor::init_buffers (const FunctorsBuffersManager& fbm) {
   m_dirk_impl->init_buffers(fbm);
 }
 
+void DirkFunctor::start_step () {
+  m_dirk_impl->start_step();
+}
+
 void DirkFunctor::run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
                        const Elements& elements, const HybridVCoord& hvcoord) {
   GPTLstart("compute_stage_value_dirk");
@@ -41,4 +53,39 @@ void DirkFunctor::run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int n
   GPTLstop("compute_stage_value_dirk");
 }
 
+void DirkFunctor::print_newton_stats () const {
+  if ( ! m_dirk_impl->m_collect_stats) return;
+
+  const int maxiter = DirkFunctorImpl::maxiter, nbin = maxiter + 1;
+  std::vector<int> col_hist, team_hist;
+  m_dirk_impl->get_newton_stats(col_hist, team_hist);
+
+  const auto& comm = Context::singleton().get<Comm>();
+  std::vector<long long> hist(2*nbin), ghist(2*nbin);
+  for (int b = 0; b < nbin; ++b) {
+    hist[b] = col_hist[b];
+    hist[nbin+b] = team_hist[b];
+  }
+  MPI_Reduce(hist.data(), ghist.data(), 2*nbin, MPI_LONG_LONG, MPI_SUM, 0, comm.mpi_comm());
+  if ( ! comm.root()) return;
+
+  // Column iterations done by the teams vs needed by the columns. The
+  // difference is the work spent on columns that had already converged.
+  const int ncol = NP*NP;
+  long long team_work = 0, col_work = 0;
+  std::cout << "DIRK Newton iterations: #columns #teams\n";
+  for (int b = 0; b < nbin; ++b) {
+    const int nit = b < maxiter ? b+1 : maxiter;
+    col_work  += nit*ghist[b];
+    team_work += nit*ncol*ghist[nbin+b];
+    if (ghist[b] == 0 && ghist[nbin+b] == 0) continue;
+    if (b < maxiter) std::cout << "  " << nit << ": ";
+    else             std::cout << "  not converged: ";
+    std::cout << ghist[b] << " " << ghist[nbin+b] << "\n";
+  }
+  if (team_work > 0)
+    std::cout << "DIRK Newton column iterations past column convergence: "
+              << 100.0*(team_work - col_work)/team_work << "%\n";
+}
+
 } // Namespace Homme
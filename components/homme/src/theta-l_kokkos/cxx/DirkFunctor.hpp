@@ -28,10 +28,18 @@ public:
   int requested_buffer_size() const;
   void init_buffers(const FunctorsBuffersManager& fbm);
 
+  // Call before the first DIRK stage of each dynamics step.
+  void start_step();
+
   // Top-level interface, equivalent to compute_stage_value_dirk.
   void run(int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
            const Elements& elements, const HybridVCoord& hvcoord);
 
+  // If Newton statistics are collected (internal_diagnostics_level > 0), print
+  // the histograms of Newton iteration counts, summed over all ranks. This is
+  // collective.
+  void print_newton_stats() const;
+
 private:
   std::unique_ptr<DirkFunctorImpl> m_dirk_impl;
 };
@@ -20,6 +20,7 @@
 #include "utilities/scream_tridiag.hpp"
 
 #include <cassert>
+#include <vector>
 
 namespace Homme {
 
@@ -32,6 +33,7 @@ struct DirkFunctorImpl {
   enum : int { num_phys_lev = NUM_PHYSICAL_LEV };
   enum : int { num_work = 12 };
   enum : bool { calc_initial_guess_in_newton_kernel = false };
+  enum : int { maxiter = 20 };
 
   enum : int {
 #ifdef HOMMEXX_BFB_TESTING
@@ -66,6 +68,25 @@ struct DirkFunctorImpl {
                    Kokkos::LayoutRight, ExecSpace,
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
 
+  // Per-element storage, in DIRK format, that persists across calls.
+  using ElemSlots
+    = Kokkos::View<Scalar*[num_lev_aligned][npack],
+                   Kokkos::LayoutRight, ExecSpace>;
+  // Bin it-1 counts the columns (or teams) that needed it Newton iterations to
+  // converge. Bin maxiter counts those that did not converge.
+  using IterHist = ExecViewManaged<int*>;
+
+  // With per-column convergence, the kernels of the Newton iteration skip pack
+  // i if cstat(2,i)[0] is 0, i.e., if all its columns have converged. The
+  // default mask skips nothing.
+  struct PackMask {
+    bool enabled = false;
+    LinearSystemSlot cstat;
+
+    KOKKOS_INLINE_FUNCTION
+    bool operator() (const int i) const { return ! enabled || cstat(2,i)[0] != 0; }
+  };
+
   KOKKOS_INLINE_FUNCTION
   static WorkSlot get_work_slot (const Work& w, const int& wi, const int& si) {
     using Kokkos::subview;
@@ -89,6 +110,18 @@ struct DirkFunctorImpl {
   TeamUtils<ExecSpace> m_tu, m_tu_ig;
   int nslot;
 
+  // Newton options. See set_newton_options.
+  bool m_column_convergence = false;
+  bool m_warm_start = false;
+  bool m_collect_stats = false;
+
+  // Newton increment of w from the previous stage, divided by dt2. Allocated
+  // only if warm start is on.
+  ElemSlots m_prev_dw;
+  bool m_have_prev_dw = false;
+
+  IterHist m_col_iter_hist, m_team_iter_hist;
+
   DirkFunctorImpl (const int nelem)
     : m_policy(1,1,1), m_ig_policy(1,1,1), m_tu(m_policy), m_tu_ig(m_ig_policy) // throwaway settings
   {
@@ -124,6 +157,59 @@ struct DirkFunctorImpl {
     m_tu_ig = TeamUtils<ExecSpace>(m_ig_policy);
   }
 
+  // column_convergence: Track convergence per column. A converged column's
+  //   state is no longer updated, and packs whose columns have all converged
+  //   skip the Newton iteration. The team still iterates until all of its
+  //   columns have converged. Columns converge to the same tolerance, but the
+  //   answer is not BFB with the team-wise iteration.
+  // warm_start: Start the Newton iteration from the w increment of the
+  //   previous call (scaled by dt2), in each column in which that increment
+  //   gives a valid (dphi < 0) state; elsewhere, use the hydrostatic guess.
+  //   The increment is only carried between the stages of one dynamics step
+  //   (see start_step), so that restarts are reproducible.
+  // collect_stats: Accumulate histograms of the number of Newton iterations
+  //   per column and per team; see get_newton_stats.
+  void set_newton_options (const bool column_convergence, const bool warm_start,
+                           const bool collect_stats) {
+    m_column_convergence = column_convergence;
+    m_warm_start = warm_start;
+    m_collect_stats = collect_stats;
+
+    const int nelem = m_policy.league_size();
+    if (m_warm_start && m_prev_dw.extent_int(0) != nelem)
+      m_prev_dw = ElemSlots("DirkFunctorImpl::prev_dw", nelem);
+    else if ( ! m_warm_start)
+      m_prev_dw = ElemSlots();
+    m_have_prev_dw = false;
+
+    if (m_collect_stats && m_col_iter_hist.size() == 0) {
+      m_col_iter_hist = IterHist("DirkFunctorImpl::col_iter_hist", maxiter+1);
+      m_team_iter_hist = IterHist("DirkFunctorImpl::team_iter_hist", maxiter+1);
+    }
+  }
+
+  // Get host copies of the iteration-count histograms accumulated since the
+  // last reset. Each has maxiter+1 bins; see IterHist.
+  void get_newton_stats (std::vector<int>& col_hist, std::vector<int>& team_hist) const {
+    col_hist.assign(maxiter+1, 0);
+    team_hist.assign(maxiter+1, 0);
+    if (m_col_iter_hist.size() == 0) return;
+    const auto ch = Kokkos::create_mirror_view(m_col_iter_hist);
+    const auto th = Kokkos::create_mirror_view(m_team_iter_hist);
+    Kokkos::deep_copy(ch, m_col_iter_hist);
+    Kokkos::deep_copy(th, m_team_iter_hist);
+    for (int b = 0; b <= maxiter; ++b) {
+      col_hist[b] = ch(b);
+      team_hist[b] = th(b);
+    }
+  }
+
+  void reset_newton_stats () {
+    if (m_col_iter_hist.size() == 0) return;
+    Kokkos::deep_copy(m_col_iter_hist, 0);
+    Kokkos::deep_copy(m_team_iter_hist, 0);
+  }
+
   int requested_buffer_size () const {
     // FunctorsBuffersManager wants the size in terms of sizeof(Real).
     return (Work::shmem_size(nslot) + LinearSystem::shmem_size(nslot))/sizeof(Real);
@@ -136,6 +222,10 @@ struct DirkFunctorImpl {
     m_ls = LinearSystem(mem, nslot);
   }
 
+  // Must be called before the first stage of each dynamics step. The first
+  // stage has no previous increment, and starts from the hydrostatic guess.
+  void start_step () { m_have_prev_dw = false; }
+
   void run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
             const Elements& e, const HybridVCoord& hvcoord,
             const bool bfb_solver = default_bfb_solver) {
@@ -207,7 +297,6 @@ struct DirkFunctorImpl {
 
     const auto grav = PhysicalConstants::g;
     const int nvec = npack;
-    const int maxiter = 20;
 #ifdef HOMMEXX_BFB_TESTING
     const Real deltatol = 1e-6; // In bfb testing, use coarse tolerance, due to zeroulp calls
 #else
@@ -226,6 +315,14 @@ struct DirkFunctorImpl {
     const auto e_initial_guess = e.m_derived.m_divdp_proj;
     const auto hybi = hvcoord.hybrid_bi;
     const auto tu   = m_tu;
+    const bool column_convergence = m_column_convergence;
+    const bool track_columns = m_column_convergence || m_collect_stats;
+    const bool collect_stats = m_collect_stats;
+    const bool warm_start = m_warm_start;
+    const bool use_prev_dw = m_warm_start && m_have_prev_dw;
+    const auto prev_dw = m_prev_dw;
+    const auto col_iter_hist = m_col_iter_hist;
+    const auto team_iter_hist = m_team_iter_hist;
 
     const auto toplevel = KOKKOS_LAMBDA (const MT& team, int& nerr) {
       KernelVariables kv(team, tu);
@@ -249,7 +346,13 @@ struct DirkFunctorImpl {
       const auto
       dl = get_ls_slot(ls, kv.team_idx, 0),
       d  = get_ls_slot(ls, kv.team_idx, 1),
-      du = get_ls_slot(ls, kv.team_idx, 2);
+      du = get_ls_slot(ls, kv.team_idx, 2),
+      // Per-column convergence status; see exit_on_column_step.
+      cstat = get_ls_slot(ls, kv.team_idx, 3);
+
+      PackMask active;
+      active.enabled = column_convergence;
+      active.cstat = cstat;
 
       // View of xfull for use in the solver. We want xfull so that we
       // can use the nlevp-1 entry, which we make sure is 0, when convenient.
@@ -339,30 +442,77 @@ struct DirkFunctorImpl {
 
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { dphi_n0(k,i) = phi_n0(k+1,i) - phi_n0(k,i); });
 
+      if (use_prev_dw) {
+        // Warm start: w_np1 = w_n0 + dt2*prev_dw, in each column in which the
+        // resulting dphi is < 0 at all levels. pnh is free until the Newton
+        // iteration, so use it for the candidate w_np1.
+        kv.team_barrier();
+        loop_ki(kv, nlev, nvec, [&] (int k, int i) { pnh(k,i) = w_n0(k,i) + dt2*prev_dw(ie,k,i); });
+        kv.team_barrier();
+        loop_ki(kv, nlev, nvec, [&] (int k, int i) {
+          xfull(k,i) = (k < nlev-1 ?
+                        dphi_n0(k,i) + dt2*grav*(pnh(k+1,i) - pnh(k,i)) :
+                        dphi_n0(k,i) - dt2*grav*pnh(k,i));
+        });
+        kv.team_barrier();
+        calc_whether_ge(kv, nlev, nvec, 0, xfull, wrk);
+        kv.team_barrier();
+        loop_ki(kv, nlev, nvec, [&] (int k, int i) {
+          for (int s = 0; s < packn; ++s) {
+            if (wrk(0,i)[s] != 0) continue;
+            w_np1(k,i)[s] = pnh(k,i)[s];
+            dphi(k,i)[s] = xfull(k,i)[s];
+          }
+        });
+        kv.team_barrier();
+      }
+
+      if (track_columns) {
+        loop_ki(kv, 1, nvec, [&] (int, int i) {
+          cstat(0,i) = 0;
+          cstat(1,i) = maxiter+1;
+          cstat(2,i) = 1;
+        });
+        kv.team_barrier();
+      }
+
       int it = 0;
       Real deltaerr;
       for (; it < maxiter; ++it) { // Newton iteration
         const bool ok = pnh_and_exner_from_eos(kv, hvcoord, vtheta_dp, dp3d,
-                                               dphi, pnh, wrk, dpnh_dp_i);
+                                               dphi, pnh, wrk, dpnh_dp_i,
+                                               num_phys_lev, active);
         if ( ! ok) nerr = 1;
         kv.team_barrier();
         loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
+          if ( ! active(i)) return;
           x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
         });
 
-        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du, num_phys_lev, active);
         kv.team_barrier();
         if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
         kv.team_barrier();
+        if (column_convergence) {
+          // Converged columns in active packs must not move.
+          loop_ki(kv, nlev, nvec, [&] (int k, int i) {
+            if ( ! active(i)) return;
+            for (int s = 0; s < packn; ++s)
+              if (cstat(0,i)[s] != 0) x(k,i)[s] = 0;
+          });
+          kv.team_barrier();
+        }
 
         loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
         kv.team_barrier();
         for (int nsafe = 0; nsafe < 2; ++nsafe) {
           loop_ki(kv, nlev-1, nvec, [&] (int k, int i) {
+            if ( ! active(i)) return;
             dphi(k,i) = dphi_n0(k,i) + dt2*grav*(         (w_np1(k+1,i) - w_np1(k,i)) +
                                                  wrk(2,i)*(    x(k+1,i) -     x(k,i)));
           });
           loop_ki(kv, 1, nvec, [&] (int, int i) {
+            if ( ! active(i)) return;
             const auto k = nlev-1;
             dphi(k,i) = dphi_n0(k,i) - dt2*grav*(w_np1(k,i) + wrk(2,i)*x(k,i));
           });
@@ -375,12 +525,47 @@ struct DirkFunctorImpl {
         }
         kv.team_barrier();
 
-        loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
+        loop_ki(kv, nlev, nvec, [&] (int k, int i) {
+          if ( ! active(i)) return;
+          w_np1(k,i) += wrk(2,i)*x(k,i);
+        });
 
-        if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+        if (track_columns) {
+          const bool all_converged = exit_on_column_step(kv, nlev, nvec, wmax, deltatol,
+                                                         it+1, x, cstat, deltaerr);
+          kv.team_barrier();
+          // Without per-column convergence, exit as the team-wise iteration
+          // does, so that collecting statistics does not change the answer.
+          if (column_convergence) {
+            if (all_converged) break;
+          } else {
+            if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+          }
+        } else {
+          if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+        }
       } // Newton iteration
       kv.team_barrier();
 
+      if (collect_stats) {
+        const auto f = [&] (const int idx) {
+          const int i = idx / packn, s = idx % packn;
+          const int nit = static_cast<int>(cstat(1,i)[s]);
+          Kokkos::single(Kokkos::PerThread(kv.team), [&] () {
+            Kokkos::atomic_increment(&col_iter_hist(nit-1));
+          });
+        };
+        parallel_for(Kokkos::TeamThreadRange(kv.team, static_cast<int>(scaln)), f);
+        Kokkos::single(Kokkos::PerTeam(kv.team), [&] () {
+          Kokkos::atomic_increment(&team_iter_hist(it));
+        });
+      }
+
+      if (warm_start) {
+        // Save the increment for the next call's initial guess.
+        loop_ki(kv, nlev, nvec, [&] (int k, int i) { prev_dw(ie,k,i) = (w_np1(k,i) - w_n0(k,i))/dt2; });
+      }
+
       if (it >= maxiter) {
         Kokkos::printf("[DIRK] WARNING! Newton reached max iteration count,"
                        " with deltaerr = %3.17f\n", deltaerr);
@@ -397,6 +582,7 @@ struct DirkFunctorImpl {
 
     int nerr;
     Kokkos::parallel_reduce(m_policy, toplevel, nerr);
+    if (m_warm_start) m_have_prev_dw = true;
     if (nerr > 0) {
       const int nt[] = {nm1, n0, np1};
       const char* ntname[] = {"nm1", "n0", "np1"};
@@ -561,7 +747,7 @@ struct DirkFunctorImpl {
     const R& vtheta_dp, const R& dp3d, const R& dphi,
     // exner is workspace. dpnh_dp_i(nlevp,:) is not computed.
     const W& pnh, const W& exner, const Wi& dpnh_dp_i,
-    const int nlev = NUM_PHYSICAL_LEV)
+    const int nlev = NUM_PHYSICAL_LEV, const PackMask& active = PackMask())
   {
     using Kokkos::parallel_for;
 
@@ -572,6 +758,7 @@ struct DirkFunctorImpl {
     // Compute pnh(1:nlev,:). pnh(nlevp,:) is not needed.
     const auto f1 = [&] (const int k) {
       const auto g = [&] (const int i) {
+        if ( ! active(i)) return;
         for (int s = 0; s < ns; ++s)
           if (vtheta_dp(k,i)[s] < 0 || dphi(k,i)[s] > 0) ok = false;
         EquationOfState::compute_pnh_and_exner(
@@ -586,6 +773,7 @@ struct DirkFunctorImpl {
     kv.team_barrier(); // wait for pnh
     const auto f2 = [&] (const int) {
       const auto k0 = [&] (const int i) {
+        if ( ! active(i)) return;
         const auto pnh_i_0 = hvcoord.hybrid_ai0*hvcoord.ps0; // hydrostatic ptop
         dpnh_dp_i(0,i) = 2*(pnh(0,i) - pnh_i_0)/dp3d(0,i);
       };
@@ -597,6 +785,7 @@ struct DirkFunctorImpl {
       // gnu and std=c++14. The macro ConstExceptGnu is defined in share/cxx/Config.hpp.
       ConstExceptGnu auto k = km1 + 1;
       const auto kr = [&] (const int i) {
+        if ( ! active(i)) return;
         dpnh_dp_i(k,i) = ((pnh(k,i) - pnh(k-1,i))/
                           ((dp3d(k-1,i) + dp3d(k,i))/2));
       };
@@ -704,6 +893,48 @@ struct DirkFunctorImpl {
     return deltaerr/wmax < deltatol;
   }
 
+  // Per-column version of exit_on_step. On input, cstat(0,i)[s] is 1 if column
+  // (i,s) has already converged. On output, the columns that converge with
+  // increment x are marked, cstat(1,i)[s] is set to nit for them, and
+  // cstat(2,i)[0] is 0 if all the columns of pack i have converged. deltaerr is
+  // the max increment over the columns not converged on input. Returns true if
+  // all columns have converged.
+  KOKKOS_INLINE_FUNCTION
+  static bool exit_on_column_step (const KernelVariables& kv, const int nlev, const int nvec,
+                                   const Real& wmax, const Real& deltatol, const int nit,
+                                   const LinearSystemSlot& x, const LinearSystemSlot& cstat,
+                                   Real& deltaerr) {
+    using Kokkos::parallel_reduce;
+    using Kokkos::TeamThreadRange;
+    using Kokkos::ThreadVectorRange;
+
+    const auto f = [&] (int idx, Real& maxval) {
+      const int i = idx / packn, s = idx % packn;
+      if (cstat(0,i)[s] != 0) return;
+      const auto g = [&] (int k, Real& lmaxval) { lmaxval = max(lmaxval, std::abs(x(k,i)[s])); };
+      Real colerr;
+      const auto vr = ThreadVectorRange(kv.team, nlev);
+      parallel_reduce(vr, g, Kokkos::Max<Real>(colerr));
+      if (colerr/wmax < deltatol) {
+        cstat(0,i)[s] = 1;   // benign write race
+        cstat(1,i)[s] = nit; // benign write race
+      }
+      maxval = max(maxval, colerr); // benign write race
+    };
+    const auto tr = TeamThreadRange(kv.team, static_cast<int>(scaln));
+    parallel_reduce(tr, f, Kokkos::Max<Real>(deltaerr));
+    kv.team_barrier();
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      Real any_active = 0;
+      for (int s = 0; s < packn; ++s) {
+        if (scaln % packn != 0 && i*packn + s >= scaln) break;
+        if (cstat(0,i)[s] == 0) any_active = 1;
+      }
+      cstat(2,i)[0] = any_active;
+    });
+    return deltaerr/wmax < deltatol;
+  }
+
   /* Compute Jacobian of F(phi) = sum(dphi) + const + (dt*g)^2 *(1-dp/dpi)
      column wise with respect to phi. Form the tridiagonal analytical Jacobian J
      to solve J * x = -f.
@@ -716,7 +947,8 @@ struct DirkFunctorImpl {
                              // All arrays are in DIRK format.
                              const R& dp3d, const R& dphi, const R& pnh,
                              const W& dl, const W& d, const W& du,
-                             const int nlev = NUM_PHYSICAL_LEV) {
+                             const int nlev = NUM_PHYSICAL_LEV,
+                             const PackMask& active = PackMask()) {
     using Kokkos::parallel_for;
 
     const int n = npack;
@@ -727,6 +959,7 @@ struct DirkFunctorImpl {
 
     const auto f1 = [&] (const int) {
       const auto ks = [&] (const int i) { // first Jacobian row
+        if ( ! active(i)) return;
         const int k = 0;
         const auto b = a/dp3d(k,i);
         du(k,i) = 2*b*(pnh(k,i)/dphi(k,i));
@@ -740,6 +973,7 @@ struct DirkFunctorImpl {
       // gnu and std=c++14. The macro ConstExceptGnu is defined in share/cxx/Config.hpp.
       ConstExceptGnu  auto k = km1 + 1;
       const auto kmid = [&] (const int i) { // middle Jacobian rows
+        if ( ! active(i)) return;
         const auto b = 2*a/(dp3d(k-1,i) + dp3d(k,i));
         dl(k,i) = b*(pnh(k-1,i)/dphi(k-1,i));
         du(k,i) = b*(pnh(k  ,i)/dphi(k  ,i));
@@ -756,6 +990,7 @@ struct DirkFunctorImpl {
     parallel_for(Kokkos::TeamThreadRange(kv.team, nlev-2), f2);
     const auto f3 = [&] (const int) {
       const auto ke = [&] (const int i) { // last Jacobian row
+        if ( ! active(i)) return;
         const int k = nlev-1;
         const auto b = 2*a/(dp3d(k-1,i) + dp3d(k,i));
         dl(k,i) = b*(pnh(k-1,i)/dphi(k-1,i));
@@ -122,6 +122,43 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
 #else
   m_process_nh_vars = not params.theta_hydrostatic_mode;
 #endif
+
+  m_overlap_exchange = params.overlap_bndry_exchange;
+}
+
+template<typename Tag>
+void HyperviscosityFunctorImpl::
+run_and_exchange (const Kokkos::TeamPolicy<ExecSpace,Tag>& policy,
+                  BoundaryExchange& be, const bool apply_rspheremp)
+{
+  assert (be.is_registration_completed());
+  if (m_overlap_exchange) {
+    auto compute = [&](const ExecViewUnmanaged<const int*>& elems) {
+      m_elems_subset = elems;
+      Kokkos::parallel_for(Homme::get_subset_team_policy(policy, elems.extent_int(0)), *this);
+      Kokkos::fence();
+      m_elems_subset = ExecViewUnmanaged<const int*>();
+    };
+    GPTLstart("hvf-bexch");
+    if (apply_rspheremp) {
+      be.exchange_overlapped(compute, m_geometry.m_rspheremp);
+    } else {
+      be.exchange_overlapped(compute);
+    }
+    GPTLstop("hvf-bexch");
+    return;
+  }
+
+  Kokkos::parallel_for(policy, *this);
+  Kokkos::fence();
+
+  GPTLstart("hvf-bexch");
+  if (apply_rspheremp) {
+    be.exchange(m_geometry.m_rspheremp);
+  } else {
+    be.exchange();
+  }
+  GPTLstop("hvf-bexch");
 }
 
 void HyperviscosityFunctorImpl::setup(const ElementsGeometry&     geometry,
@@ -271,14 +308,8 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     biharmonic_wk_theta ();
     GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
-
-    // Exchange
-    assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+    // Pre-exchange kernel, then exchange
+    run_and_exchange(m_policy_pre_exchange, *m_be, false);
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
@@ -335,14 +366,8 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   if (m_data.nu_top > 0) {
     for (int icycle = 0; icycle < m_data.hypervis_subcycle_tom; ++icycle) {
       // laplace(fields) --> ttens, etc.
-      Kokkos::parallel_for(m_policy_nutop_laplace, *this);
-      Kokkos::fence();
-
       // exchange is done on ttens, dptens, vtens, etc.
-      assert (m_be->is_registration_completed());
-      GPTLstart("hvf-bexch");
-      m_be_tom->exchange();
-      GPTLstop("hvf-bexch");
+      run_and_exchange(m_policy_nutop_laplace, *m_be_tom, false);
 
       Kokkos::parallel_for(m_policy_nutop_update_states, *this);
       Kokkos::fence();
@@ -350,19 +375,13 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   } // for sponge layer
 } // run()
 
-void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
+void HyperviscosityFunctorImpl::biharmonic_wk_theta()
 {
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
-
-  // Exchange
-  assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  // Then exchange
+  run_and_exchange(m_policy_first_laplace, *m_be, true);
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
@@ -380,6 +399,7 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
 KOKKOS_INLINE_FUNCTION
 void HyperviscosityFunctorImpl::operator() (const TagNutopLaplace&, const TeamMember& team) const {
   KernelVariables kv(team, m_tu);
+  if (m_elems_subset.size() > 0) kv.ie = m_elems_subset(kv.ie);
 
   using MidColumn = decltype(Homme::subview(m_buffers.wtens,0,0,0));
 
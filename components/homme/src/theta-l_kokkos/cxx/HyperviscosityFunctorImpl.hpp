@@ -105,7 +105,7 @@ public:
 
   void run (const int np1, const Real dt, const Real eta_ave_w);
 
-  void biharmonic_wk_theta () const;
+  void biharmonic_wk_theta ();
 
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
@@ -113,6 +113,7 @@ public:
      using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    if (m_elems_subset.size() > 0) kv.ie = m_elems_subset(kv.ie);
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -316,6 +317,7 @@ public:
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    if (m_elems_subset.size() > 0) kv.ie = m_elems_subset(kv.ie);
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -386,6 +388,12 @@ public:
 
 protected:
 
+  // Run the kernel with the given policy, then exchange the output with be.
+  // The two are overlapped if m_overlap_exchange is true.
+  template<typename Tag>
+  void run_and_exchange (const Kokkos::TeamPolicy<ExecSpace,Tag>& policy,
+                         BoundaryExchange& be, const bool apply_rspheremp);
+
   const int             m_num_elems;
   HyperviscosityData    m_data;
   ElementsState         m_state;
@@ -399,6 +407,11 @@ protected:
 
   bool m_process_nh_vars;
 
+  // Whether to overlap the kernels feeding a boundary exchange with the exchange
+  // itself. If m_elems_subset is not empty, those kernels only process these elements.
+  bool m_overlap_exchange;
+  ExecViewUnmanaged<const int*> m_elems_subset;
+
   // Policies
   Kokkos::TeamPolicy<ExecSpace,TagUpdateStates>     m_policy_update_states;
   Kokkos::TeamPolicy<ExecSpace,TagFirstLaplaceHV>   m_policy_first_laplace;
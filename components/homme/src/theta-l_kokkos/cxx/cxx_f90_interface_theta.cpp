@@ -47,7 +47,9 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const int& use_cpstar, const int& transport_alg, const int& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const int& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const int& overlap_bndry_exchange,
+                               const int& dirk_column_convergence, const int& dirk_warm_start)
 {
 
   // Check that the simulation options are supported. This helps us in the future, since we
@@ -125,6 +127,9 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.overlap_bndry_exchange        = (bool)overlap_bndry_exchange;
+  params.dirk_column_convergence       = (bool)dirk_column_convergence;
+  params.dirk_warm_start               = (bool)dirk_warm_start;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
@@ -630,7 +635,11 @@ void push_test_state_to_c (
 
 void sync_diagnostics_to_host_c ()
 {
-  Context::singleton().get<Diagnostics>().sync_diagnostics_to_host();
+  auto& c = Context::singleton();
+  c.get<Diagnostics>().sync_diagnostics_to_host();
+  if (c.has<DirkFunctor>()) {
+    c.get<DirkFunctor>().print_newton_stats();
+  }
 }
 
 } // extern "C"
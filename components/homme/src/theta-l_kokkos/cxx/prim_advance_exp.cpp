@@ -255,6 +255,7 @@ void ttype9_imex_timestep(const TimeLevel& tl,
 // Names of timelevels in RK:
 //         RKStageData (const int nm1_in, const int n0_in, const int np1_in, const int n0_qdp_in ...
   caar.run(RKStageData(n0, n0, nm1, qn0, dt, eta_ave_w/4.0, 1.0, 0.0, 1.0));
+  dirk.start_step();
   dirk.run(nm1, 0.0, n0, 0.0, nm1, dt, elements, hvcoord);
 
   // Stage 2
@@ -357,6 +358,7 @@ void ttype10_imex_timestep(const TimeLevel& tl,
   Real dt = dt_dyn/4.0;
 
   caar.run(RKStageData(n0, n0, nm1, qn0, dt, 0.0, 1.0, 0.0, 1.0));
+  dirk.start_step();
   dirk.run(nm1, 0.0, n0, 0.0, nm1, dt, elements, hvcoord);
 
   // Stage 2
@@ -33,6 +33,30 @@ void boundary_exchange_test_f90 (F90Ptr& field_min_1d_ptr, F90Ptr& field_max_1d_
 
 } // extern "C"
 
+// Count the entries (as Real's) where two views with the same layout differ
+template<typename ViewT>
+static int count_diffs (const ViewT& a, const ViewT& b) {
+  const Real* pa = reinterpret_cast<const Real*>(a.data());
+  const Real* pb = reinterpret_cast<const Real*>(b.data());
+  const size_t n = a.span()*sizeof(typename ViewT::value_type)/sizeof(Real);
+  int ndiffs = 0;
+  for (size_t i=0; i<n; ++i) {
+    if (pa[i]!=pb[i]) ++ndiffs;
+  }
+  return ndiffs;
+}
+
+// Copy the data of the given elements from src to dst
+template<typename ViewT>
+static void copy_elems (const ViewT& dst, const ViewT& src,
+                        const ExecViewUnmanaged<const int*>& elems) {
+  auto elems_h = Kokkos::create_mirror_view(elems);
+  Kokkos::deep_copy(elems_h, elems);
+  for (int i=0; i<elems_h.extent_int(0); ++i) {
+    Kokkos::deep_copy(Homme::subview(dst,elems_h(i)), Homme::subview(src,elems_h(i)));
+  }
+}
+
 // =========================== TESTS ============================ //
 
 TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
@@ -302,6 +326,84 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // Overlapping the exchange with the computation of the fields must give the
+  // same result as computing all the fields and then exchanging them, with
+  // and without rspheremp
+  {
+    // The "computation" sets the fields of the given elements to these values
+    decltype(field_2d_cxx)     field_2d_src    ("", num_elements);
+    decltype(field_3d_cxx)     field_3d_src    ("", num_elements);
+    decltype(field_3d_int_cxx) field_3d_int_src("", num_elements);
+    decltype(field_4d_cxx)     field_4d_src    ("", num_elements);
+    Kokkos::deep_copy(field_2d_src,     field_2d_cxx);
+    Kokkos::deep_copy(field_3d_src,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_src, field_3d_int_cxx);
+    Kokkos::deep_copy(field_4d_src,     field_4d_cxx);
+
+    ExecViewManaged<Real*[NP][NP]> rspheremp("rspheremp", num_elements);
+    genRandArray(rspheremp,engine,std::uniform_real_distribution<Real>(0.5,2.0));
+
+    const auto compute1 = [&](const ExecViewUnmanaged<const int*>& elems) {
+      copy_elems(field_2d_cxx, field_2d_src, elems);
+      copy_elems(field_4d_cxx, field_4d_src, elems);
+      Kokkos::fence();
+    };
+    const auto compute2 = [&](const ExecViewUnmanaged<const int*>& elems) {
+      copy_elems(field_3d_cxx,     field_3d_src,     elems);
+      copy_elems(field_3d_int_cxx, field_3d_int_src, elems);
+      Kokkos::fence();
+    };
+    // Start from garbage, to check that compute is called on all elements
+    const auto reset = [&]() {
+      Kokkos::deep_copy(field_2d_cxx,     -1.0);
+      Kokkos::deep_copy(field_3d_cxx,     Scalar(-1.0));
+      Kokkos::deep_copy(field_3d_int_cxx, Scalar(-1.0));
+      Kokkos::deep_copy(field_4d_cxx,     Scalar(-1.0));
+    };
+
+    for (const bool use_rspheremp : {false, true}) {
+      reset();
+      const auto halo     = connectivity->get_d_halo_elems();
+      const auto interior = connectivity->get_d_interior_elems();
+      compute1(halo); compute1(interior);
+      compute2(halo); compute2(interior);
+      if (use_rspheremp) {
+        be1->exchange(rspheremp);
+        be2->exchange(rspheremp);
+      } else {
+        be1->exchange();
+        be2->exchange();
+      }
+      Kokkos::deep_copy(field_2d_cxx_host,     field_2d_cxx);
+      Kokkos::deep_copy(field_3d_cxx_host,     field_3d_cxx);
+      Kokkos::deep_copy(field_3d_int_cxx_host, field_3d_int_cxx);
+      Kokkos::deep_copy(field_4d_cxx_host,     field_4d_cxx);
+
+      reset();
+      if (use_rspheremp) {
+        be1->exchange_overlapped(compute1, rspheremp);
+        be2->exchange_overlapped(compute2, rspheremp);
+      } else {
+        be1->exchange_overlapped(compute1);
+        be2->exchange_overlapped(compute2);
+      }
+
+      auto field_2d_ovl     = Kokkos::create_mirror(field_2d_cxx);
+      auto field_3d_ovl     = Kokkos::create_mirror(field_3d_cxx);
+      auto field_3d_int_ovl = Kokkos::create_mirror(field_3d_int_cxx);
+      auto field_4d_ovl     = Kokkos::create_mirror(field_4d_cxx);
+      Kokkos::deep_copy(field_2d_ovl,     field_2d_cxx);
+      Kokkos::deep_copy(field_3d_ovl,     field_3d_cxx);
+      Kokkos::deep_copy(field_3d_int_ovl, field_3d_int_cxx);
+      Kokkos::deep_copy(field_4d_ovl,     field_4d_cxx);
+
+      REQUIRE (count_diffs(field_2d_ovl,     field_2d_cxx_host)==0);
+      REQUIRE (count_diffs(field_3d_ovl,     field_3d_cxx_host)==0);
+      REQUIRE (count_diffs(field_3d_int_ovl, field_3d_int_cxx_host)==0);
+      REQUIRE (count_diffs(field_4d_ovl,     field_4d_cxx_host)==0);
+    }
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
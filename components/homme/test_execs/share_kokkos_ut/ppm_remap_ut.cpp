@@ -51,6 +51,7 @@ public:
   struct TagGridTest {};
   struct TagPPMTest {};
   struct TagRemapTest {};
+  struct TagRemapBatchTest {};
 
   static bool nan_boundaries(
       HostViewUnmanaged<Real * [NP][NP][_ppm_consts::DPO_PHYSICAL_LEV]> host) {
@@ -365,6 +366,67 @@ public:
     }
   }
 
+  void test_remap_batch() {
+    std::random_device rd;
+    const unsigned int catchRngSeed = Catch::rngSeed();
+    const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
+    std::cout << "seed: " << seed << (catchRngSeed==0 ? " (catch rng seed was 0)\n" : "\n");
+    rngAlg engine(seed);
+    std::uniform_real_distribution<Real> dist(0.125, 1000.0);
+    genRandArray(remap_vals, engine, dist);
+
+    initialize_layers(engine);
+
+    ExecViewManaged<Scalar * * [NP][NP][NUM_LEV]> orig_vals(
+        "original values", ne, num_remap);
+    Kokkos::deep_copy(orig_vals, remap_vals);
+
+    // Remap one variable at a time...
+    Kokkos::parallel_for(
+        Homme::get_default_team_policy<ExecSpace, TagRemapTest>(ne), *this);
+    Kokkos::fence();
+    auto single_remapped = Kokkos::create_mirror_view(remap_vals);
+    Kokkos::deep_copy(single_remapped, remap_vals);
+
+    // ...then all of them in one batch, which must give the same answer
+    Kokkos::deep_copy(remap_vals, orig_vals);
+    Kokkos::parallel_for(
+        Homme::get_default_team_policy<ExecSpace, TagRemapBatchTest>(ne), *this);
+    Kokkos::fence();
+    auto batch_remapped = Kokkos::create_mirror_view(remap_vals);
+    Kokkos::deep_copy(batch_remapped, remap_vals);
+
+    for (int ie = 0; ie < ne; ++ie) {
+      for (int var = 0; var < num_remap; ++var) {
+        for (int igp = 0; igp < NP; ++igp) {
+          for (int jgp = 0; jgp < NP; ++jgp) {
+            for (int ilev = 0; ilev < NUM_LEV; ++ilev) {
+              for (int v = 0; v < VECTOR_SIZE; ++v) {
+                const Real single = single_remapped(ie, var, igp, jgp, ilev)[v];
+                const Real batch = batch_remapped(ie, var, igp, jgp, ilev)[v];
+                REQUIRE(std::isnan(single) == std::isnan(batch));
+                if (!std::isnan(single)) {
+                  REQUIRE(single == batch);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagRemapBatchTest &, const TeamMember& team) const {
+    KernelVariables kv(team);
+    remap.compute_grids_phase(
+        kv, Homme::subview(src_layer_thickness_kokkos, kv.ie),
+        Homme::subview(tgt_layer_thickness_kokkos, kv.ie));
+    remap.compute_remap_phase(kv, num_remap, [&](const int var) {
+      return Homme::subview(remap_vals, kv.ie, var);
+    });
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagRemapTest &, const TeamMember& team) const {
     KernelVariables kv(team);
@@ -390,6 +452,7 @@ TEST_CASE("ppm_mirrored", "vertical remap") {
   SECTION("grid") { remap_test_mirrored.test_grid(); }
   SECTION("ppm") { remap_test_mirrored.test_ppm(); }
   SECTION("remap") { remap_test_mirrored.test_remap(); }
+  SECTION("remap_batch") { remap_test_mirrored.test_remap_batch(); }
 }
 
 
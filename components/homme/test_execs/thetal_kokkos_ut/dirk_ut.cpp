@@ -762,9 +762,13 @@ TEST_CASE ("dirk_toplevel_testing") {
     const int nm1 = alphadtwt_nm1 == 0.0 ? -1 : 0;
     for (Real alphadtwt_n0 : {0.0, 0.7}) {
       decltype(ElementsState::m_w_i) w_i("w_i", nelemd),
-        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd);
+        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd), w_i3("w_i3", nelemd),
+        w_i4("w_i4", nelemd);
       decltype(ElementsState::m_phinh_i) phinh_i("phinh_i", nelemd),
-        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd);
+        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd),
+        phinh_i3("phinh_i3", nelemd), phinh_i4("phinh_i4", nelemd);
+      bool start_step_is_cold = true;
+      std::vector<int> col_hist, team_hist;
 
       bool good = false;
       for (int trial = 0; trial < 100 /* don't enter an inf loop */; ++trial) {
@@ -827,6 +831,47 @@ TEST_CASE ("dirk_toplevel_testing") {
         deep_copy(e.m_state.m_w_i, w_i);
         deep_copy(e.m_state.m_phinh_i, phinh_i);
 
+        // Run C++ with per-column convergence and warm start, twice, so that
+        // the second run starts from the increment of the first.
+        d.set_newton_options(true /* column convergence */, true /* warm start */,
+                             true /* stats */);
+        for (int rep = 0; rep < 2; ++rep) {
+          d.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+                e, hvcoord, false /* non-BFB solver */);
+          fence();
+          deep_copy(rep == 0 ? w_i4 : w_i3, e.m_state.m_w_i);
+          deep_copy(rep == 0 ? phinh_i4 : phinh_i3, e.m_state.m_phinh_i);
+          // Restore state.
+          deep_copy(e.m_state.m_w_i, w_i);
+          deep_copy(e.m_state.m_phinh_i, phinh_i);
+        }
+        d.get_newton_stats(col_hist, team_hist);
+
+        // A new step does not see the increment of the previous one, so its
+        // first stage is BFB with the cold start above.
+        d.start_step();
+        d.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+              e, hvcoord, false /* non-BFB solver */);
+        fence();
+        {
+          const auto w4m = cmvdc(w_i4), wm = cmvdc(e.m_state.m_w_i);
+          const auto phinh4m = cmvdc(phinh_i4), phinhm = cmvdc(e.m_state.m_phinh_i);
+          for (int ie = 0; ie < nelemd; ++ie)
+            for (int i = 0; i < np; ++i)
+              for (int j = 0; j < np; ++j)
+                for (int f = 0; f < 2; ++f) {
+                  Real* p4 = f == 0 ? &w4m(ie,np1,i,j,0)[0] : &phinh4m(ie,np1,i,j,0)[0];
+                  Real* p = f == 0 ? &wm(ie,np1,i,j,0)[0] : &phinhm(ie,np1,i,j,0)[0];
+                  for (int k = 0; k < nlev+1; ++k)
+                    if (p4[k] != p[k]) start_step_is_cold = false;
+                }
+        }
+        // Restore state.
+        deep_copy(e.m_state.m_w_i, w_i);
+        deep_copy(e.m_state.m_phinh_i, phinh_i);
+        d.set_newton_options(false, false, false);
+        d.reset_newton_stats();
+
         break;
       }
 
@@ -848,6 +893,34 @@ TEST_CASE ("dirk_toplevel_testing") {
                 REQUIRE(almost_equal(p1[k], p2[k], 1e6*eps));
             }
 
+      { // Test per-column convergence and warm start against the team-wise
+        // Newton iteration.
+        const auto w3m = cmvdc(w_i3);
+        const auto phinh3m = cmvdc(phinh_i3);
+        for (int ie = 0; ie < nelemd; ++ie)
+          for (int i = 0; i < np; ++i)
+            for (int j = 0; j < np; ++j)
+              for (int f = 0; f < 2; ++f) {
+                Real* p1 = f == 0 ? &w1m(ie,np1,i,j,0)[0] : &phinh1m(ie,np1,i,j,0)[0];
+                Real* p3 = f == 0 ? &w3m(ie,np1,i,j,0)[0] : &phinh3m(ie,np1,i,j,0)[0];
+                for (int k = 0; k < nlev+1; ++k)
+                  REQUIRE(almost_equal(p1[k], p3[k], 1e6*eps));
+              }
+
+        // Every column and team of the two runs is counted, and all converged.
+        int ncol = 0, nteam = 0;
+        for (int b = 0; b <= dfi::maxiter; ++b) {
+          ncol += col_hist[b];
+          nteam += team_hist[b];
+        }
+        REQUIRE(ncol == 2*nelemd*np*np);
+        REQUIRE(nteam == 2*nelemd);
+        REQUIRE(col_hist[dfi::maxiter] == 0);
+        REQUIRE(team_hist[dfi::maxiter] == 0);
+
+        REQUIRE(start_step_is_cold);
+      }
+
       // Run F90 with BFB solver.
       c2f(e);
       compute_stage_value_dirk_f90(nm1+1, alphadtwt_nm1*dt2, n0+1, alphadtwt_n0*dt2, np1+1, dt2);